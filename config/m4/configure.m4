@@ -97,3 +97,19 @@ AC_ARG_ENABLE([assert],
     AS_HELP_STRING([--enable-assert], [Enable extra correctness checks (default is NO).]),
     [AC_DEFINE([UCC_ENABLE_ASSERT], [1], [Enable asserts])],
     [enable_assert=no])
+
+#
+# Links the components without external dependencies into libucc, so that
+# they are registered from a static table instead of found via dlopen
+#
+AC_ARG_ENABLE([builtin-components],
+    AS_HELP_STRING([--enable-builtin-components],
+                   [Link cl/basic, cl/hier, mc/cpu and ec/cpu into libucc instead of building them as loadable modules (default is NO).]),
+    [:],
+    [enable_builtin_components=no])
+AS_IF([test "x$enable_builtin_components" = xyes],
+    [AS_MESSAGE([enabling builtin components])
+    AC_DEFINE([HAVE_BUILTIN_COMPONENTS], [1], [Link core components into libucc])],
+    [:])
+AM_CONDITIONAL([HAVE_BUILTIN_COMPONENTS],
+               [test "x$enable_builtin_components" = xyes])
@@ -48,7 +48,7 @@ static inline ucc_status_t
 coll_score_add_range(ucc_coll_score_t *score, ucc_coll_type_t coll_type,
                      ucc_memory_type_t mem_type, size_t start, size_t end,
                      ucc_score_t msg_score, ucc_base_coll_init_fn_t init,
-                     ucc_base_team_t *team)
+                     ucc_base_team_t *team, int alg_id)
 {
     ucc_msg_range_t *r;
     ucc_msg_range_t *range;
@@ -70,6 +70,7 @@ coll_score_add_range(ucc_coll_score_t *score, ucc_coll_type_t coll_type,
     r->super.score = msg_score;
     r->super.init  = init;
     r->super.team  = team;
+    r->super.alg_id = alg_id;
     list           = &score->scores[ucc_ilog2(coll_type)][mem_type];
     insert_pos     = list;
     ucc_list_for_each(range, list, super.list_elem) {
@@ -104,7 +105,7 @@ ucc_status_t ucc_coll_score_add_range(ucc_coll_score_t *score,
         return UCC_OK;
     }
     return coll_score_add_range(score, coll_type, mem_type, start, end,
-                                msg_score, init, team);
+                                msg_score, init, team, -1);
 }
 
 void ucc_coll_score_free(ucc_coll_score_t *score)
@@ -125,6 +126,7 @@ void ucc_coll_score_free(ucc_coll_score_t *score)
 static ucc_status_t ucc_fallback_alloc(ucc_score_t              score,
                                        ucc_base_coll_init_fn_t  init,
                                        ucc_base_team_t         *team,
+                                       int                      alg_id,
                                        ucc_coll_entry_t       **_fb)
 {
     ucc_coll_entry_t *fb;
@@ -138,8 +140,9 @@ static ucc_status_t ucc_fallback_alloc(ucc_score_t              score,
     }
     fb->score = score;
     fb->init  = init;
-    fb->team  = team;
-    *_fb      = fb;
+    fb->team   = team;
+    fb->alg_id = alg_id;
+    *_fb       = fb;
     return UCC_OK;
 }
 
@@ -152,7 +155,7 @@ static inline void ucc_fallback_insert(ucc_list_link_t  *list,
     insert_pos = list;
     ucc_list_for_each(f, list, list_elem) {
         if (fb->score == f->score && fb->init == f->init &&
-            fb->team == f->team) {
+            fb->team == f->team && fb->alg_id == f->alg_id) {
             ucc_free(fb);
             /* same fallback: skip */
             return;
@@ -169,7 +172,8 @@ static inline void ucc_fallback_insert(ucc_list_link_t  *list,
 #define FB_ALLOC_INSERT(_fb_in, _fb_out, _dest, _status, _label) do {   \
         _status =                                                       \
             ucc_fallback_alloc((_fb_in)->score, (_fb_in)->init,         \
-                               (_fb_in)->team, &(_fb_out));             \
+                               (_fb_in)->team, (_fb_in)->alg_id,        \
+                               &(_fb_out));                             \
         if (ucc_unlikely(UCC_OK != _status)) {                          \
             goto _label;                                                \
         }                                                               \
@@ -234,7 +238,7 @@ static ucc_status_t ucc_msg_range_add_fallback(const ucc_msg_range_t *in,
     }
 
     status = ucc_fallback_alloc(in->super.score, in->super.init, in->super.team,
-                                &fb);
+                                in->super.alg_id, &fb);
     if (ucc_unlikely(UCC_OK != status)) {
         return status;
     }
@@ -288,7 +292,7 @@ static inline int ucc_msg_range_fb_compare(ucc_msg_range_t *r1,
     fb2 = ucc_list_head(l2, ucc_coll_entry_t, list_elem);
     ucc_list_for_each(fb1, l1, list_elem) {
         if (fb1->score != fb2->score || fb1->init != fb2->init ||
-            fb1->team != fb2->team) {
+            fb1->team != fb2->team || fb1->alg_id != fb2->alg_id) {
             return 0;
         }
         fb2 = ucc_list_next(&fb2->list_elem, ucc_coll_entry_t, list_elem);
@@ -386,6 +390,7 @@ static ucc_status_t ucc_coll_score_merge_one(ucc_list_link_t *list1,
                 range->end == next->start &&
                 range->super.init == next->super.init &&
                 range->super.team == next->super.team &&
+                range->super.alg_id == next->super.alg_id &&
                 1 == ucc_msg_range_fb_compare(range, next)) {
                 next->start = range->start;
                 ucc_list_del(&range->super.list_elem);
@@ -639,6 +644,26 @@ err:
     goto out;
 }
 
+/* Maps algorithm name back to its numeric id: alg_fn only goes from
+   id/name to init, so look for the id that gives the same init fn */
+static int ucc_coll_score_alg_id_from_init(ucc_alg_id_to_init_fn_t alg_fn,
+                                           ucc_base_coll_init_fn_t alg_init,
+                                           ucc_coll_type_t         coll_type,
+                                           ucc_memory_type_t       mem_type)
+{
+    ucc_base_coll_init_fn_t init;
+    int                     i;
+
+    for (i = 0; i < UCC_COLL_SCORE_ALG_ID_MAX; i++) {
+        init = NULL;
+        if (UCC_OK == alg_fn(i, NULL, coll_type, mem_type, &init) &&
+            init == alg_init) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 static ucc_status_t ucc_coll_score_parse_str(const char *str,
                                              ucc_coll_score_t *score,
                                              ucc_rank_t team_size,
@@ -652,6 +677,7 @@ static ucc_status_t ucc_coll_score_parse_str(const char *str,
     ucc_rank_t             *tsizes   = NULL;
     ucc_base_coll_init_fn_t alg_init = NULL;
     const char*             alg_id   = NULL;
+    int                     alg_id_v = -1;
     ucc_score_t             score_v  = UCC_SCORE_INVALID;
     int                     ts_skip  = 0;
     uint32_t                mtypes   = 0;
@@ -760,6 +786,10 @@ static ucc_status_t ucc_coll_score_parse_str(const char *str,
                                   team->context->lib->log_component.name);
                         goto out;
                     }
+                    alg_id_v = alg_id_str ?
+                        ucc_coll_score_alg_id_from_init(alg_fn, alg_init,
+                                                        coll_type, mem_type) :
+                        alg_id_n;
                 }
                 for (r = 0; r < n_ranges; r++) {
                     size_t m_start = 0;
@@ -770,7 +800,7 @@ static ucc_status_t ucc_coll_score_parse_str(const char *str,
                     }
                     status = coll_score_add_range(
                         score, coll_type, mem_type, m_start, m_end, score_v,
-                        alg_init ? alg_init : init, team);
+                        alg_init ? alg_init : init, team, alg_id_v);
                 }
             }
         }
@@ -880,8 +910,9 @@ static ucc_status_t ucc_coll_score_update_one(ucc_list_link_t *dest,
                         /* User setting overrides existing init fn. Save it as a fallback */
                         FB_ALLOC_INSERT(&rd->super, fb, rd, status, out);
                     }
-                    rd->super.init = rs->super.init;
-                    rd->super.team = rs->super.team;
+                    rd->super.init   = rs->super.init;
+                    rd->super.team   = rs->super.team;
+                    rd->super.alg_id = rs->super.alg_id;
                 }
                 rs->start = rd->end;
                 d         = d->next;
@@ -896,8 +927,9 @@ static ucc_status_t ucc_coll_score_update_one(ucc_list_link_t *dest,
                         /* User setting overrides existing init fn. Save it as a fallback */
                         FB_ALLOC_INSERT(&rd->super, fb, new, status, out);
                     }
-                    new->super.init = rs->super.init;
-                    new->super.team = rs->super.team;
+                    new->super.init   = rs->super.init;
+                    new->super.team   = rs->super.team;
+                    new->super.alg_id = rs->super.alg_id;
                 }
                 ucc_list_insert_before(d, &new->super.list_elem);
                 rd->start = rs->end;
@@ -911,8 +943,9 @@ static ucc_status_t ucc_coll_score_update_one(ucc_list_link_t *dest,
                         /* User setting overrides existing init fn. Save it as a fallback */
                         FB_ALLOC_INSERT(&rd->super, fb, rd, status, out);
                     }
-                    rd->super.init = rs->super.init;
-                    rd->super.team = rs->super.team;
+                    rd->super.init   = rs->super.init;
+                    rd->super.team   = rs->super.team;
+                    rd->super.alg_id = rs->super.alg_id;
                 }
                 s = s->next;
                 d = d->next;
@@ -950,6 +983,7 @@ static ucc_status_t ucc_coll_score_update_one(ucc_list_link_t *dest,
                 range->end == next->start &&
                 range->super.init == next->super.init &&
                 range->super.team == next->super.team &&
+                range->super.alg_id == next->super.alg_id &&
                 1 == ucc_msg_range_fb_compare(range, next)) {
                 next->start = range->start;
                 ucc_list_del(&range->super.list_elem);
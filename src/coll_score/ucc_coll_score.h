@@ -19,6 +19,9 @@
 
 #define UCC_MSG_MAX UINT64_MAX
 
+/* Upper bound of numeric algorithm ids of a single coll type */
+#define UCC_COLL_SCORE_ALG_ID_MAX 32
+
 /* Callback that maps alg_id (int or str) to the "init" function.
    This callback is provided by the component (CL/TL) that uses
    ucc_coll_score_alloc_from_str.
@@ -48,6 +51,8 @@ typedef struct ucc_coll_entry {
     ucc_score_t              score;
     ucc_base_coll_init_fn_t  init;
     ucc_base_team_t         *team;
+    /* algorithm id resolved by alg_fn, -1 if init selects algorithm itself */
+    int                      alg_id;
 } ucc_coll_entry_t;
 
 typedef struct ucc_msg_range {
@@ -81,9 +81,9 @@ static ucc_status_t ucc_coll_score_map_lookup(ucc_score_map_t *map,
     ucc_memory_type_t mt      = ucc_coll_args_mem_type(&bargs->args,
                                                        map->team_rank);
     unsigned          ct      = ucc_ilog2(bargs->args.coll_type);
-    size_t            msgsize = ucc_coll_args_msgsize(&bargs->args,
-                                                      map->team_rank,
-                                                      map->team_size);
+    size_t            msgsize = ucc_base_coll_args_msgsize(bargs,
+                                                           map->team_rank,
+                                                           map->team_size);
     ucc_list_link_t *list;
     ucc_msg_range_t *r;
 
@@ -128,6 +128,11 @@ ucc_status_t ucc_coll_init(ucc_score_map_t      *map,
     team   = r->super.team;
     status = r->super.init(bargs, team, task);
     if (UCC_OK == status) {
+        /* entry of e.g. CL/BASIC creates the task of the lower level map,
+           alg_id is set there */
+        if ((*task)->team == team) {
+            (*task)->alg_id = r->super.alg_id;
+        }
         return UCC_OK;
     }
 
@@ -139,8 +144,12 @@ ucc_status_t ucc_coll_init(ucc_score_map_t      *map,
                   ucc_coll_type_str(bargs->args.coll_type),
                   team->context->lib->log_component.name,
                   fb->team->context->lib->log_component.name);
+        ucc_coll_stats_add_fallback(bargs->team);
         team   = fb->team;
         status = fb->init(bargs, team, task);
+        if (UCC_OK == status && (*task)->team == team) {
+            (*task)->alg_id = fb->alg_id;
+        }
         fb     = ucc_list_next(&fb->list_elem, ucc_coll_entry_t, list_elem);
     }
 
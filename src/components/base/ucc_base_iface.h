@@ -47,7 +47,10 @@ typedef struct ucc_base_ctx_config {
 enum {
     UCC_BASE_LIB_FLAG_TEAM_ID_REQUIRED          = UCC_BIT(1),
     UCC_BASE_LIB_FLAG_SERVICE_TEAM_REQUIRED     = UCC_BIT(2),
-    UCC_BASE_LIB_FLAG_CTX_SERVICE_TEAM_REQUIRED = UCC_BIT(3)
+    UCC_BASE_LIB_FLAG_CTX_SERVICE_TEAM_REQUIRED = UCC_BIT(3),
+    /* context create and epilog are local to the process and the context
+       has no address, so it may be created on first use by a team */
+    UCC_BASE_LIB_FLAG_LAZY_CONTEXT              = UCC_BIT(4)
 };
 
 enum {
@@ -163,7 +166,8 @@ typedef struct ucc_base_team_iface {
 } ucc_base_team_iface_t;
 
 enum {
-    UCC_BASE_CARGS_MAX_FRAG_COUNT = UCC_BIT(0)
+    UCC_BASE_CARGS_MAX_FRAG_COUNT = UCC_BIT(0),
+    UCC_BASE_CARGS_MSGSIZE        = UCC_BIT(1)
 };
 
 typedef struct ucc_buffer_info_asymmetric_memtype {
@@ -179,9 +183,30 @@ typedef struct ucc_base_coll_args {
     ucc_coll_args_t                      args;
     ucc_team_t                          *team;
     size_t                               max_frag_count;
+    size_t                               msgsize; /* UCC_BASE_CARGS_MSGSIZE */
     ucc_buffer_info_asymmetric_memtype_t asymmetric_save_info;
 } ucc_base_coll_args_t;
 
+/* Message size of user defined datatypes is queried through user pack
+   callbacks, so it is computed once and cached in the base args for the
+   score map lookups and coll stats of the same collective */
+static inline size_t ucc_base_coll_args_msgsize(ucc_base_coll_args_t *bargs,
+                                                ucc_rank_t rank,
+                                                ucc_rank_t size)
+{
+    size_t msgsize;
+
+    if (bargs->mask & UCC_BASE_CARGS_MSGSIZE) {
+        return bargs->msgsize;
+    }
+    msgsize = ucc_coll_args_msgsize(&bargs->args, rank, size);
+    if (ucc_unlikely(!ucc_coll_args_is_predefined_dt(&bargs->args, rank))) {
+        bargs->msgsize = msgsize;
+        bargs->mask   |= UCC_BASE_CARGS_MSGSIZE;
+    }
+    return msgsize;
+}
+
 typedef ucc_status_t (*ucc_base_coll_init_fn_t)(ucc_base_coll_args_t *coll_args,
                                                 ucc_base_team_t      *team,
                                                 ucc_coll_task_t     **task);
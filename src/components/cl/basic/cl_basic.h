@@ -37,6 +37,9 @@ UCC_CLASS_DECLARE(ucc_cl_basic_lib_t, const ucc_base_lib_params_t *,
 
 typedef struct ucc_cl_basic_context {
     ucc_cl_context_t   super;
+    /* TLs created on first use by a team, see UCC_LAZY_TLS */
+    const char       **lazy_tls;
+    unsigned           n_lazy_tls;
 } ucc_cl_basic_context_t;
 UCC_CLASS_DECLARE(ucc_cl_basic_context_t, const ucc_base_context_params_t *,
                   const ucc_base_config_t *);
@@ -46,6 +49,8 @@ typedef struct ucc_cl_basic_team {
     ucc_team_multiple_req_t *team_create_req;
     ucc_tl_team_t          **tl_teams;
     unsigned                 n_tl_teams;
+    ucc_tl_context_t       **lazy_tl_ctxs;
+    unsigned                 n_lazy_tl_ctxs;
     ucc_coll_score_t        *score;
     ucc_score_map_t         *score_map;
 } ucc_cl_basic_team_t;
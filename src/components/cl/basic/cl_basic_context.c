@@ -30,8 +30,22 @@ UCC_CLASS_INIT_FUNC(ucc_cl_basic_context_t,
                  sizeof(ucc_tl_context_t**) * tls->count);
         return UCC_ERR_NO_MEMORY;
     }
+    self->lazy_tls = ucc_malloc(sizeof(char*) * tls->count,
+                                "cl_basic_lazy_tls");
+    if (!self->lazy_tls) {
+        cl_error(cl_config->cl_lib, "failed to allocate %zd bytes for lazy_tls",
+                 sizeof(char*) * tls->count);
+        ucc_free(self->super.tl_ctxs);
+        return UCC_ERR_NO_MEMORY;
+    }
     self->super.n_tl_ctxs = 0;
+    self->n_lazy_tls      = 0;
     for (i = 0; i < tls->count; i++) {
+        if (ucc_context_tl_is_lazy(params->context, tls->names[i])) {
+            /* context is created by the first team that uses it */
+            self->lazy_tls[self->n_lazy_tls++] = tls->names[i];
+            continue;
+        }
         status = ucc_tl_context_get(params->context, tls->names[i],
                                    &self->super.tl_ctxs[self->super.n_tl_ctxs]);
         if (UCC_OK != status) {
@@ -41,8 +55,9 @@ UCC_CLASS_INIT_FUNC(ucc_cl_basic_context_t,
             self->super.n_tl_ctxs++;
         }
     }
-    if (0 == self->super.n_tl_ctxs) {
+    if (0 == self->super.n_tl_ctxs && 0 == self->n_lazy_tls) {
         cl_error(cl_config->cl_lib, "no TL contexts are available");
+        ucc_free(self->lazy_tls);
         ucc_free(self->super.tl_ctxs);
         self->super.tl_ctxs = NULL;
         return UCC_ERR_NOT_FOUND;
@@ -59,6 +74,7 @@ UCC_CLASS_CLEANUP_FUNC(ucc_cl_basic_context_t)
         ucc_tl_context_put(self->super.tl_ctxs[i]);
     }
     ucc_free(self->super.tl_ctxs);
+    ucc_free(self->lazy_tls);
 }
 
 UCC_CLASS_DEFINE(ucc_cl_basic_context_t, ucc_cl_context_t);
@@ -14,17 +14,45 @@ UCC_CLASS_INIT_FUNC(ucc_cl_basic_team_t, ucc_base_context_t *cl_context,
     ucc_cl_basic_context_t *ctx       =
         ucc_derived_of(cl_context, ucc_cl_basic_context_t);
     unsigned                n_tl_ctxs = ctx->super.n_tl_ctxs;
+    ucc_tl_context_t       *tl_ctx;
     int                     i;
     ucc_status_t            status;
 
     UCC_CLASS_CALL_SUPER_INIT(ucc_cl_team_t, &ctx->super, params);
+    self->n_lazy_tl_ctxs = 0;
+    self->lazy_tl_ctxs   = ucc_malloc(sizeof(ucc_tl_context_t *) *
+                                      (ctx->n_lazy_tls + 1),
+                                      "cl_basic_lazy_tl_ctxs");
+    if (!self->lazy_tl_ctxs) {
+        cl_error(cl_context->lib,
+                 "failed to allocate %zd bytes for lazy_tl_ctxs",
+                 sizeof(ucc_tl_context_t *) * (ctx->n_lazy_tls + 1));
+        return UCC_ERR_NO_MEMORY;
+    }
+    for (i = 0; i < ctx->n_lazy_tls; i++) {
+        /* creates tl context if this is its first user */
+        if (UCC_OK == ucc_tl_context_get(cl_context->ucc_context,
+                                         ctx->lazy_tls[i], &tl_ctx)) {
+            self->lazy_tl_ctxs[self->n_lazy_tl_ctxs++] = tl_ctx;
+        } else {
+            cl_debug(cl_context->lib,
+                     "TL %s context is not available, skipping",
+                     ctx->lazy_tls[i]);
+        }
+    }
+    n_tl_ctxs += self->n_lazy_tl_ctxs;
+    if (0 == n_tl_ctxs) {
+        cl_error(cl_context->lib, "no TL contexts are available");
+        status = UCC_ERR_NOT_FOUND;
+        goto err_tl_teams;
+    }
     self->tl_teams = ucc_malloc(sizeof(ucc_tl_team_t *) * n_tl_ctxs,
                                 "cl_basic_tl_teams");
     if (!self->tl_teams) {
         cl_error(cl_context->lib, "failed to allocate %zd bytes for tl_teams",
                  sizeof(ucc_tl_team_t *) * n_tl_ctxs);
         status = UCC_ERR_NO_MEMORY;
-        goto err;
+        goto err_tl_teams;
     }
     self->n_tl_teams = 0;
     self->score_map  = NULL;
@@ -37,7 +65,9 @@ UCC_CLASS_INIT_FUNC(ucc_cl_basic_team_t, ucc_base_context_t *cl_context,
     for (i = 0; i < n_tl_ctxs; i++) {
         memcpy(&self->team_create_req->descs[i].param, params,
                sizeof(ucc_base_team_params_t));
-        self->team_create_req->descs[i].ctx            = ctx->super.tl_ctxs[i];
+        self->team_create_req->descs[i].ctx =
+            (i < ctx->super.n_tl_ctxs) ? ctx->super.tl_ctxs[i] :
+            self->lazy_tl_ctxs[i - ctx->super.n_tl_ctxs];
         self->team_create_req->descs[i].param.scope    = UCC_CL_BASIC;
         self->team_create_req->descs[i].param.scope_id = 0;
     }
@@ -53,6 +83,11 @@ UCC_CLASS_INIT_FUNC(ucc_cl_basic_team_t, ucc_base_context_t *cl_context,
     return UCC_OK;
 err:
     ucc_free(self->tl_teams);
+err_tl_teams:
+    for (i = 0; i < self->n_lazy_tl_ctxs; i++) {
+        ucc_tl_context_put(self->lazy_tl_ctxs[i]);
+    }
+    ucc_free(self->lazy_tl_ctxs);
     return status;
 }
 
@@ -99,6 +134,10 @@ ucc_status_t ucc_cl_basic_team_destroy(ucc_base_team_t *cl_team)
         ucc_coll_score_free_map(team->score_map);
     }
     ucc_free(team->tl_teams);
+    for (i = 0; i < team->n_lazy_tl_ctxs; i++) {
+        ucc_tl_context_put(team->lazy_tl_ctxs[i]);
+    }
+    ucc_free(team->lazy_tl_ctxs);
     UCC_CLASS_DELETE_FUNC_NAME(ucc_cl_basic_team_t)(cl_team);
     return status;
 }
@@ -113,7 +152,7 @@ ucc_status_t ucc_cl_basic_team_create_test(ucc_base_team_t *cl_team)
 
     status = ucc_tl_team_create_multiple(team->team_create_req);
     if (status == UCC_OK) {
-        for (i = 0; i < ctx->super.n_tl_ctxs; i++) {
+        for (i = 0; i < team->team_create_req->n_teams; i++) {
             if (team->team_create_req->descs[i].status == UCC_OK) {
                 team->tl_teams[team->n_tl_teams++] =
                     team->team_create_req->descs[i].team;
@@ -7,7 +7,7 @@
 #include "allreduce.h"
 #include "../cl_hier_coll.h"
 
-#define MAX_AR_RAB_TASKS 3
+#define MAX_AR_RAB_TASKS (2 * UCC_CL_HIER_MAX_LEVELS - 1)
 
 static ucc_status_t ucc_cl_hier_allreduce_rab_start(ucc_coll_task_t *task)
 {
@@ -42,8 +42,6 @@ static ucc_status_t
 ucc_cl_hier_allreduce_rab_frag_setup(ucc_schedule_pipelined_t *schedule_p,
                                      ucc_schedule_t *frag, int frag_num)
 {
-    ucc_cl_hier_team_t *cl_team =
-        ucc_derived_of(schedule_p->super.super.team, ucc_cl_hier_team_t);
     ucc_coll_args_t *args    = &schedule_p->super.super.bargs.args;
     size_t           dt_size = ucc_dt_size(args->dst.info.datatype);
     int              n_frags = schedule_p->super.n_tasks;
@@ -63,9 +61,9 @@ ucc_cl_hier_allreduce_rab_frag_setup(ucc_schedule_pipelined_t *schedule_p,
         task->bargs.args.dst.info.count  = frag_count;
         task->bargs.args.dst.info.buffer =
             PTR_OFFSET(args->dst.info.buffer, frag_offset * dt_size);
-        if ((task->bargs.args.coll_type == UCC_COLL_TYPE_BCAST) ||
-            (task->bargs.args.coll_type == UCC_COLL_TYPE_REDUCE && inplace &&
-             (SBGP_RANK(cl_team, NODE) != args->root))) {
+        /* only the first task reads user src, others work on partial
+           result in dst */
+        if (i > 0 || inplace) {
             task->bargs.args.src.info.buffer =
                 PTR_OFFSET(args->dst.info.buffer, frag_offset * dt_size);
         } else {
@@ -86,7 +84,7 @@ ucc_cl_hier_allreduce_rab_init_schedule(ucc_base_coll_args_t *coll_args,
     ucc_schedule_t      *schedule;
     ucc_status_t         status;
     ucc_base_coll_args_t args;
-    int                  n_tasks, i;
+    int                  n_tasks, i, l, top;
 
     schedule = &ucc_cl_hier_get_schedule(cl_team)->super.super;
     if (ucc_unlikely(!schedule)) {
@@ -103,48 +101,45 @@ ucc_cl_hier_allreduce_rab_init_schedule(ucc_base_coll_args_t *coll_args,
                                                      n_frags, 0);
         args.mask           |= UCC_BASE_CARGS_MAX_FRAG_COUNT;
     }
-    ucc_assert(SBGP_ENABLED(cl_team, NODE) ||
-               SBGP_ENABLED(cl_team, NODE_LEADERS));
-
-    if (SBGP_ENABLED(cl_team, NODE)) {
-        ucc_assert(n_tasks == 0);
-        if (cl_team->top_sbgp == UCC_HIER_SBGP_NODE) {
+    /* reduce up to the top level, allreduce at the top level, then
+       bcast down in reverse order. Root 0 of each level is the leader
+       that participates in the level above. */
+    top = cl_team->n_levels - 1;
+    for (l = 0; l <= top; l++) {
+        if (!LEVEL_ENABLED(cl_team, l)) {
+            continue;
+        }
+        if (l == top) {
             args.args.coll_type = UCC_COLL_TYPE_ALLREDUCE;
         } else {
             args.args.coll_type = UCC_COLL_TYPE_REDUCE;
             if (UCC_IS_INPLACE(args.args) &&
-                (SBGP_RANK(cl_team, NODE) != args.args.root)) {
+                (cl_team->sbgps[cl_team->levels[l]].sbgp->group_rank !=
+                 args.args.root)) {
                 args.args.src.info = args.args.dst.info;
             }
         }
-        UCC_CHECK_GOTO(
-            ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[n_tasks]),
-            out, status);
+        UCC_CHECK_GOTO(ucc_coll_init(LEVEL_SCORE_MAP(cl_team, l), &args,
+                                     &tasks[n_tasks]),
+                       out, status);
         n_tasks++;
         args.args.mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
         args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
     }
 
-    if (SBGP_ENABLED(cl_team, NODE_LEADERS)) {
-        ucc_assert(cl_team->top_sbgp == UCC_HIER_SBGP_NODE_LEADERS);
-        args.args.coll_type = UCC_COLL_TYPE_ALLREDUCE;
-        UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NODE_LEADERS), &args,
+    /* For bcast src should point to origin dst of allreduce */
+    args.args.src.info  = args.args.dst.info;
+    args.args.coll_type = UCC_COLL_TYPE_BCAST;
+    for (l = top - 1; l >= 0; l--) {
+        if (!LEVEL_ENABLED(cl_team, l)) {
+            continue;
+        }
+        UCC_CHECK_GOTO(ucc_coll_init(LEVEL_SCORE_MAP(cl_team, l), &args,
                                      &tasks[n_tasks]),
                        out, status);
         n_tasks++;
     }
-
-
-    if (SBGP_ENABLED(cl_team, NODE) &&
-        cl_team->top_sbgp != UCC_HIER_SBGP_NODE) {
-        /* For bcast src should point to origin dst of allreduce */
-        args.args.src.info  = args.args.dst.info;
-        args.args.coll_type = UCC_COLL_TYPE_BCAST;
-        UCC_CHECK_GOTO(
-            ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[n_tasks]),
-            out, status);
-        n_tasks++;
-    }
+    ucc_assert(n_tasks > 0);
 
     /* subscription logic is different depending on top level schedule type
      * being used
@@ -230,7 +225,8 @@ UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_allreduce_rab_init,
     int                       n_frags, pipeline_depth;
     ucc_status_t              status;
 
-    if (coll_args->args.op == UCC_OP_AVG) {
+    if (coll_args->args.op == UCC_OP_AVG ||
+        UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
         return UCC_ERR_NOT_SUPPORTED;
     }
     ucc_pipeline_nfrags_pdepth(&cfg->allreduce_rab_pipeline,
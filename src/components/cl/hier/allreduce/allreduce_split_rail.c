@@ -288,7 +288,8 @@ UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_allreduce_split_rail_init,
     int                 n_frags, pipeline_depth;
     ucc_status_t status;
 
-    if (coll_args->args.op == UCC_OP_AVG) {
+    if (coll_args->args.op == UCC_OP_AVG ||
+        UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
         return UCC_ERR_NOT_SUPPORTED;
     }
 
@@ -14,6 +14,11 @@ ucc_base_coll_alg_info_t
              .name = "node_split",
              .desc = "splitting alltoall into two concurrent a2av calls"
                      " within the node and outside of it"},
+        [UCC_CL_HIER_ALLTOALL_ALG_NODE_AGGR] =
+            {.id   = UCC_CL_HIER_ALLTOALL_ALG_NODE_AGGR,
+             .name = "node_aggr",
+             .desc = "alltoall aggregating data per destination node within"
+                     " NODE sbgp followed by alltoall over NET sbgp"},
         [UCC_CL_HIER_ALLTOALL_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
 
@@ -36,6 +41,12 @@ UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_alltoall_init,
         return UCC_ERR_NOT_SUPPORTED;
     }
 
+    if (UCC_DT_IS_NONCONTIG(coll_args->args.src.info.datatype) ||
+        UCC_DT_IS_NONCONTIG(coll_args->args.dst.info.datatype)) {
+        cl_debug(team->context->lib, "generic datatype is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
     if (!SBGP_ENABLED(cl_team, FULL)) {
         cl_debug(team->context->lib, "alltoall requires FULL sbgps");
         return UCC_ERR_NOT_SUPPORTED;
@@ -0,0 +1,335 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "alltoall.h"
+#include "../cl_hier_coll.h"
+#include "core/ucc_team.h"
+
+/* Node aggregated alltoall.
+
+   Team of N nodes with P procs each is viewed as a N x P grid: rank (n, l)
+   is the l-th proc (in team order) of node n, where node index n is the
+   position of that node in the NET sbgp. The NET sbgp of rank (n, l) is
+   the "rail" {(0, l), .., (N - 1, l)}.
+
+   1. pack:   reorder src blocks by destination local index l
+   2. NODE:   alltoall of N blocks per peer, after that rank (n, l) holds
+              all the data of its node destined to rail l
+   3. pack:   reorder received blocks by destination node
+   4. NET:    alltoall of P blocks per peer over the rail
+   5. unpack: scatter received blocks to dst in team rank order
+
+   Every rank sends N - 1 network messages of P blocks each instead of
+   N * P - P messages of a single block. */
+
+#define NODE_AGGR_GRID(_s) ((_s)->alltoall_node_aggr.grid)
+#define NODE_AGGR_BUF(_s, _i)                                                  \
+    PTR_OFFSET((_s)->scratch->addr,                                            \
+               (_i) * (_s)->alltoall_node_aggr.n_nodes *                       \
+                   (_s)->alltoall_node_aggr.ppn *                              \
+                   (_s)->alltoall_node_aggr.block)
+
+static inline ucc_cl_hier_schedule_t *
+node_aggr_schedule(ucc_coll_task_t *task)
+{
+    return ucc_derived_of(task->schedule, ucc_cl_hier_schedule_t);
+}
+
+static ucc_status_t ucc_cl_hier_alltoall_node_aggr_pack_node(
+    ucc_coll_task_t *task)
+{
+    ucc_cl_hier_schedule_t *schedule = node_aggr_schedule(task);
+    ucc_coll_args_t  *args  = &schedule->super.super.super.bargs.args;
+    ucc_rank_t       *grid  = NODE_AGGR_GRID(schedule);
+    ucc_rank_t        nn    = schedule->alltoall_node_aggr.n_nodes;
+    ucc_rank_t        ppn   = schedule->alltoall_node_aggr.ppn;
+    size_t            block = schedule->alltoall_node_aggr.block;
+    void             *dst   = NODE_AGGR_BUF(schedule, 0);
+    ucc_rank_t        n, l;
+
+    for (l = 0; l < ppn; l++) {
+        for (n = 0; n < nn; n++) {
+            memcpy(PTR_OFFSET(dst, (l * nn + n) * block),
+                   PTR_OFFSET(args->src.info.buffer, grid[n * ppn + l] * block),
+                   block);
+        }
+    }
+    task->status = UCC_OK;
+    return ucc_task_complete(task);
+}
+
+static ucc_status_t ucc_cl_hier_alltoall_node_aggr_pack_net(
+    ucc_coll_task_t *task)
+{
+    ucc_cl_hier_schedule_t *schedule = node_aggr_schedule(task);
+    ucc_rank_t        nn    = schedule->alltoall_node_aggr.n_nodes;
+    ucc_rank_t        ppn   = schedule->alltoall_node_aggr.ppn;
+    size_t            block = schedule->alltoall_node_aggr.block;
+    void             *src   = NODE_AGGR_BUF(schedule, 1);
+    void             *dst   = NODE_AGGR_BUF(schedule, 0);
+    ucc_rank_t        n, l;
+
+    for (n = 0; n < nn; n++) {
+        for (l = 0; l < ppn; l++) {
+            memcpy(PTR_OFFSET(dst, (n * ppn + l) * block),
+                   PTR_OFFSET(src, (l * nn + n) * block), block);
+        }
+    }
+    task->status = UCC_OK;
+    return ucc_task_complete(task);
+}
+
+static ucc_status_t ucc_cl_hier_alltoall_node_aggr_unpack(
+    ucc_coll_task_t *task)
+{
+    ucc_cl_hier_schedule_t *schedule = node_aggr_schedule(task);
+    ucc_coll_args_t  *args  = &schedule->super.super.super.bargs.args;
+    ucc_rank_t       *grid  = NODE_AGGR_GRID(schedule);
+    ucc_rank_t        size  = schedule->alltoall_node_aggr.n_nodes *
+                              schedule->alltoall_node_aggr.ppn;
+    size_t            block = schedule->alltoall_node_aggr.block;
+    void             *src   = NODE_AGGR_BUF(schedule, 1);
+    ucc_rank_t        i;
+
+    for (i = 0; i < size; i++) {
+        memcpy(PTR_OFFSET(args->dst.info.buffer, grid[i] * block),
+               PTR_OFFSET(src, i * block), block);
+    }
+    task->status = UCC_OK;
+    return ucc_task_complete(task);
+}
+
+static ucc_status_t ucc_cl_hier_alltoall_node_aggr_start(ucc_coll_task_t *task)
+{
+    UCC_CL_HIER_PROFILE_REQUEST_EVENT(task, "cl_hier_alltoall_node_aggr_start",
+                                      0);
+    return ucc_schedule_start(task);
+}
+
+static ucc_status_t
+ucc_cl_hier_alltoall_node_aggr_finalize(ucc_coll_task_t *task)
+{
+    ucc_cl_hier_schedule_t *schedule =
+        ucc_derived_of(task, ucc_cl_hier_schedule_t);
+    ucc_status_t status;
+
+    UCC_CL_HIER_PROFILE_REQUEST_EVENT(task,
+                                      "cl_hier_alltoall_node_aggr_finalize", 0);
+    ucc_mc_free(schedule->scratch);
+    status = ucc_schedule_finalize(task);
+    ucc_cl_hier_put_schedule(&schedule->super.super);
+    return status;
+}
+
+static ucc_status_t
+ucc_cl_hier_alltoall_node_aggr_local_task(ucc_cl_hier_team_t   *cl_team,
+                                          ucc_base_coll_args_t *coll_args,
+                                          ucc_coll_post_fn_t    post,
+                                          ucc_coll_task_t     **task_p)
+{
+    ucc_coll_task_t *task = ucc_mpool_get(&UCC_CL_HIER_TEAM_CTX(cl_team)->
+                                          sched_mp);
+    ucc_status_t     status;
+
+    if (ucc_unlikely(!task)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    status = ucc_coll_task_init(task, coll_args, &cl_team->super.super);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_mpool_put(task);
+        return status;
+    }
+    task->post = post;
+    *task_p    = task;
+    return UCC_OK;
+}
+
+/* Fills the N x P grid of team ranks, see the description above */
+static void ucc_cl_hier_alltoall_node_aggr_grid(ucc_cl_hier_team_t *cl_team,
+                                                ucc_rank_t *grid,
+                                                ucc_rank_t *node_idx,
+                                                ucc_rank_t *local)
+{
+    ucc_topo_t       *topo  = cl_team->super.super.params.team->topo;
+    ucc_proc_info_t  *procs = topo->topo->procs;
+    ucc_sbgp_t       *net   = cl_team->sbgps[UCC_HIER_SBGP_NET].sbgp;
+    ucc_rank_t        ppn   = cl_team->sbgps[UCC_HIER_SBGP_NODE].sbgp->
+                              group_size;
+    ucc_rank_t        tsize = UCC_CL_TEAM_SIZE(cl_team);
+    ucc_rank_t        i, n, ctx_rank;
+
+    for (i = 0; i < net->group_size; i++) {
+        ctx_rank = ucc_ep_map_eval(topo->set.map,
+                                   ucc_ep_map_eval(net->map, i));
+        node_idx[procs[ctx_rank].host_id] = i;
+        local[i]                          = 0;
+    }
+    for (i = 0; i < tsize; i++) {
+        ctx_rank = ucc_ep_map_eval(topo->set.map, i);
+        n        = node_idx[procs[ctx_rank].host_id];
+        grid[n * ppn + local[n]++] = i;
+    }
+}
+
+UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_alltoall_node_aggr_init,
+                         (coll_args, team, task),
+                         ucc_base_coll_args_t *coll_args, ucc_base_team_t *team,
+                         ucc_coll_task_t **task)
+{
+    ucc_cl_hier_team_t     *cl_team  = ucc_derived_of(team, ucc_cl_hier_team_t);
+    ucc_rank_t              tsize    = UCC_CL_TEAM_SIZE(cl_team);
+    ucc_coll_task_t        *tasks[5] = {NULL};
+    ucc_topo_t             *topo;
+    ucc_cl_hier_schedule_t *cl_schedule;
+    ucc_schedule_t         *schedule;
+    ucc_base_coll_args_t    args;
+    ucc_status_t            status;
+    ucc_rank_t              nn, ppn, *node_idx;
+    size_t                  block, grid_offset;
+    int                     i;
+
+    if (UCC_IS_INPLACE(coll_args->args)) {
+        cl_debug(team->context->lib, "inplace alltoall is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    if (UCC_DT_IS_NONCONTIG(coll_args->args.src.info.datatype) ||
+        UCC_DT_IS_NONCONTIG(coll_args->args.dst.info.datatype)) {
+        cl_debug(team->context->lib, "generic datatype is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    if (coll_args->args.mask & UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER) {
+        cl_debug(team->context->lib, "onesided alltoall is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    if (coll_args->args.src.info.mem_type != UCC_MEMORY_TYPE_HOST ||
+        coll_args->args.dst.info.mem_type != UCC_MEMORY_TYPE_HOST) {
+        cl_debug(team->context->lib,
+                 "node_aggr alltoall supports host memory only");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    if (!SBGP_ENABLED(cl_team, NODE) || !SBGP_ENABLED(cl_team, NET)) {
+        cl_debug(team->context->lib,
+                 "node_aggr alltoall requires NODE and NET sbgps");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    topo = team->params.team->topo;
+    if (!ucc_topo_isoppn(topo)) {
+        cl_debug(team->context->lib,
+                 "node_aggr alltoall requires same ppn on all nodes");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    nn    = cl_team->sbgps[UCC_HIER_SBGP_NET].sbgp->group_size;
+    ppn   = cl_team->sbgps[UCC_HIER_SBGP_NODE].sbgp->group_size;
+    block = (coll_args->args.src.info.count / tsize) *
+            ucc_dt_size(coll_args->args.src.info.datatype);
+    ucc_assert(nn * ppn == tsize);
+
+    cl_schedule = ucc_cl_hier_get_schedule(cl_team);
+    if (ucc_unlikely(!cl_schedule)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    schedule = &cl_schedule->super.super;
+    memcpy(&args, coll_args, sizeof(args));
+    UCC_CHECK_GOTO(ucc_schedule_init(schedule, &args, team), err_sched,
+                   status);
+
+    /* two staging buffers followed by the rank grid */
+    grid_offset = ucc_align_up_pow2(2 * tsize * block, sizeof(ucc_rank_t));
+    status      = ucc_mc_alloc(&cl_schedule->scratch,
+                               grid_offset + tsize * sizeof(ucc_rank_t),
+                               UCC_MEMORY_TYPE_HOST);
+    if (ucc_unlikely(UCC_OK != status)) {
+        cl_error(team->context->lib,
+                 "failed to allocate %zd bytes for scratch",
+                 grid_offset + tsize * sizeof(ucc_rank_t));
+        goto err_sched;
+    }
+
+    node_idx = ucc_malloc(sizeof(ucc_rank_t) * (topo->topo->nnodes + nn),
+                          "node_idx");
+    if (ucc_unlikely(!node_idx)) {
+        cl_error(team->context->lib,
+                 "failed to allocate %zd bytes for node index",
+                 sizeof(ucc_rank_t) * (topo->topo->nnodes + nn));
+        status = UCC_ERR_NO_MEMORY;
+        goto err_scratch;
+    }
+    cl_schedule->alltoall_node_aggr.grid    =
+        PTR_OFFSET(cl_schedule->scratch->addr, grid_offset);
+    cl_schedule->alltoall_node_aggr.n_nodes = nn;
+    cl_schedule->alltoall_node_aggr.ppn     = ppn;
+    cl_schedule->alltoall_node_aggr.block   = block;
+    ucc_cl_hier_alltoall_node_aggr_grid(cl_team,
+                                        cl_schedule->alltoall_node_aggr.grid,
+                                        node_idx,
+                                        node_idx + topo->topo->nnodes);
+    ucc_free(node_idx);
+
+    UCC_CHECK_GOTO(ucc_cl_hier_alltoall_node_aggr_local_task(
+                       cl_team, coll_args,
+                       ucc_cl_hier_alltoall_node_aggr_pack_node, &tasks[0]),
+                   err_tasks, status);
+
+    /* both sbgp alltoalls exchange the whole staging buffer */
+    args.args.src.info.buffer   = NODE_AGGR_BUF(cl_schedule, 0);
+    args.args.dst.info.buffer   = NODE_AGGR_BUF(cl_schedule, 1);
+    args.args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    args.args.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    args.args.dst.info.datatype = args.args.src.info.datatype;
+    args.args.dst.info.count    = args.args.src.info.count;
+    UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[1]),
+                   err_tasks, status);
+
+    UCC_CHECK_GOTO(ucc_cl_hier_alltoall_node_aggr_local_task(
+                       cl_team, coll_args,
+                       ucc_cl_hier_alltoall_node_aggr_pack_net, &tasks[2]),
+                   err_tasks, status);
+
+    UCC_CHECK_GOTO(ucc_coll_init(SCORE_MAP(cl_team, NET), &args, &tasks[3]),
+                   err_tasks, status);
+
+    UCC_CHECK_GOTO(ucc_cl_hier_alltoall_node_aggr_local_task(
+                       cl_team, coll_args,
+                       ucc_cl_hier_alltoall_node_aggr_unpack, &tasks[4]),
+                   err_tasks, status);
+
+    UCC_CHECK_GOTO(ucc_task_subscribe_dep(&schedule->super, tasks[0],
+                                          UCC_EVENT_SCHEDULE_STARTED),
+                   err_tasks, status);
+    UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[0]), err_tasks,
+                   status);
+    for (i = 1; i < 5; i++) {
+        UCC_CHECK_GOTO(ucc_task_subscribe_dep(tasks[i - 1], tasks[i],
+                                              UCC_EVENT_COMPLETED),
+                       err_tasks, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, tasks[i]), err_tasks,
+                       status);
+    }
+
+    schedule->super.post     = ucc_cl_hier_alltoall_node_aggr_start;
+    schedule->super.progress = NULL;
+    schedule->super.finalize = ucc_cl_hier_alltoall_node_aggr_finalize;
+    *task                    = &schedule->super;
+    return UCC_OK;
+
+err_tasks:
+    for (i = 0; i < 5; i++) {
+        if (tasks[i]) {
+            tasks[i]->finalize(tasks[i]);
+        }
+    }
+err_scratch:
+    ucc_mc_free(cl_schedule->scratch);
+err_sched:
+    ucc_cl_hier_put_schedule(schedule);
+    return status;
+}
@@ -144,6 +144,12 @@ UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_alltoallv_init,
         return UCC_ERR_NOT_SUPPORTED;
     }
 
+    if (UCC_DT_IS_NONCONTIG(coll_args->args.src.info_v.datatype) ||
+        UCC_DT_IS_NONCONTIG(coll_args->args.dst.info_v.datatype)) {
+        cl_debug(team->context->lib, "generic datatype is not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
     if (coll_args->args.mask & UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER) {
         cl_debug(team->context->lib, "onesided alltoallv is not supported");
         return UCC_ERR_NOT_SUPPORTED;
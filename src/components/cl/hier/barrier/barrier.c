@@ -39,6 +39,10 @@ UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_barrier_init,
     ucc_base_coll_args_t args;
     int                  n_tasks, i;
 
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        /* node and leaders sbgps cover the whole team */
+        return UCC_ERR_NOT_SUPPORTED;
+    }
     schedule = &ucc_cl_hier_get_schedule(cl_team)->super.super;
     if (ucc_unlikely(!schedule)) {
         return UCC_ERR_NO_MEMORY;
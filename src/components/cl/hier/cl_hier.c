@@ -18,6 +18,13 @@ ucc_status_t ucc_cl_hier_get_lib_properties(ucc_base_lib_properties_t *prop);
 ucc_status_t ucc_cl_hier_get_context_attr(const ucc_base_context_t *context,
                                           ucc_base_ctx_attr_t      *base_attr);
 
+static const char *ucc_cl_hier_node_levels[] = {
+    [UCC_CL_HIER_NODE_LEVEL_NONE]   = "none",
+    [UCC_CL_HIER_NODE_LEVEL_SOCKET] = "socket",
+    [UCC_CL_HIER_NODE_LEVEL_NUMA]   = "numa",
+    [UCC_CL_HIER_NODE_LEVEL_LAST]   = NULL
+};
+
 static ucc_config_field_t ucc_cl_hier_lib_config_table[] = {
     {"", "", NULL, ucc_offsetof(ucc_cl_hier_lib_config_t, super),
      UCC_CONFIG_TYPE_TABLE(ucc_cl_lib_config_table)},
@@ -51,6 +58,46 @@ static ucc_config_field_t ucc_cl_hier_lib_config_table[] = {
      ucc_offsetof(ucc_cl_hier_lib_config_t, sbgp_tls[UCC_HIER_SBGP_FULL]),
      UCC_CONFIG_TYPE_ALLOW_LIST},
 
+    {"SOCKET_SBGP_TLS", "ucp",
+     "TLS to be used for SOCKET subgroup.\n"
+     "SOCKET subgroup contains processes of a team located on the same socket",
+     ucc_offsetof(ucc_cl_hier_lib_config_t, sbgp_tls[UCC_HIER_SBGP_SOCKET]),
+     UCC_CONFIG_TYPE_ALLOW_LIST},
+
+    {"SOCKET_LEADERS_SBGP_TLS", "ucp",
+     "TLS to be used for SOCKET_LEADERS subgroup.\n"
+     "SOCKET_LEADERS subgroup contains processes of a node with local socket "
+     "rank equal 0",
+     ucc_offsetof(ucc_cl_hier_lib_config_t,
+                  sbgp_tls[UCC_HIER_SBGP_SOCKET_LEADERS]),
+     UCC_CONFIG_TYPE_ALLOW_LIST},
+
+    {"NUMA_SBGP_TLS", "ucp",
+     "TLS to be used for NUMA subgroup.\n"
+     "NUMA subgroup contains processes of a team located on the same NUMA "
+     "domain",
+     ucc_offsetof(ucc_cl_hier_lib_config_t, sbgp_tls[UCC_HIER_SBGP_NUMA]),
+     UCC_CONFIG_TYPE_ALLOW_LIST},
+
+    {"NUMA_LEADERS_SBGP_TLS", "ucp",
+     "TLS to be used for NUMA_LEADERS subgroup.\n"
+     "NUMA_LEADERS subgroup contains processes of a node with local NUMA "
+     "rank equal 0",
+     ucc_offsetof(ucc_cl_hier_lib_config_t,
+                  sbgp_tls[UCC_HIER_SBGP_NUMA_LEADERS]),
+     UCC_CONFIG_TYPE_ALLOW_LIST},
+
+    {"INTRA_NODE_LEVEL", "none",
+     "Additional hierarchy level inside the node used by rab allreduce, "
+     "2step bcast and 2step reduce.\n"
+     "none   - node is a single level\n"
+     "socket - reduce/bcast within a socket, then within socket leaders\n"
+     "numa   - reduce/bcast within a NUMA domain, then within NUMA leaders\n"
+     "Requires processes to be bound to a socket/NUMA domain, otherwise "
+     "falls back to none",
+     ucc_offsetof(ucc_cl_hier_lib_config_t, node_level),
+     UCC_CONFIG_TYPE_ENUM(ucc_cl_hier_node_levels)},
+
     {"ALLTOALLV_SPLIT_NODE_THRESH", "0",
      "Messages larger than that threshold will be sent via node sbgp tl",
      ucc_offsetof(ucc_cl_hier_lib_config_t, a2av_node_thresh),
@@ -40,20 +40,33 @@ typedef enum {
     UCC_HIER_SBGP_NODE_LEADERS,
     UCC_HIER_SBGP_NET,
     UCC_HIER_SBGP_FULL,
+    UCC_HIER_SBGP_SOCKET,
+    UCC_HIER_SBGP_SOCKET_LEADERS,
+    UCC_HIER_SBGP_NUMA,
+    UCC_HIER_SBGP_NUMA_LEADERS,
     UCC_HIER_SBGP_LAST,
 } ucc_hier_sbgp_type_t;
+
+/* Optional intra node level inserted below NODE_LEADERS */
+typedef enum {
+    UCC_CL_HIER_NODE_LEVEL_NONE,
+    UCC_CL_HIER_NODE_LEVEL_SOCKET,
+    UCC_CL_HIER_NODE_LEVEL_NUMA,
+    UCC_CL_HIER_NODE_LEVEL_LAST
+} ucc_cl_hier_node_level_t;
 //DO we need it? Potential use case: different hier sbgps over same sbgp
 
 typedef struct ucc_cl_hier_lib_config {
-    ucc_cl_lib_config_t super;
+    ucc_cl_lib_config_t      super;
     /* List of TLs corresponding to the sbgp team,
        which are selected based on the TL scores */
-    ucc_config_names_list_t sbgp_tls[UCC_HIER_SBGP_LAST];
-    size_t                  a2av_node_thresh;
-    ucc_pipeline_params_t   allreduce_split_rail_pipeline;
-    ucc_pipeline_params_t   allreduce_rab_pipeline;
-    ucc_pipeline_params_t   bcast_2step_pipeline;
-    ucc_pipeline_params_t   reduce_2step_pipeline;
+    ucc_config_names_list_t  sbgp_tls[UCC_HIER_SBGP_LAST];
+    size_t                   a2av_node_thresh;
+    ucc_cl_hier_node_level_t node_level;
+    ucc_pipeline_params_t    allreduce_split_rail_pipeline;
+    ucc_pipeline_params_t    allreduce_rab_pipeline;
+    ucc_pipeline_params_t    bcast_2step_pipeline;
+    ucc_pipeline_params_t    reduce_2step_pipeline;
 } ucc_cl_hier_lib_config_t;
 
 typedef struct ucc_cl_hier_context_config {
@@ -83,6 +96,8 @@ typedef enum {
 
 #define CL_HIER_MAX_SBGP_TLS 4
 
+#define UCC_CL_HIER_MAX_LEVELS 3
+
 /* This struct represents a unit of hierarchy: a combination of
    (i) subgroup (sbgp) of processes from the original ucc_team and
    (ii) communication TL backend initialized for that subgroup.
@@ -106,6 +121,10 @@ typedef struct ucc_cl_hier_team {
     ucc_coll_score_t        *score;
     ucc_hier_sbgp_t          sbgps[UCC_HIER_SBGP_LAST];
     ucc_hier_sbgp_type_t     top_sbgp;
+    /* Hierarchy levels used by rab allreduce, 2step bcast and reduce,
+       bottom up: NODE or SOCKET/NUMA with its leaders, then NODE_LEADERS */
+    ucc_hier_sbgp_type_t     levels[UCC_CL_HIER_MAX_LEVELS];
+    int                      n_levels;
 } ucc_cl_hier_team_t;
 UCC_CLASS_DECLARE(ucc_cl_hier_team_t, ucc_base_context_t *,
                   const ucc_base_team_params_t *);
@@ -141,4 +160,9 @@ ucc_status_t ucc_cl_hier_coll_init(ucc_base_coll_args_t *coll_args,
 
 #define SCORE_MAP(_team, _sbgp) (_team)->sbgps[UCC_HIER_SBGP_##_sbgp].score_map
 
+#define LEVEL_ENABLED(_team, _l)                                               \
+    ((_team)->sbgps[(_team)->levels[_l]].state == UCC_HIER_SBGP_ENABLED)
+
+#define LEVEL_SCORE_MAP(_team, _l) (_team)->sbgps[(_team)->levels[_l]].score_map
+
 #endif
@@ -99,6 +99,9 @@ ucc_status_t ucc_cl_hier_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_CL_HIER_ALLTOALL_ALG_NODE_SPLIT:
             *init = ucc_cl_hier_alltoall_init;
             break;
+        case UCC_CL_HIER_ALLTOALL_ALG_NODE_AGGR:
+            *init = ucc_cl_hier_alltoall_node_aggr_init;
+            break;
         default:
             status = UCC_ERR_INVALID_PARAM;
             break;
@@ -9,6 +9,8 @@
 #include "cl_hier.h"
 #include "schedule/ucc_schedule_pipelined.h"
 #include "components/mc/ucc_mc.h"
+#include "core/ucc_team.h"
+#include "core/ucc_dt.h"
 #include "allreduce/allreduce.h"
 #include "alltoallv/alltoallv.h"
 #include "alltoall/alltoall.h"
@@ -28,6 +30,12 @@ typedef struct ucc_cl_hier_schedule_t {
         struct {
             uint64_t *counts;
         } allreduce_split_rail;
+        struct {
+            ucc_rank_t *grid;
+            ucc_rank_t  n_nodes;
+            ucc_rank_t  ppn;
+            size_t      block;
+        } alltoall_node_aggr;
     };
 } ucc_cl_hier_schedule_t;
 
@@ -48,6 +56,49 @@ static inline void ucc_cl_hier_put_schedule(ucc_schedule_t *schedule)
     ucc_mpool_put(schedule);
 }
 
+/* Rank of the member of level sbgp that represents team rank "root" on
+   that level: root itself, or the leader of the root's socket/numa or node.
+   Falls back to 0, the local leader, if root is not below that sbgp. */
+static inline ucc_rank_t ucc_cl_hier_level_root(ucc_cl_hier_team_t *team,
+                                                int level, ucc_rank_t root)
+{
+    ucc_topo_t      *topo = team->super.super.params.team->topo;
+    ucc_sbgp_t      *sbgp = team->sbgps[team->levels[level]].sbgp;
+    ucc_proc_info_t *pr   = &topo->topo->procs[ucc_ep_map_eval(topo->set.map,
+                                                               root)];
+    ucc_proc_info_t *p;
+    ucc_rank_t       i, r;
+
+    for (i = 0; i < sbgp->group_size; i++) {
+        r = ucc_ep_map_eval(sbgp->map, i);
+        p = &topo->topo->procs[ucc_ep_map_eval(topo->set.map, r)];
+        switch (sbgp->type) {
+        case UCC_SBGP_NODE_LEADERS:
+            if (p->host_hash == pr->host_hash) {
+                return i;
+            }
+            break;
+        case UCC_SBGP_SOCKET_LEADERS:
+            if (p->host_hash == pr->host_hash &&
+                p->socket_id == pr->socket_id) {
+                return i;
+            }
+            break;
+        case UCC_SBGP_NUMA_LEADERS:
+            if (p->host_hash == pr->host_hash && p->numa_id == pr->numa_id) {
+                return i;
+            }
+            break;
+        default:
+            if (r == root) {
+                return i;
+            }
+            break;
+        }
+    }
+    return 0;
+}
+
 ucc_status_t ucc_cl_hier_alg_id_to_init(int alg_id, const char *alg_id_str,
                                         ucc_coll_type_t   coll_type,
                                         ucc_memory_type_t mem_type, //NOLINT
@@ -19,7 +19,7 @@ UCC_CLASS_INIT_FUNC(ucc_cl_hier_context_t,
                                                    ucc_cl_hier_lib_t);
     ucc_config_names_array_t *tls = &lib->tls.array;
     ucc_status_t              status;
-    int                       i;
+    int                       i, n_lazy_tls;
 
     UCC_CLASS_CALL_SUPER_INIT(ucc_cl_context_t, cl_config,
                               params->context);
@@ -35,7 +35,13 @@ UCC_CLASS_INIT_FUNC(ucc_cl_hier_context_t,
         return UCC_ERR_NO_MEMORY;
     }
     self->super.n_tl_ctxs = 0;
+    n_lazy_tls            = 0;
     for (i = 0; i < tls->count; i++) {
+        if (ucc_context_tl_is_lazy(params->context, tls->names[i])) {
+            /* created by the first sbgp team that uses it */
+            n_lazy_tls++;
+            continue;
+        }
         status = ucc_tl_context_get(params->context, tls->names[i],
                                     &self->super.tl_ctxs[self->super.n_tl_ctxs]);
         if (UCC_OK != status) {
@@ -46,7 +52,7 @@ UCC_CLASS_INIT_FUNC(ucc_cl_hier_context_t,
         }
     }
 
-    if (0 == self->super.n_tl_ctxs) {
+    if (0 == self->super.n_tl_ctxs && 0 == n_lazy_tls) {
         cl_error(cl_config->cl_lib, "no TL contexts are available");
         status = UCC_ERR_NOT_FOUND;
         goto out;
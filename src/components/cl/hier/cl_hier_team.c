@@ -24,10 +24,43 @@
 
 static void ucc_cl_hier_enable_sbgps(ucc_cl_hier_team_t *team)
 {
+    ucc_cl_hier_lib_t *lib = UCC_CL_HIER_TEAM_LIB(team);
+
     SBGP_SET(team, NET, ENABLED);
     SBGP_SET(team, NODE, ENABLED);
     SBGP_SET(team, NODE_LEADERS, ENABLED);
     SBGP_SET(team, FULL, ENABLED); /* TODO: parse score if a2av is enabled */
+    switch (lib->cfg.node_level) {
+    case UCC_CL_HIER_NODE_LEVEL_SOCKET:
+        SBGP_SET(team, SOCKET, ENABLED);
+        SBGP_SET(team, SOCKET_LEADERS, ENABLED);
+        break;
+    case UCC_CL_HIER_NODE_LEVEL_NUMA:
+        SBGP_SET(team, NUMA, ENABLED);
+        SBGP_SET(team, NUMA_LEADERS, ENABLED);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Socket/numa level is used only if the node spans several of them:
+   existence of leaders sbgp is the same for all the ranks of the node */
+static void ucc_cl_hier_set_levels(ucc_cl_hier_team_t *team)
+{
+    team->n_levels = 0;
+    if (SBGP_EXISTS(team, SOCKET_LEADERS)) {
+        team->levels[team->n_levels++] = UCC_HIER_SBGP_SOCKET;
+        team->levels[team->n_levels++] = UCC_HIER_SBGP_SOCKET_LEADERS;
+    } else if (SBGP_EXISTS(team, NUMA_LEADERS)) {
+        team->levels[team->n_levels++] = UCC_HIER_SBGP_NUMA;
+        team->levels[team->n_levels++] = UCC_HIER_SBGP_NUMA_LEADERS;
+    } else {
+        team->levels[team->n_levels++] = UCC_HIER_SBGP_NODE;
+    }
+    if (SBGP_EXISTS(team, NODE_LEADERS)) {
+        team->levels[team->n_levels++] = UCC_HIER_SBGP_NODE_LEADERS;
+    }
 }
 
 UCC_CLASS_INIT_FUNC(ucc_cl_hier_team_t, ucc_base_context_t *cl_context,
@@ -220,9 +253,9 @@ ucc_status_t ucc_cl_hier_team_destroy(ucc_base_team_t *cl_team)
                 }
                 for (j = 0; j < hs->n_tls; j++) {
                     if (hs->tl_teams[j]) {
-                        ucc_tl_context_put(hs->tl_ctxs[j]);
                         d = &team->team_create_req->descs[
                             team->team_create_req->n_teams++];
+                        d->ctx              = hs->tl_ctxs[j];
                         d->team             = hs->tl_teams[j];
                         d->param.params.oob = d->team->super.params.params.oob;
                     }
@@ -237,6 +270,9 @@ ucc_status_t ucc_cl_hier_team_destroy(ucc_base_team_t *cl_team)
     for (i = 0; i < team->team_create_req->n_teams; i++) {
         ucc_internal_oob_finalize(&team->team_create_req->
                                    descs[i].param.params.oob);
+        /* put only after tl team is gone: lazy tl context may be
+           destroyed by the last put */
+        ucc_tl_context_put(team->team_create_req->descs[i].ctx);
         if (team->team_create_req->descs[i].status != UCC_OK) {
             cl_error(ctx->super.super.lib, "tl team destroy failed (%d)",
                      status);
@@ -341,6 +377,7 @@ ucc_status_t ucc_cl_hier_team_create_test(ucc_base_team_t *cl_team)
         ucc_assert(SBGP_EXISTS(team, NODE));
         team->top_sbgp = UCC_HIER_SBGP_NODE;
     }
+    ucc_cl_hier_set_levels(team);
 
     return status;
 }
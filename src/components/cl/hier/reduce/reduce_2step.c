@@ -8,8 +8,6 @@
 #include "core/ucc_team.h"
 #include "../cl_hier_coll.h"
 
-#define MAX_AR_2STEP_TASKS 3
-
 static ucc_status_t ucc_cl_hier_reduce_2step_start(ucc_coll_task_t *task)
 {
     UCC_CL_HIER_PROFILE_REQUEST_EVENT(task, "cl_hier_reduce_2step_start", 0);
@@ -30,68 +28,48 @@ static ucc_status_t ucc_cl_hier_reduce_2step_finalize(ucc_coll_task_t *task)
     return status;
 }
 
-static inline ucc_rank_t
-find_root_net_rank(ucc_host_id_t root_host_id, ucc_cl_hier_team_t *cl_team)
-{
-    ucc_rank_t  net_rank  = UCC_RANK_INVALID;
-    ucc_sbgp_t *sbgp      = cl_team->sbgps[UCC_HIER_SBGP_NODE_LEADERS].sbgp;
-    ucc_team_t *core_team = cl_team->super.super.params.team;
-    ucc_rank_t  i, rank;
-
-    for (i = 0; i < sbgp->group_size; i++) {
-        rank = ucc_ep_map_eval(sbgp->map, i);
-        if (ucc_team_rank_host_id(rank, core_team) == root_host_id) {
-            net_rank = i;
-            break;
-        }
-    }
-    return net_rank;
-}
-
-static inline ucc_rank_t
-find_root_node_rank(ucc_rank_t root, ucc_cl_hier_team_t *cl_team)
-{
-    ucc_rank_t  node_rank  = UCC_RANK_INVALID;
-    ucc_sbgp_t *sbgp       = cl_team->sbgps[UCC_HIER_SBGP_NODE].sbgp;
-    ucc_rank_t  i;
-
-    for (i = 0; i < sbgp->group_size; i++) {
-        if (ucc_ep_map_eval(sbgp->map, i) == root) {
-            node_rank = i;
-            break;
-        }
-    }
-    return node_rank;
-}
-
 static ucc_status_t
 ucc_cl_hier_reduce_2step_init_schedule(ucc_base_coll_args_t *coll_args,
                                        ucc_base_team_t *team,
                                        ucc_schedule_t **sched_p, int n_frags)
 {
     ucc_cl_hier_team_t   *cl_team   = ucc_derived_of(team, ucc_cl_hier_team_t);
-    ucc_team_t           *core_team = team->params.team;
-    ucc_coll_task_t      *tasks[2]  = {NULL, NULL};
+    ucc_coll_task_t      *tasks[UCC_CL_HIER_MAX_LEVELS] = {NULL};
     ucc_rank_t            root      = coll_args->args.root;
     ucc_rank_t            rank      = UCC_TL_TEAM_RANK(cl_team);
     ucc_base_coll_args_t  args      = *coll_args;
     size_t                count     = (rank == root) ?
                                       args.args.dst.info.count :
                                       args.args.src.info.count;
+    ucc_rank_t              level_root[UCC_CL_HIER_MAX_LEVELS];
     ucc_cl_hier_schedule_t *cl_schedule;
     ucc_schedule_t         *schedule;
     ucc_status_t            status;
-    int                     n_tasks, i, first_task, root_on_local_node;
-
-    root_on_local_node = ucc_team_ranks_on_same_node(root, rank, core_team);
-    n_tasks            = 0;
-    first_task         = 0;
+    ucc_coll_buffer_info_t  acc;
+    int                     n_tasks, n_levels, send_level, i, l;
+
+    n_tasks    = 0;
+    n_levels   = 0;
+    send_level = -1;
+    for (l = 0; l < cl_team->n_levels; l++) {
+        if (!LEVEL_ENABLED(cl_team, l)) {
+            continue;
+        }
+        level_root[l] = ucc_cl_hier_level_root(cl_team, l, root);
+        if (cl_team->sbgps[cl_team->levels[l]].sbgp->group_rank !=
+            level_root[l]) {
+            ucc_assert(send_level == -1);
+            send_level = l;
+        }
+        n_levels++;
+    }
+    ucc_assert(n_levels > 0);
 
     if (root != rank) {
         args.args.dst.info.count    = args.args.src.info.count;
         args.args.dst.info.mem_type = args.args.src.info.mem_type;
         args.args.dst.info.datatype = args.args.src.info.datatype;
-        args.args.mask &= (~UCC_COLL_ARGS_FLAG_IN_PLACE);
+        args.args.flags &= (~UCC_COLL_ARGS_FLAG_IN_PLACE);
     }
 
     cl_schedule = ucc_cl_hier_get_schedule(cl_team);
@@ -110,61 +88,61 @@ ucc_cl_hier_reduce_2step_init_schedule(ucc_base_coll_args_t *coll_args,
         args.mask |= UCC_BASE_CARGS_MAX_FRAG_COUNT;
     }
 
-    ucc_assert(SBGP_ENABLED(cl_team, NODE_LEADERS) ||
-               SBGP_ENABLED(cl_team, NODE));
-    if (SBGP_ENABLED(cl_team, NODE)) {
-        args.args.root = root_on_local_node
-            ? find_root_node_rank(root, cl_team) : 0;
-
-        if ((root != rank) && SBGP_ENABLED(cl_team, NODE_LEADERS)) {
-            status = ucc_mc_alloc(&cl_schedule->scratch,
-                                  args.max_frag_count *
-                                  ucc_dt_size(args.args.src.info.datatype),
-                                  args.args.src.info.mem_type);
-            if (ucc_unlikely(UCC_OK != status)) {
-                goto out;
-            }
-            args.args.dst.info.buffer = cl_schedule->scratch->addr;
-            if (root_on_local_node) {
-                first_task = 1;
-                args.args.src.info.buffer = cl_schedule->scratch->addr;
-            }
+    /* Partial results of the levels where this rank is the root are
+       accumulated in place: in dst on the root, in scratch otherwise.
+       The level where the rank is not the root sends the accumulated
+       result up and goes last. */
+    acc = args.args.dst.info;
+    if ((root != rank) && (n_levels > 1)) {
+        status = ucc_mc_alloc(&cl_schedule->scratch,
+                              args.max_frag_count *
+                              ucc_dt_size(args.args.src.info.datatype),
+                              args.args.src.info.mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            goto out;
         }
-        status = ucc_coll_init(SCORE_MAP(cl_team, NODE), &args, &tasks[n_tasks]);
+        acc.buffer = cl_schedule->scratch->addr;
+    }
+
+    for (l = 0; l < cl_team->n_levels; l++) {
+        if (!LEVEL_ENABLED(cl_team, l) || l == send_level) {
+            continue;
+        }
+        args.args.root     = level_root[l];
+        args.args.dst.info = acc;
+        if (n_tasks > 0) {
+            args.args.src.info  = acc;
+            args.args.mask     |= UCC_COLL_ARGS_FIELD_FLAGS;
+            args.args.flags    |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+        }
+        status = ucc_coll_init(LEVEL_SCORE_MAP(cl_team, l), &args,
+                               &tasks[n_tasks]);
         if (ucc_unlikely(UCC_OK != status)) {
             goto out;
         }
         n_tasks++;
     }
 
-    if (SBGP_ENABLED(cl_team, NODE_LEADERS)) {
-        if (n_tasks == 1) {
-            if (root != rank) {
-                args.args.src.info.buffer = root_on_local_node ?
-                    coll_args->args.src.info.buffer : cl_schedule->scratch->addr;
-            } else {
-                args.args.mask |= UCC_COLL_ARGS_FIELD_FLAGS;
-                args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
-            }
+    if (send_level >= 0) {
+        args.args.root   = level_root[send_level];
+        args.args.flags &= (~UCC_COLL_ARGS_FLAG_IN_PLACE);
+        if (n_tasks > 0) {
+            args.args.src.info = acc;
         }
-        args.args.root = find_root_net_rank(ucc_team_rank_host_id(root, core_team),
-                                            cl_team);
-        status = ucc_coll_init(SCORE_MAP(cl_team, NODE_LEADERS),
-                               &args, &tasks[n_tasks]);
+        status = ucc_coll_init(LEVEL_SCORE_MAP(cl_team, send_level), &args,
+                               &tasks[n_tasks]);
         if (ucc_unlikely(UCC_OK != status)) {
             goto out;
         }
         n_tasks++;
     }
 
-    ucc_task_subscribe_dep(&schedule->super, tasks[first_task],
+    ucc_task_subscribe_dep(&schedule->super, tasks[0],
                            UCC_EVENT_SCHEDULE_STARTED);
-    ucc_schedule_add_task(schedule, tasks[first_task]);
-
-    if (n_tasks > 1) {
-        ucc_task_subscribe_dep(tasks[first_task],
-                               tasks[(first_task + 1) % 2], UCC_EVENT_COMPLETED);
-        ucc_schedule_add_task(schedule, tasks[(first_task + 1) % 2]);
+    ucc_schedule_add_task(schedule, tasks[0]);
+    for (i = 1; i < n_tasks; i++) {
+        ucc_task_subscribe_dep(tasks[i - 1], tasks[i], UCC_EVENT_COMPLETED);
+        ucc_schedule_add_task(schedule, tasks[i]);
     }
 
     schedule->super.post           = ucc_cl_hier_reduce_2step_start;
@@ -178,6 +156,9 @@ out:
     for (i = 0; i < n_tasks; i++) {
         tasks[i]->finalize(tasks[i]);
     }
+    if (cl_schedule->scratch) {
+        ucc_mc_free(cl_schedule->scratch);
+    }
     ucc_cl_hier_put_schedule(schedule);
     return status;
 }
@@ -276,7 +257,8 @@ UCC_CL_HIER_PROFILE_FUNC(ucc_status_t, ucc_cl_hier_reduce_2step_init,
     ucc_status_t              status;
 
     if (UCC_IS_PERSISTENT(coll_args->args) ||
-        (coll_args->args.op == UCC_OP_AVG)) {
+        (coll_args->args.op == UCC_OP_AVG) ||
+        UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
         return UCC_ERR_NOT_SUPPORTED;
     }
 
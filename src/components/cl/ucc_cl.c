@@ -7,6 +7,7 @@
 #include "ucc_cl.h"
 #include "utils/ucc_log.h"
 #include "utils/ucc_malloc.h"
+#include "utils/ucc_math.h"
 #include "core/ucc_global_opts.h"
 
 static char * ucc_cl_tls_doc_str = "List of TLs used by a given CL component.\n"
@@ -200,3 +201,72 @@ UCC_CLASS_CLEANUP_FUNC(ucc_cl_team_t)
 }
 
 UCC_CLASS_DEFINE(ucc_cl_team_t, void);
+
+/* Collects CL specific allow lists named *TLS, the generic TLS entry of
+   ucc_cl_lib_config_table is skipped */
+static ucc_status_t ucc_cl_config_tls_collect(void *opts,
+                                              ucc_config_field_t *fields,
+                                              ucc_config_names_array_t *tls,
+                                              int *n_lists)
+{
+    ucc_config_allow_list_t *list;
+    size_t                   len;
+    ucc_status_t             status;
+
+    for (; fields->name != NULL; fields++) {
+        len = strlen(fields->name);
+        if (len == 0) {
+            status = ucc_cl_config_tls_collect(
+                PTR_OFFSET(opts, fields->offset),
+                (ucc_config_field_t *)fields->parser.arg, tls, n_lists);
+            if (UCC_OK != status) {
+                return status;
+            }
+            continue;
+        }
+        if (fields == &ucc_cl_lib_config_table[TLS_CONFIG_ENTRY] ||
+            len < 3 || 0 != strcmp(fields->name + len - 3, "TLS") ||
+            !ucc_config_field_is_allow_list(fields)) {
+            continue;
+        }
+        (*n_lists)++;
+        list = PTR_OFFSET(opts, fields->offset);
+        if (list->mode != UCC_CONFIG_ALLOW_LIST_ALLOW) {
+            return UCC_ERR_NOT_FOUND;
+        }
+        status = ucc_config_names_array_merge_trim(tls, &list->array);
+        if (UCC_OK != status) {
+            return status;
+        }
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_cl_lib_config_tls(ucc_cl_iface_t *iface,
+                                   const char *full_prefix,
+                                   ucc_config_names_array_t *tls)
+{
+    ucc_config_names_array_t specific = {0};
+    int                      n_lists  = 0;
+    ucc_cl_lib_config_t     *cl_config;
+    ucc_status_t             status;
+
+    status = ucc_base_config_read(full_prefix, &iface->cl_lib_config,
+                                  (ucc_base_config_t **)&cl_config);
+    if (UCC_OK != status) {
+        return status;
+    }
+    status = ucc_cl_config_tls_collect(cl_config, iface->cl_lib_config.table,
+                                       &specific, &n_lists);
+    if (UCC_OK == status && n_lists > 0) {
+        /* CL specific lists, e.g. hier sbgp TLs, narrow the generic one */
+        status = ucc_config_names_array_merge_trim(tls, &specific);
+    } else if (UCC_OK == status || UCC_ERR_NOT_FOUND == status) {
+        status = (cl_config->tls.mode == UCC_CONFIG_ALLOW_LIST_ALLOW) ?
+                 ucc_config_names_array_merge_trim(tls, &cl_config->tls.array) :
+                 UCC_ERR_NOT_FOUND;
+    }
+    ucc_config_names_array_free(&specific);
+    ucc_base_config_release(&cl_config->super.super);
+    return status;
+}
@@ -59,6 +59,15 @@ ucc_status_t ucc_cl_lib_config_read(ucc_cl_iface_t *iface,
                                     const char *full_prefix,
                                     ucc_cl_lib_config_t **cl_config);
 
+/* Merges into "tls" the names of TLs the CL may use according to its lib
+   config read with full_prefix (env and config file): CL specific allow
+   lists named *TLS (e.g. hier sbgp TLs) if the CL has them, generic TLS
+   list otherwise. Returns UCC_ERR_NOT_FOUND if the list is "all" or
+   negated, i.e. any TL may be used by the CL. */
+ucc_status_t ucc_cl_lib_config_tls(ucc_cl_iface_t *iface,
+                                   const char *full_prefix,
+                                   ucc_config_names_array_t *tls);
+
 typedef struct ucc_cl_iface {
     ucc_component_iface_t          super;
     ucc_cl_type_t                  type;
@@ -1,11 +1,12 @@
 /**
- * Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  *
  * See file LICENSE for terms.
  */
 
 #include "utils/ucc_math_op.h"
 #include "ec_cpu.h"
+#include "core/ucc_dt.h"
 #include <complex.h>
 
 #define DO_DT_REDUCE_WITH_OP(type, s, d, _count, _n_srcs, OP)                  \
@@ -224,6 +225,50 @@
         }                                                                      \
     } while (0)
 
+/* Branch free select of the pair with smaller (MINLOC) or bigger (MAXLOC)
+   value, ties are resolved to the smaller index. Each pass over the vector
+   is a plain element-wise loop so that compiler can vectorize it. */
+#define DO_LOC_SELECT(_d, _a, _b, _count, _CMP)                                \
+    do {                                                                       \
+        size_t _i;                                                             \
+        int    _t;                                                             \
+        for (_i = 0; _i < _count; _i++) {                                      \
+            _t = (_b[_i].v _CMP _a[_i].v) |                                    \
+                 ((_b[_i].v == _a[_i].v) & (_b[_i].i < _a[_i].i));             \
+            _d[_i].v = _t ? _b[_i].v : _a[_i].v;                               \
+            _d[_i].i = _t ? _b[_i].i : _a[_i].i;                               \
+        }                                                                      \
+    } while (0)
+
+#define DO_DT_REDUCE_LOC_WITH_CMP(type, s, d, _count, _n_srcs, _CMP)           \
+    do {                                                                       \
+        size_t _j;                                                             \
+        DO_LOC_SELECT(d, s[0], s[1], _count, _CMP);                            \
+        for (_j = 2; _j < _n_srcs; _j++) {                                     \
+            DO_LOC_SELECT(d, d, s[_j], _count, _CMP);                          \
+        }                                                                      \
+    } while (0)
+
+#define DO_DT_REDUCE_LOC(type, _srcs, _dst, _op, _count, _n_srcs)              \
+    do {                                                                       \
+        const type **s = (const type **)_srcs;                                 \
+        type        *d = (type *)_dst;                                         \
+        switch (_op) {                                                         \
+        case UCC_OP_MINLOC:                                                    \
+            DO_DT_REDUCE_LOC_WITH_CMP(type, s, d, _count, _n_srcs, <);         \
+            break;                                                             \
+        case UCC_OP_MAXLOC:                                                    \
+            DO_DT_REDUCE_LOC_WITH_CMP(type, s, d, _count, _n_srcs, >);         \
+            break;                                                             \
+        default:                                                               \
+            ec_error(&ucc_ec_cpu.super,                                        \
+                     "value-index pair dtype does not support "                \
+                     "requested reduce op: %s",                                \
+                     ucc_reduction_op_str(_op));                               \
+            return UCC_ERR_NOT_SUPPORTED;                                      \
+        }                                                                      \
+    } while (0)
+
 ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
                                void * const * restrict srcs, uint16_t flags)
 {
@@ -312,6 +357,22 @@ ucc_status_t ucc_ec_cpu_reduce(ucc_eee_task_reduce_t *task, void * restrict dst,
 #else
         return UCC_ERR_NOT_SUPPORTED;
 #endif
+    case UCC_DT_FLOAT32_INT32:
+        DO_DT_REDUCE_LOC(ucc_float32_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+    case UCC_DT_FLOAT64_INT32:
+        DO_DT_REDUCE_LOC(ucc_float64_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+    case UCC_DT_INT64_INT32:
+        DO_DT_REDUCE_LOC(ucc_int64_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
+    case UCC_DT_INT32_INT32:
+        DO_DT_REDUCE_LOC(ucc_int32_int32_t, srcs, dst, task->op,
+                         task->count, task->n_srcs);
+        break;
     default:
         ec_error(&ucc_ec_cpu.super, "unsupported reduction type (%s)",
                  ucc_datatype_str(task->dt));
@@ -7,6 +7,8 @@
 #include "config.h"
 #include "components/mc/base/ucc_mc_base.h"
 #include "ucc_mc.h"
+#include "ucc_mc_memtype_cache.h"
+#include "core/ucc_global_opts.h"
 #include "utils/ucc_malloc.h"
 #include "utils/ucc_log.h"
 
@@ -18,6 +20,8 @@
 #define UCC_MC_PROFILE_FUNC UCC_PROFILE_FUNC
 
 static const ucc_mc_ops_t *mc_ops[UCC_MEMORY_TYPE_LAST];
+/* memtype cache is only needed if some non host MC can answer mem_query */
+static int                 mc_memtype_cache;
 
 #define UCC_CHECK_MC_AVAILABLE(mc)                                             \
     do {                                                                       \
@@ -80,8 +84,14 @@ ucc_status_t ucc_mc_init(const ucc_mc_params_t *mc_params)
         }
         mc->ref_cnt++;
         mc_ops[mc->type] = &mc->ops;
+        if (mc->type != UCC_MEMORY_TYPE_HOST) {
+            mc_memtype_cache = ucc_global_config.memtype_cache;
+        }
     }
 
+    if (mc_memtype_cache) {
+        return ucc_mc_memtype_cache_init();
+    }
     return UCC_OK;
 }
 
@@ -101,6 +111,7 @@ ucc_status_t ucc_mc_get_mem_attr(const void *ptr, ucc_mem_attr_t *mem_attr)
 {
     ucc_status_t      status;
     ucc_memory_type_t mt;
+    int               cacheable;
 
     mem_attr->mem_type     = UCC_MEMORY_TYPE_HOST;
     mem_attr->base_address = (void *)ptr;
@@ -109,15 +120,27 @@ ucc_status_t ucc_mc_get_mem_attr(const void *ptr, ucc_mem_attr_t *mem_attr)
         return UCC_OK;
     }
 
+    /* cached entries only keep the type, base address and length have to
+       be queried */
+    cacheable = mc_memtype_cache &&
+                mem_attr->field_mask == UCC_MEM_ATTR_FIELD_MEM_TYPE;
+    if (cacheable &&
+        UCC_OK == ucc_mc_memtype_cache_lookup(ptr, &mem_attr->mem_type)) {
+        return UCC_OK;
+    }
+
     mt = (ucc_memory_type_t)(UCC_MEMORY_TYPE_HOST + 1);
     for (; mt < UCC_MEMORY_TYPE_LAST; mt++) {
         if (NULL != mc_ops[mt]) {
             status = mc_ops[mt]->mem_query(ptr, mem_attr);
             if (UCC_OK == status) {
-                return UCC_OK;
+                break;
             }
         }
     }
+    if (cacheable) {
+        ucc_mc_memtype_cache_update(ptr, mem_attr->mem_type);
+    }
     return UCC_OK;
 }
 
@@ -204,6 +227,9 @@ ucc_status_t ucc_mc_finalize()
    ucc_memory_type_t  mt;
    ucc_mc_base_t     *mc;
 
+    if (mc_memtype_cache) {
+        ucc_mc_memtype_cache_finalize();
+    }
     for (mt = UCC_MEMORY_TYPE_HOST; mt < UCC_MEMORY_TYPE_LAST; mt++) {
         if (NULL != mc_ops[mt]) {
             mc = ucc_container_of(mc_ops[mt], ucc_mc_base_t, ops);
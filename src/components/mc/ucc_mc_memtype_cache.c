@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_mc_memtype_cache.h"
+#include "utils/ucc_compiler_def.h"
+#include "utils/ucc_sys.h"
+#include "utils/ucc_log.h"
+#include <ucm/api/ucm.h>
+#include <string.h>
+
+/* Direct mapped table: entry holds page address with (mem_type + 1) in the
+   low bits, 0 is an empty slot. Entries are single aligned words, so lookup
+   and update are lock free; a racing update may only store a stale type for
+   a page that is being unmapped concurrently with its collective init,
+   which is a user error anyway. */
+#define UCC_MC_MEMTYPE_CACHE_SIZE   4096
+#define UCC_MC_MEMTYPE_CACHE_EVENTS                                            \
+    (UCM_EVENT_VM_UNMAPPED | UCM_EVENT_MEM_TYPE_FREE)
+
+static struct {
+    volatile uintptr_t entries[UCC_MC_MEMTYPE_CACHE_SIZE];
+    uintptr_t          page_mask;
+    unsigned           page_shift;
+    int                ref_cnt;
+    int                enabled;
+} ucc_mc_memtype_cache;
+
+static inline unsigned ucc_mc_memtype_cache_idx(uintptr_t page)
+{
+    return (page >> ucc_mc_memtype_cache.page_shift) &
+           (UCC_MC_MEMTYPE_CACHE_SIZE - 1);
+}
+
+static void ucc_mc_memtype_cache_invalidate(void *address, size_t size)
+{
+    uintptr_t start = (uintptr_t)address & ucc_mc_memtype_cache.page_mask;
+    uintptr_t end   = (uintptr_t)address + size;
+    uintptr_t page, entry;
+    unsigned  idx;
+
+    if (((end - start) >> ucc_mc_memtype_cache.page_shift) >=
+        UCC_MC_MEMTYPE_CACHE_SIZE) {
+        for (idx = 0; idx < UCC_MC_MEMTYPE_CACHE_SIZE; idx++) {
+            entry = ucc_mc_memtype_cache.entries[idx] &
+                    ucc_mc_memtype_cache.page_mask;
+            if (entry >= start && entry < end) {
+                ucc_mc_memtype_cache.entries[idx] = 0;
+            }
+        }
+        return;
+    }
+    for (page = start; page < end;
+         page += ~ucc_mc_memtype_cache.page_mask + 1) {
+        idx = ucc_mc_memtype_cache_idx(page);
+        if ((ucc_mc_memtype_cache.entries[idx] &
+             ucc_mc_memtype_cache.page_mask) == page) {
+            ucc_mc_memtype_cache.entries[idx] = 0;
+        }
+    }
+}
+
+static void ucc_mc_memtype_cache_event_cb(ucm_event_type_t event_type,
+                                          ucm_event_t *event, void *arg)
+{
+    if (event_type == UCM_EVENT_VM_UNMAPPED) {
+        ucc_mc_memtype_cache_invalidate(event->vm_unmapped.address,
+                                        event->vm_unmapped.size);
+    } else if (event_type == UCM_EVENT_MEM_TYPE_FREE) {
+        ucc_mc_memtype_cache_invalidate(event->mem_type.address,
+                                        event->mem_type.size);
+    }
+}
+
+ucc_status_t ucc_mc_memtype_cache_init(void)
+{
+    size_t       page_size = ucc_get_page_size();
+    ucs_status_t status;
+
+    if (ucc_mc_memtype_cache.ref_cnt++ > 0) {
+        return UCC_OK;
+    }
+    memset((void *)ucc_mc_memtype_cache.entries, 0,
+           sizeof(ucc_mc_memtype_cache.entries));
+    ucc_mc_memtype_cache.page_mask  = ~((uintptr_t)page_size - 1);
+    ucc_mc_memtype_cache.page_shift = __builtin_ctzl(page_size);
+    status = ucm_set_event_handler(UCC_MC_MEMTYPE_CACHE_EVENTS, 1000,
+                                   ucc_mc_memtype_cache_event_cb, NULL);
+    if (UCS_OK != status) {
+        /* without invalidation events cached types can go stale */
+        ucc_debug("failed to install ucm event handler, memtype cache is "
+                  "disabled: %s", ucs_status_string(status));
+        ucc_mc_memtype_cache.enabled = 0;
+        return UCC_OK;
+    }
+    ucc_mc_memtype_cache.enabled = 1;
+    return UCC_OK;
+}
+
+void ucc_mc_memtype_cache_finalize(void)
+{
+    if (--ucc_mc_memtype_cache.ref_cnt > 0) {
+        return;
+    }
+    if (ucc_mc_memtype_cache.enabled) {
+        ucm_unset_event_handler(UCC_MC_MEMTYPE_CACHE_EVENTS,
+                                ucc_mc_memtype_cache_event_cb, NULL);
+        ucc_mc_memtype_cache.enabled = 0;
+    }
+}
+
+ucc_status_t ucc_mc_memtype_cache_lookup(const void *ptr,
+                                         ucc_memory_type_t *mem_type)
+{
+    uintptr_t page = (uintptr_t)ptr & ucc_mc_memtype_cache.page_mask;
+    uintptr_t entry;
+
+    if (!ucc_mc_memtype_cache.enabled) {
+        return UCC_ERR_NOT_FOUND;
+    }
+    entry = ucc_mc_memtype_cache.entries[ucc_mc_memtype_cache_idx(page)];
+    if (entry == 0 || (entry & ucc_mc_memtype_cache.page_mask) != page) {
+        return UCC_ERR_NOT_FOUND;
+    }
+    *mem_type = (ucc_memory_type_t)((entry & ~ucc_mc_memtype_cache.page_mask)
+                                    - 1);
+    return UCC_OK;
+}
+
+void ucc_mc_memtype_cache_update(const void *ptr, ucc_memory_type_t mem_type)
+{
+    uintptr_t page = (uintptr_t)ptr & ucc_mc_memtype_cache.page_mask;
+
+    if (!ucc_mc_memtype_cache.enabled) {
+        return;
+    }
+    ucc_mc_memtype_cache.entries[ucc_mc_memtype_cache_idx(page)] =
+        page | ((uintptr_t)mem_type + 1);
+}
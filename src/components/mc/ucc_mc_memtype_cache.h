@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_MC_MEMTYPE_CACHE_H_
+#define UCC_MC_MEMTYPE_CACHE_H_
+
+#include "ucc/api/ucc.h"
+
+/* Page granular cache of memory types reported by MC mem_query.
+   Entries are dropped on UCM VM_UNMAPPED and MEM_TYPE_FREE events. */
+
+ucc_status_t ucc_mc_memtype_cache_init(void);
+
+void ucc_mc_memtype_cache_finalize(void);
+
+/**
+ * Lookup memory type of the page containing ptr.
+ * @param [in]    ptr       Memory pointer.
+ * @param [out]   mem_type  Cached memory type.
+ * @return UCC_OK on hit, UCC_ERR_NOT_FOUND on miss or if cache is disabled.
+ */
+ucc_status_t ucc_mc_memtype_cache_lookup(const void *ptr,
+                                         ucc_memory_type_t *mem_type);
+
+void ucc_mc_memtype_cache_update(const void *ptr, ucc_memory_type_t mem_type);
+
+#endif
@@ -85,7 +85,8 @@ ucc_status_t ucc_tl_cuda_task_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_cuda_task_t *task;
     ucc_status_t        status;
 
-    if (!ucc_coll_args_is_predefined_dt(&coll_args->args, trank)) {
+    if (!ucc_coll_args_is_predefined_dt(&coll_args->args, trank) ||
+        UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
         return UCC_ERR_NOT_SUPPORTED;
     }
 
@@ -50,7 +50,7 @@ ucc_status_t ucc_tl_cuda_get_lib_attr(const ucc_base_lib_t *lib, /* NOLINT */
 
     attr->super.attr.thread_mode = UCC_THREAD_MULTIPLE;
     attr->super.attr.coll_types  = UCC_TL_CUDA_SUPPORTED_COLLS;
-    attr->super.flags            = 0;
+    attr->super.flags            = UCC_BASE_LIB_FLAG_LAZY_CONTEXT;
     if (base_attr->mask & UCC_BASE_LIB_ATTR_FIELD_MIN_TEAM_SIZE) {
         attr->super.min_team_size = lib->min_team_size;
     }
@@ -44,6 +44,14 @@ ncclDataType_t ucc_to_nccl_dtype[] = {
         (ncclDataType_t)ncclDataTypeUnsupported,
     [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT128_COMPLEX)] =
         (ncclDataType_t)ncclDataTypeUnsupported,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT32_INT32)] =
+        (ncclDataType_t)ncclDataTypeUnsupported,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT64_INT32)] =
+        (ncclDataType_t)ncclDataTypeUnsupported,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_INT64_INT32)] =
+        (ncclDataType_t)ncclDataTypeUnsupported,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_INT32_INT32)] =
+        (ncclDataType_t)ncclDataTypeUnsupported,
 #if (CUDART_VERSION >= 11000) && (NCCL_VERSION_CODE >= NCCL_VERSION(2,10,3))
     [UCC_DT_PREDEFINED_ID(UCC_DT_BFLOAT16)] = (ncclDataType_t)ncclBfloat16,
 #else
@@ -30,7 +30,7 @@ ucc_status_t ucc_tl_nccl_get_lib_attr(const ucc_base_lib_t *lib, /* NOLINT */
     ucc_tl_lib_attr_t *attr      = ucc_derived_of(base_attr, ucc_tl_lib_attr_t);
     attr->super.attr.thread_mode = UCC_THREAD_MULTIPLE;
     attr->super.attr.coll_types  = UCC_TL_NCCL_SUPPORTED_COLLS;
-    attr->super.flags            = 0;
+    attr->super.flags            = UCC_BASE_LIB_FLAG_LAZY_CONTEXT;
     attr->super.min_team_size    = 2;
     attr->super.max_team_size    = UCC_RANK_MAX;
     if (base_attr->mask & UCC_BASE_LIB_ATTR_FIELD_MIN_TEAM_SIZE) {
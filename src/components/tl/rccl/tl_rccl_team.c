@@ -128,6 +128,10 @@ ucc_status_t ucc_tl_rccl_coll_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_rccl_task_t *task;
     ucc_status_t        status;
 
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args) &&
+        (coll_args->args.coll_type != UCC_COLL_TYPE_BCAST)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
     task = ucc_tl_rccl_init_task(coll_args, team);
     if (ucc_unlikely(!task)) {
         return UCC_ERR_NO_MESSAGE;
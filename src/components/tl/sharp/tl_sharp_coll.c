@@ -37,6 +37,10 @@ enum sharp_datatype ucc_to_sharp_dtype[] = {
     [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT32_COMPLEX)]  = SHARP_DTYPE_NULL,
     [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT64_COMPLEX)]  = SHARP_DTYPE_NULL,
     [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT128_COMPLEX)] = SHARP_DTYPE_NULL,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT32_INT32)]    = SHARP_DTYPE_NULL,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_FLOAT64_INT32)]    = SHARP_DTYPE_NULL,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_INT64_INT32)]      = SHARP_DTYPE_NULL,
+    [UCC_DT_PREDEFINED_ID(UCC_DT_INT32_INT32)]      = SHARP_DTYPE_NULL,
 };
 
 enum sharp_reduce_op ucc_to_sharp_reduce_op[] = {
@@ -73,6 +73,7 @@ UCC_CLASS_INIT_FUNC(ucc_tl_context_t, const ucc_tl_context_config_t *tl_config,
     self->super.lib         = &tl_config->tl_lib->super;
     self->super.ucc_context = ucc_context;
     self->ref_count         = 0;
+    self->lazy              = 0;
     if (0 == strcmp(tl_config->super.score_str, "0")) {
         return UCC_ERR_LAST;
     }
@@ -123,12 +124,20 @@ ucc_status_t ucc_tl_context_get(ucc_context_t *ctx, const char* name,
             return UCC_OK;
         }
     }
+    if (ucc_context_tl_is_lazy(ctx, name) &&
+        UCC_OK == ucc_context_tl_create_lazy(ctx, name, tl_context)) {
+        (*tl_context)->ref_count++;
+        return UCC_OK;
+    }
     return UCC_ERR_NOT_FOUND;
 }
 
 ucc_status_t ucc_tl_context_put(ucc_tl_context_t *tl_context)
 {
     tl_context->ref_count--;
+    if (tl_context->lazy && 0 == tl_context->ref_count) {
+        ucc_context_tl_destroy_lazy(tl_context);
+    }
     return UCC_OK;
 }
 
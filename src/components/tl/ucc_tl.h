@@ -90,6 +90,7 @@ UCC_CLASS_DECLARE(ucc_tl_lib_t, ucc_tl_iface_t *, const ucc_tl_lib_config_t *);
 typedef struct ucc_tl_context {
     ucc_base_context_t super;
     int                ref_count;
+    int                lazy; /* created on first use, see UCC_LAZY_TLS */
 } ucc_tl_context_t;
 UCC_CLASS_DECLARE(ucc_tl_context_t, const ucc_tl_context_config_t *,
                   ucc_context_t *);
@@ -7,6 +7,7 @@
 #define ALLGATHER_H_
 #include "../tl_ucp.h"
 #include "../tl_ucp_coll.h"
+#include "../tl_ucp_dt_generic.h"
 
 enum {
     UCC_TL_UCP_ALLGATHER_ALG_KNOMIAL,
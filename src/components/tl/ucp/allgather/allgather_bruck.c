@@ -17,22 +17,30 @@ ucc_status_t ucc_tl_ucp_allgather_bruck_init(ucc_base_coll_args_t *coll_args,
                                              ucc_coll_task_t     **task_h)
 {
     ucc_tl_ucp_team_t *tl_team      = ucc_derived_of(team, ucc_tl_ucp_team_t);
-    ucc_tl_ucp_task_t *task         = ucc_tl_ucp_init_task(coll_args, team);
     ucc_status_t       status       = UCC_OK;
     ucc_rank_t         trank        = UCC_TL_TEAM_RANK(tl_team);
     ucc_rank_t         tsize        = UCC_TL_TEAM_SIZE(tl_team);
-    ucc_memory_type_t  rmem         = TASK_ARGS(task).dst.info.mem_type;
-    ucc_datatype_t     dt           = TASK_ARGS(task).dst.info.datatype;
-    size_t             count        = TASK_ARGS(task).dst.info.count;
-    size_t             data_size    = (count / tsize) * ucc_dt_size(dt);
-    size_t             scratch_size = (tsize - trank) * data_size;
+    ucc_memory_type_t  rmem         = coll_args->args.dst.info.mem_type;
+    ucc_datatype_t     dt           = coll_args->args.dst.info.datatype;
+    size_t             count        = coll_args->args.dst.info.count;
+    ucc_tl_ucp_task_t *task;
+    size_t             data_size, scratch_size;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_allgather_bruck_init, task_h);
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return ucc_tl_ucp_allgather_knomial_init(coll_args, team, task_h);
+    }
+
+    task = ucc_tl_ucp_init_task(coll_args, team);
     if (!ucc_coll_args_is_predefined_dt(&TASK_ARGS(task), UCC_RANK_INVALID)) {
         tl_error(UCC_TASK_LIB(task), "user defined datatype is not supported");
         status = UCC_ERR_NOT_SUPPORTED;
         goto out;
     }
     tl_trace(UCC_TASK_LIB(task), "ucc_tl_ucp_allgather_bruck_init");
+    data_size    = (count / tsize) * ucc_dt_size(dt);
+    scratch_size = (tsize - trank) * data_size;
 
     task->super.post     = ucc_tl_ucp_allgather_bruck_start;
     task->super.progress = ucc_tl_ucp_allgather_bruck_progress;
@@ -50,6 +58,7 @@ ucc_status_t ucc_tl_ucp_allgather_bruck_init(ucc_base_coll_args_t *coll_args,
             ucc_tl_ucp_coll_finalize(&task->super);
             goto out;
         }
+        ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), scratch_size);
         task->allgather_bruck.scratch_size = scratch_size;
     } else {
         task->allgather_bruck.scratch_header = NULL;
@@ -7,6 +7,7 @@
 #include "config.h"
 #include "tl_ucp.h"
 #include "tl_ucp_coll.h"
+#include "tl_ucp_dt_generic.h"
 #include "tl_ucp_sendrecv.h"
 #include "core/ucc_progress_queue.h"
 #include "components/mc/ucc_mc.h"
@@ -317,6 +318,13 @@ ucc_status_t ucc_tl_ucp_allgather_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_rank_t         size    = UCC_TL_TEAM_SIZE(tl_team);
     ucc_kn_radix_t     radix;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_allgather_knomial_init, task_h);
+
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        size = (ucc_rank_t)coll_args->args.active_set.size;
+    }
+
     radix = ucc_min(UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.allgather_kn_radix, size);
     return ucc_tl_ucp_allgather_knomial_init_r(coll_args, team, task_h, radix);
 }
@@ -41,6 +41,12 @@ ucc_status_t ucc_tl_ucp_allgather_neighbor_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_tl_ucp_team_t *ucp_team;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_allgather_neighbor_init, task_h);
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return ucc_tl_ucp_allgather_ring_init(coll_args, team, task_h);
+    }
+
     task     = ucc_tl_ucp_init_task(coll_args, team);
     ucp_team = TASK_TEAM(task);
 
@@ -20,8 +20,15 @@ ucc_status_t ucc_tl_ucp_allgather_sparbit_init(ucc_base_coll_args_t *coll_args,
                                                ucc_base_team_t      *team,
                                                ucc_coll_task_t     **task_h)
 {
-    ucc_tl_ucp_task_t *task = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_tl_ucp_task_t *task;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_allgather_sparbit_init, task_h);
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return ucc_tl_ucp_allgather_knomial_init(coll_args, team, task_h);
+    }
+
+    task = ucc_tl_ucp_init_task(coll_args, team);
     if (!ucc_coll_args_is_predefined_dt(&TASK_ARGS(task), UCC_RANK_INVALID)) {
         tl_error(UCC_TASK_LIB(task), "user defined datatype is not supported");
         ucc_tl_ucp_put_task(task);
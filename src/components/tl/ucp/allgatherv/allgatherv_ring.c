@@ -136,6 +136,9 @@ ucc_status_t ucc_tl_ucp_allgatherv_ring_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t status;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_allgatherv_ring_init, task_h);
+
     task = ucc_tl_ucp_init_task(coll_args, team);
     status = ucc_tl_ucp_allgatherv_ring_init_common(task);
     if (status != UCC_OK) {
@@ -51,6 +51,9 @@ ucc_status_t ucc_tl_ucp_allreduce_dbt_init(ucc_base_coll_args_t *coll_args,
     ucc_coll_task_t     *reduce_task, *bcast_task;
     ucc_status_t         status;
 
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return ucc_tl_ucp_allreduce_knomial_init(coll_args, team, task_h);
+    }
     if (UCC_IS_INPLACE(args.args)) {
         return UCC_ERR_NOT_SUPPORTED;
     }
@@ -219,7 +219,6 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_init_common(ucc_tl_ucp_task_t *task)
     ucc_datatype_t     dt        = TASK_ARGS(task).dst.info.datatype;
     size_t             data_size = count * ucc_dt_size(dt);
     ucc_mrange_uint_t *p         = &team->cfg.allreduce_kn_radix;
-    ucc_sbgp_t        *sbgp;
     ucc_rank_t         size;
     ucc_kn_radix_t     radix, cfg_radix;
     ucc_status_t       status;
@@ -229,11 +228,7 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_init_common(ucc_tl_ucp_task_t *task)
     task->super.progress = ucc_tl_ucp_allreduce_knomial_progress;
     task->super.finalize = ucc_tl_ucp_allreduce_knomial_finalize;
 
-    if (!(task->flags & UCC_TL_UCP_TASK_FLAG_SUBSET) && team->cfg.use_reordering) {
-        sbgp = ucc_topo_get_sbgp(team->topo, UCC_SBGP_FULL_HOST_ORDERED);
-        task->subset.myrank = sbgp->group_rank;
-        task->subset.map    = sbgp->map;
-    }
+    ucc_tl_ucp_task_reorder_ranks(task);
 
     size      = (ucc_rank_t)task->subset.map.ep_num;
     cfg_radix = ucc_tl_ucp_get_radix_from_range(team, data_size, mem_type, p,
@@ -247,6 +242,7 @@ ucc_status_t ucc_tl_ucp_allreduce_knomial_init_common(ucc_tl_ucp_task_t *task)
         tl_error(UCC_TASK_LIB(task), "failed to allocate scratch buffer");
         return status;
     }
+    ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), (radix - 1) * data_size);
     return UCC_OK;
 }
 
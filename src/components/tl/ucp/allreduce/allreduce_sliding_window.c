@@ -573,6 +573,16 @@ ucc_tl_ucp_allreduce_sliding_window_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t                        *rdma_task;
     ucc_coll_task_t                          *barrier_task;
 
+    if (tl_team->worker->ep_lru_max) {
+        /* remote keys are bound to eps, which can be evicted */
+        tl_debug(UCC_TL_TEAM_LIB(tl_team),
+                 "sliding window is not supported with ep cache limit");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return ucc_tl_ucp_allreduce_knomial_init(coll_args, team, task_h);
+    }
+
     status = ucc_tl_ucp_get_schedule(tl_team, coll_args,
                                     (ucc_tl_ucp_schedule_t **)&schedule);
     if (ucc_unlikely(UCC_OK != status)) {
@@ -0,0 +1,397 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "allreduce.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "coll_patterns/recursive_knomial.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+
+/* Recursive knomial allreduce for mostly zero buffers. Every rank keeps the
+   dense partial result in dst, only the messages are encoded: if the number
+   of non zero elements is below the density threshold the message carries
+   (value, index) pairs, otherwise the dense vector. Encoding is chosen per
+   message so the algorithm switches back to dense once the fill-in of the
+   partial result makes it denser.
+
+   Message layout: uint64_t header with number of pairs or
+   UCC_TL_UCP_SPARSE_DENSE, values[n], uint32_t indices[n]. */
+
+#define UCC_TL_UCP_SPARSE_DENSE UINT64_MAX
+
+#define SPARSE_SLOT_SIZE(_data_size)                                           \
+    ucc_align_up_pow2(sizeof(uint64_t) + (_data_size), sizeof(uint64_t))
+
+#define SAVE_STATE(_phase)                                                     \
+    do {                                                                       \
+        task->allreduce_sparse.phase = _phase;                                 \
+    } while (0)
+
+#define SPARSE_DT_DISPATCH(_dt, _func, ...)                                    \
+    do {                                                                       \
+        switch (_dt) {                                                         \
+        case UCC_DT_INT32:                                                     \
+            _func(int32_t, __VA_ARGS__);                                       \
+            break;                                                             \
+        case UCC_DT_UINT32:                                                    \
+            _func(uint32_t, __VA_ARGS__);                                      \
+            break;                                                             \
+        case UCC_DT_INT64:                                                     \
+            _func(int64_t, __VA_ARGS__);                                       \
+            break;                                                             \
+        case UCC_DT_UINT64:                                                    \
+            _func(uint64_t, __VA_ARGS__);                                      \
+            break;                                                             \
+        case UCC_DT_FLOAT32:                                                   \
+            _func(float, __VA_ARGS__);                                         \
+            break;                                                             \
+        case UCC_DT_FLOAT64:                                                   \
+            _func(double, __VA_ARGS__);                                        \
+            break;                                                             \
+        default:                                                               \
+            ucc_assert(0);                                                     \
+        }                                                                      \
+    } while (0)
+
+#define SPARSE_COUNT_NNZ(_type, _buf, _count, _max, _nnz)                      \
+    do {                                                                       \
+        const _type *_b = (const _type *)(_buf);                               \
+        size_t       _i;                                                       \
+        for (_i = 0; _i < (_count) && (_nnz) <= (_max); _i++) {                \
+            (_nnz) += (_b[_i] != 0);                                           \
+        }                                                                      \
+    } while (0)
+
+#define SPARSE_PACK(_type, _buf, _count, _msg)                                 \
+    do {                                                                       \
+        const _type *_b = (const _type *)(_buf);                               \
+        uint64_t     _n = *(uint64_t *)(_msg);                                 \
+        _type       *_v = PTR_OFFSET(_msg, sizeof(uint64_t));                  \
+        uint32_t    *_x = PTR_OFFSET(_v, _n * sizeof(_type));                  \
+        size_t       _i, _j;                                                   \
+        for (_i = 0, _j = 0; _i < (_count); _i++) {                            \
+            if (_b[_i] != 0) {                                                 \
+                _v[_j]   = _b[_i];                                             \
+                _x[_j++] = (uint32_t)_i;                                       \
+            }                                                                  \
+        }                                                                      \
+    } while (0)
+
+#define SPARSE_SUM(_type, _msg, _buf, _count)                                  \
+    do {                                                                       \
+        uint64_t        _n = *(uint64_t *)(_msg);                              \
+        const _type    *_v = PTR_OFFSET(_msg, sizeof(uint64_t));               \
+        _type          *_b = (_type *)(_buf);                                  \
+        const uint32_t *_x;                                                    \
+        size_t          _i;                                                    \
+        if (_n == UCC_TL_UCP_SPARSE_DENSE) {                                   \
+            for (_i = 0; _i < (_count); _i++) {                                \
+                _b[_i] += _v[_i];                                              \
+            }                                                                  \
+        } else {                                                               \
+            _x = PTR_OFFSET(_v, _n * sizeof(_type));                           \
+            for (_i = 0; _i < _n; _i++) {                                      \
+                _b[_x[_i]] += _v[_i];                                          \
+            }                                                                  \
+        }                                                                      \
+    } while (0)
+
+#define SPARSE_UNPACK(_type, _msg, _buf, _count)                               \
+    do {                                                                       \
+        uint64_t        _n = *(uint64_t *)(_msg);                              \
+        const _type    *_v = PTR_OFFSET(_msg, sizeof(uint64_t));               \
+        const uint32_t *_x = PTR_OFFSET(_v, _n * sizeof(_type));               \
+        _type          *_b = (_type *)(_buf);                                  \
+        size_t          _i;                                                    \
+        memset(_b, 0, (_count) * sizeof(_type));                               \
+        for (_i = 0; _i < _n; _i++) {                                          \
+            _b[_x[_i]] = _v[_i];                                               \
+        }                                                                      \
+    } while (0)
+
+/* Encodes buf into msg, returns the message length */
+static size_t ucc_tl_ucp_allreduce_sparse_encode(ucc_tl_ucp_task_t *task,
+                                                 const void *buf, void *msg)
+{
+    ucc_coll_args_t *args      = &TASK_ARGS(task);
+    size_t           count     = args->dst.info.count;
+    ucc_datatype_t   dt        = args->dst.info.datatype;
+    size_t           data_size = count * ucc_dt_size(dt);
+    size_t           max_nnz   = task->allreduce_sparse.max_nnz;
+    uint64_t         nnz       = 0;
+
+    SPARSE_DT_DISPATCH(dt, SPARSE_COUNT_NNZ, buf, count, max_nnz, nnz);
+    if (nnz > max_nnz) {
+        *(uint64_t *)msg = UCC_TL_UCP_SPARSE_DENSE;
+        memcpy(PTR_OFFSET(msg, sizeof(uint64_t)), buf, data_size);
+        return sizeof(uint64_t) + data_size;
+    }
+    *(uint64_t *)msg = nnz;
+    SPARSE_DT_DISPATCH(dt, SPARSE_PACK, buf, count, msg);
+    return sizeof(uint64_t) + nnz * (ucc_dt_size(dt) + sizeof(uint32_t));
+}
+
+static void ucc_tl_ucp_allreduce_sparse_decode(ucc_tl_ucp_task_t *task,
+                                               const void *msg, void *buf)
+{
+    size_t         count = TASK_ARGS(task).dst.info.count;
+    ucc_datatype_t dt    = TASK_ARGS(task).dst.info.datatype;
+
+    if (*(const uint64_t *)msg == UCC_TL_UCP_SPARSE_DENSE) {
+        memcpy(buf, PTR_OFFSET(msg, sizeof(uint64_t)),
+               count * ucc_dt_size(dt));
+        return;
+    }
+    SPARSE_DT_DISPATCH(dt, SPARSE_UNPACK, msg, buf, count);
+}
+
+static void ucc_tl_ucp_allreduce_sparse_reduce(ucc_tl_ucp_task_t *task,
+                                               const void *msg, void *buf)
+{
+    size_t         count = TASK_ARGS(task).dst.info.count;
+    ucc_datatype_t dt    = TASK_ARGS(task).dst.info.datatype;
+
+    SPARSE_DT_DISPATCH(dt, SPARSE_SUM, msg, buf, count);
+}
+
+static void ucc_tl_ucp_allreduce_sparse_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t     *task      = ucc_derived_of(coll_task,
+                                                      ucc_tl_ucp_task_t);
+    ucc_coll_args_t       *args      = &TASK_ARGS(task);
+    ucc_tl_ucp_team_t     *team      = TASK_TEAM(task);
+    ucc_knomial_pattern_t *p         = &task->allreduce_sparse.p;
+    ucc_kn_radix_t         radix     = p->radix;
+    uint8_t                node_type = p->node_type;
+    size_t                 slot_size = task->allreduce_sparse.slot_size;
+    void                  *smsg      = task->allreduce_sparse.scratch;
+    void                  *sbuf      = args->src.info.buffer;
+    void                  *rbuf      = args->dst.info.buffer;
+    ucc_rank_t             rank      = task->subset.myrank;
+    void                  *rmsg;
+    size_t                 len;
+    ucc_rank_t             peer;
+    ucc_kn_radix_t         loop_step;
+
+    if (UCC_IS_INPLACE(*args)) {
+        sbuf = rbuf;
+    }
+    UCC_KN_GOTO_PHASE(task->allreduce_sparse.phase);
+
+    if (KN_NODE_EXTRA == node_type) {
+        peer = ucc_ep_map_eval(task->subset.map,
+                               ucc_knomial_pattern_get_proxy(p, rank));
+        len  = ucc_tl_ucp_allreduce_sparse_encode(task, sbuf, smsg);
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(smsg, len, UCC_MEMORY_TYPE_HOST,
+                                         peer, team, task),
+                      task, out);
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(PTR_OFFSET(smsg, slot_size),
+                                         slot_size, UCC_MEMORY_TYPE_HOST,
+                                         peer, team, task),
+                      task, out);
+    }
+    if (KN_NODE_PROXY == node_type) {
+        peer = ucc_ep_map_eval(task->subset.map,
+                               ucc_knomial_pattern_get_extra(p, rank));
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(PTR_OFFSET(smsg, slot_size),
+                                         slot_size, UCC_MEMORY_TYPE_HOST,
+                                         peer, team, task),
+                      task, out);
+    }
+UCC_KN_PHASE_EXTRA:
+    if (KN_NODE_PROXY == node_type || KN_NODE_EXTRA == node_type) {
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            SAVE_STATE(UCC_KN_PHASE_EXTRA);
+            return;
+        }
+        if (KN_NODE_EXTRA == node_type) {
+            ucc_tl_ucp_allreduce_sparse_decode(task,
+                                               PTR_OFFSET(smsg, slot_size),
+                                               rbuf);
+            goto completion;
+        }
+        ucc_tl_ucp_allreduce_sparse_reduce(task, PTR_OFFSET(smsg, slot_size),
+                                           rbuf);
+    }
+    while (!ucc_knomial_pattern_loop_done(p)) {
+        len = ucc_tl_ucp_allreduce_sparse_encode(task, rbuf, smsg);
+        for (loop_step = 1; loop_step < radix; loop_step++) {
+            peer = ucc_knomial_pattern_get_loop_peer(p, rank, loop_step);
+            if (peer == UCC_KN_PEER_NULL) {
+                continue;
+            }
+            peer = ucc_ep_map_eval(task->subset.map, peer);
+            UCPCHECK_GOTO(ucc_tl_ucp_send_nb(smsg, len, UCC_MEMORY_TYPE_HOST,
+                                             peer, team, task),
+                          task, out);
+            UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(PTR_OFFSET(smsg,
+                                                        loop_step * slot_size),
+                                             slot_size, UCC_MEMORY_TYPE_HOST,
+                                             peer, team, task),
+                          task, out);
+        }
+UCC_KN_PHASE_LOOP:
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            SAVE_STATE(UCC_KN_PHASE_LOOP);
+            return;
+        }
+        for (loop_step = 1; loop_step < radix; loop_step++) {
+            if (ucc_knomial_pattern_get_loop_peer(p, rank, loop_step) ==
+                UCC_KN_PEER_NULL) {
+                continue;
+            }
+            rmsg = PTR_OFFSET(smsg, loop_step * slot_size);
+            ucc_tl_ucp_allreduce_sparse_reduce(task, rmsg, rbuf);
+        }
+        ucc_knomial_pattern_next_iteration(p);
+    }
+    if (KN_NODE_PROXY == node_type) {
+        peer = ucc_ep_map_eval(task->subset.map,
+                               ucc_knomial_pattern_get_extra(p, rank));
+        len  = ucc_tl_ucp_allreduce_sparse_encode(task, rbuf, smsg);
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(smsg, len, UCC_MEMORY_TYPE_HOST,
+                                         peer, team, task),
+                      task, out);
+    }
+UCC_KN_PHASE_PROXY:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        SAVE_STATE(UCC_KN_PHASE_PROXY);
+        return;
+    }
+completion:
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allreduce_sparse_done",
+                                     0);
+out:
+    return;
+}
+
+static ucc_status_t
+ucc_tl_ucp_allreduce_sparse_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_coll_args_t   *args = &TASK_ARGS(task);
+    ucc_rank_t         size = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_allreduce_sparse_start",
+                                     0);
+    task->allreduce_sparse.phase = UCC_KN_PHASE_INIT;
+    ucc_knomial_pattern_init(size, task->subset.myrank,
+                             ucc_min(UCC_TL_UCP_TEAM_LIB(team)->
+                                     cfg.allreduce_sparse_kn_radix, size),
+                             &task->allreduce_sparse.p);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    /* dst accumulates the partial result, extra rank overwrites it */
+    if (!UCC_IS_INPLACE(*args) &&
+        (KN_NODE_EXTRA != task->allreduce_sparse.p.node_type)) {
+        status = ucc_mc_memcpy(args->dst.info.buffer, args->src.info.buffer,
+                               args->dst.info.count *
+                               ucc_dt_size(args->dst.info.datatype),
+                               UCC_MEMORY_TYPE_HOST, UCC_MEMORY_TYPE_HOST);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+}
+
+static ucc_status_t
+ucc_tl_ucp_allreduce_sparse_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_status_t       st, global_st;
+
+    global_st = ucc_mc_free(task->allreduce_sparse.scratch_mc_header);
+    if (ucc_unlikely(global_st != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed to free scratch buffer");
+    }
+    st = ucc_tl_ucp_coll_finalize(&task->super);
+    if (ucc_unlikely(st != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed finalize collective");
+        global_st = st;
+    }
+    return global_st;
+}
+
+ucc_status_t ucc_tl_ucp_allreduce_sparse_init(ucc_base_coll_args_t *coll_args,
+                                              ucc_base_team_t      *team,
+                                              ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_coll_args_t   *args    = &coll_args->args;
+    size_t             count   = args->dst.info.count;
+    ucc_datatype_t     dt      = args->dst.info.datatype;
+    uint32_t           density =
+        UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.allreduce_sparse_density;
+    ucc_tl_ucp_task_t *task;
+    ucc_kn_radix_t     radix;
+    size_t             dt_size, slot_size;
+    ucc_status_t       status;
+
+    ALLREDUCE_TASK_CHECK(coll_args->args, tl_team);
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return ucc_tl_ucp_allreduce_knomial_init(coll_args, team, task_h);
+    }
+    if ((args->op != UCC_OP_SUM) ||
+        (args->dst.info.mem_type != UCC_MEMORY_TYPE_HOST) ||
+        (count > UINT32_MAX)) {
+        tl_debug(UCC_TL_TEAM_LIB(tl_team),
+                 "sparse allreduce supports sum of host buffers only");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    switch (dt) {
+    case UCC_DT_INT32:
+    case UCC_DT_UINT32:
+    case UCC_DT_INT64:
+    case UCC_DT_UINT64:
+    case UCC_DT_FLOAT32:
+    case UCC_DT_FLOAT64:
+        break;
+    default:
+        tl_debug(UCC_TL_TEAM_LIB(tl_team),
+                 "datatype %s is not supported by sparse allreduce",
+                 ucc_datatype_str(dt));
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+
+    task    = ucc_tl_ucp_init_task(coll_args, team);
+    dt_size = ucc_dt_size(dt);
+    radix   = ucc_min(UCC_TL_UCP_TEAM_LIB(tl_team)->
+                      cfg.allreduce_sparse_kn_radix,
+                      (ucc_rank_t)task->subset.map.ep_num);
+    /* pairs are sent only if they are smaller than the dense vector */
+    task->allreduce_sparse.max_nnz =
+        ucc_min(count * ucc_min(density, 100) / 100,
+                (count * dt_size - 1) / (dt_size + sizeof(uint32_t)));
+    slot_size = SPARSE_SLOT_SIZE(count * dt_size);
+    task->allreduce_sparse.slot_size = slot_size;
+
+    task->super.post     = ucc_tl_ucp_allreduce_sparse_start;
+    task->super.progress = ucc_tl_ucp_allreduce_sparse_progress;
+    task->super.finalize = ucc_tl_ucp_allreduce_sparse_finalize;
+
+    /* one slot for the encoded send message and one per loop peer */
+    status = ucc_mc_alloc(&task->allreduce_sparse.scratch_mc_header,
+                          ucc_max(radix, 2) * slot_size,
+                          UCC_MEMORY_TYPE_HOST);
+    if (ucc_unlikely(status != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed to allocate scratch buffer");
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
+    task->allreduce_sparse.scratch =
+        task->allreduce_sparse.scratch_mc_header->addr;
+    ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task),
+                               ucc_max(radix, 2) * slot_size);
+    *task_h = &task->super;
+out:
+    return status;
+}
@@ -8,6 +8,7 @@
 #include "allreduce.h"
 #include "core/ucc_progress_queue.h"
 #include "tl_ucp_sendrecv.h"
+#include "tl_ucp_reduce.h"
 #include "coll_patterns/sra_knomial.h"
 #include "utils/ucc_math.h"
 #include "utils/ucc_coll_utils.h"
@@ -36,7 +37,47 @@
    7. After the completion of reduce-scatter phase the local result (at non EXTRA
       ranks) will be located in dst buffer at offset the can be commputed by the
       routine from coll_patterns/sra_knomial.h: ucc_sra_kn_get_offset.
+   8. If UCC_COLL_ARGS_FLAG_REDUCED_PRECISION is set for float32 host data then
+      the reduced fragment is converted in place to 16 bit float before the
+      allgather phase and allgather moves 16 bit data. The result is converted
+      back to float32 at the end.
  */
+static ucc_status_t
+ucc_tl_ucp_allreduce_sra_knomial_convert_start(ucc_coll_task_t *task)
+{
+    ucc_coll_args_t *args = &task->bargs.args;
+
+    if (args->dst.info.datatype == UCC_DT_FLOAT32) {
+        ucc_tl_ucp_wire_unpack(args->dst.info.buffer, args->dst.info.buffer,
+                               args->dst.info.count, args->src.info.datatype);
+    } else {
+        ucc_tl_ucp_wire_pack(args->dst.info.buffer, args->dst.info.buffer,
+                             args->dst.info.count, args->dst.info.datatype);
+    }
+    task->status = UCC_OK;
+    return ucc_task_complete(task);
+}
+
+static ucc_status_t
+ucc_tl_ucp_allreduce_sra_knomial_convert_init(ucc_base_coll_args_t *coll_args,
+                                              ucc_base_team_t *team,
+                                              ucc_datatype_t src_dt,
+                                              ucc_datatype_t dst_dt,
+                                              ucc_coll_task_t **task_h)
+{
+    ucc_tl_ucp_task_t *task = ucc_tl_ucp_init_task(coll_args, team);
+
+    if (ucc_unlikely(!task)) {
+        return UCC_ERR_NO_MEMORY;
+    }
+    task->super.bargs.args.src.info.datatype = src_dt;
+    task->super.bargs.args.dst.info.datatype = dst_dt;
+    task->super.post                         =
+        ucc_tl_ucp_allreduce_sra_knomial_convert_start;
+    *task_h = &task->super;
+    return UCC_OK;
+}
+
 static ucc_status_t
 ucc_tl_ucp_allreduce_sra_knomial_frag_start(ucc_coll_task_t *task)
 {
@@ -66,7 +107,11 @@ ucc_tl_ucp_allreduce_sra_knomial_frag_setup(ucc_schedule_pipelined_t *schedule_p
                                                          n_frags, frag_num);
     size_t           offset     = ucc_buffer_block_offset(args->dst.info.count,
                                                           n_frags, frag_num);
+    void            *dst        = PTR_OFFSET(args->dst.info.buffer,
+                                             offset * dt_size);
+    int              ag_id      = (frag->n_tasks > 2) ? 2 : 1;
     ucc_coll_args_t *targs;
+    int              i;
 
     targs = &frag->tasks[0]->bargs.args; /* REDUCE_SCATTER */
     targs->src.info.buffer = PTR_OFFSET(args->src.info.buffer, offset * dt_size);
@@ -74,12 +119,20 @@ ucc_tl_ucp_allreduce_sra_knomial_frag_setup(ucc_schedule_pipelined_t *schedule_p
     targs->dst.info.buffer = PTR_OFFSET(args->dst.info.buffer, offset * dt_size);
     targs->dst.info.count  = frag_count;
 
-    targs = &frag->tasks[1]->bargs.args; /* ALLGATHER */
+    targs = &frag->tasks[ag_id]->bargs.args; /* ALLGATHER */
     targs->src.info.buffer = NULL;
     targs->src.info.count  = 0;
-    targs->dst.info.buffer = PTR_OFFSET(args->dst.info.buffer, offset * dt_size);
+    targs->dst.info.buffer = dst;
     targs->dst.info.count  = frag_count;
 
+    if (ag_id > 1) {
+        /* reduced precision: convert in place before and after allgather */
+        for (i = 1; i < frag->n_tasks; i += 2) {
+            targs = &frag->tasks[i]->bargs.args;
+            targs->dst.info.buffer = dst;
+            targs->dst.info.count  = frag_count;
+        }
+    }
     return UCC_OK;
 }
 
@@ -94,6 +147,9 @@ ucc_tl_ucp_allreduce_sra_knomial_frag_init(ucc_base_coll_args_t *coll_args,
     ucc_memory_type_t    mem_type = coll_args->args.dst.info.mem_type;
     ucc_base_coll_args_t args     = *coll_args;
     ucc_mrange_uint_t   *p        = &tl_team->cfg.allreduce_sra_kn_radix;
+    ucc_datatype_t       wire_dt  = ucc_tl_ucp_reduce_wire_dt(tl_team,
+                                                              &coll_args->args,
+                                                              dtype, mem_type);
     ucc_schedule_t      *schedule;
     ucc_coll_task_t     *task, *rs_task;
     ucc_status_t         status;
@@ -130,16 +186,39 @@ ucc_tl_ucp_allreduce_sra_knomial_frag_init(ucc_base_coll_args_t *coll_args,
                    out, status);
     rs_task = task;
 
+    if (wire_dt != dtype) {
+        UCC_CHECK_GOTO(ucc_tl_ucp_allreduce_sra_knomial_convert_init(
+                           &args, team, dtype, wire_dt, &task),
+                       out, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, task), out, status);
+        UCC_CHECK_GOTO(ucc_task_subscribe_dep(rs_task, task,
+                                              UCC_EVENT_COMPLETED),
+                       out, status);
+        rs_task = task;
+    }
+
     /* 2nd step of allreduce: knomial allgather. 2nd task subscribes
      to completion event of reduce_scatter task. */
-    args.args.mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
-    args.args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+    args.args.mask              |= UCC_COLL_ARGS_FIELD_FLAGS;
+    args.args.flags             |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+    args.args.dst.info.datatype  = wire_dt;
     UCC_CHECK_GOTO(
         ucc_tl_ucp_allgather_knomial_init_r(&args, team, &task, radix), out,
         status);
     UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, task), out, status);
     UCC_CHECK_GOTO(ucc_task_subscribe_dep(rs_task, task, UCC_EVENT_COMPLETED),
                    out, status);
+
+    if (wire_dt != dtype) {
+        rs_task = task;
+        UCC_CHECK_GOTO(ucc_tl_ucp_allreduce_sra_knomial_convert_init(
+                           &args, team, wire_dt, dtype, &task),
+                       out, status);
+        UCC_CHECK_GOTO(ucc_schedule_add_task(schedule, task), out, status);
+        UCC_CHECK_GOTO(ucc_task_subscribe_dep(rs_task, task,
+                                              UCC_EVENT_COMPLETED),
+                       out, status);
+    }
     schedule->super.finalize = ucc_tl_ucp_allreduce_sra_knomial_frag_finalize;
     schedule->super.post     = ucc_tl_ucp_allreduce_sra_knomial_frag_start;
     *frag_p                  = schedule;
@@ -213,6 +292,10 @@ ucc_tl_ucp_allreduce_sra_knomial_init(ucc_base_coll_args_t *coll_args,
     size_t                    max_frag_count;
     ucc_pipeline_params_t     pipeline_params;
 
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        /* active set ranks are mapped by knomial only */
+        return ucc_tl_ucp_allreduce_knomial_init(coll_args, team, task_h);
+    }
     st  = ucc_tl_ucp_get_schedule(tl_team, coll_args,
                                   (ucc_tl_ucp_schedule_t **)&schedule_p);
     if (ucc_unlikely(UCC_OK != st)) {
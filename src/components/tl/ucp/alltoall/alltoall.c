@@ -63,6 +63,9 @@ ucc_status_t ucc_tl_ucp_alltoall_pairwise_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t       status;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_alltoall_pairwise_init, task_h);
+
     ALLTOALL_TASK_CHECK(coll_args->args, tl_team);
     task                 = ucc_tl_ucp_init_task(coll_args, team);
     *task_h              = &task->super;
@@ -79,6 +82,11 @@ ucc_status_t ucc_tl_ucp_alltoall_onesided_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t       status;
 
+    if (ucc_tl_ucp_coll_args_is_generic_dt(&coll_args->args)) {
+        /* remote buffers are accessed directly, can't be packed */
+        status = UCC_ERR_NOT_SUPPORTED;
+        goto out;
+    }
     ALLTOALL_TASK_CHECK(coll_args->args, tl_team);
 
     if (!(coll_args->args.mask & UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER)) {
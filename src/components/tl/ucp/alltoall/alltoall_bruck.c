@@ -11,7 +11,6 @@
 #include "components/mc/ucc_mc.h"
 #include "coll_patterns/bruck_alltoall.h"
 
-#define RADIX 2
 #define SAVE_STATE(_phase)                                                     \
     do {                                                                       \
         task->alltoall_bruck.phase = _phase;                                   \
@@ -23,69 +22,67 @@ enum {
     PHASE_BCOPY
 };
 
-static inline int msb_pos_for_level(unsigned int nthbit, ucc_rank_t number)
-{
-
-    int msb_set = -1;
-    unsigned int i;
+/* Radix-k Bruck alltoall.
 
-    for (i = 0; i < nthbit - 1; i++) {
-        if (1 & number >> i) {
-            msb_set = i;
-        }
-    }
+   Block j (0 <= j < tsize) of rank r initially holds the src data destined
+   to rank (r - j) % tsize. At the step (step = radix^level, digit d) every
+   block whose level-th base-radix digit equals d is sent to rank
+   (r - d * step) % tsize. All radix - 1 digits of a level are exchanged
+   concurrently. After the last step block j holds the data received from
+   rank (r + j) % tsize, so blocks that do not move anymore are received
+   directly at their final dst offset and no inverse rotation is needed.
 
-    return msb_set;
-}
+   Blocks sent at the step (step, d), in increasing j order, are
+   j = hi * step * radix + d * step + lo, lo < step. The ones with hi == 0
+   reach their final position, the rest are kept in the scratch region of
+   the step to be forwarded on the following levels. */
 
-static inline int find_seg_index(ucc_rank_t seg_index, int level,
-                                 int nsegs_per_rblock)
+/* Number of blocks j < tsize sent at the step (step, digit) */
+static inline ucc_rank_t bruck_step_nblocks(ucc_rank_t tsize, uint32_t radix,
+                                            ucc_rank_t step, uint32_t digit)
 {
-    int block, blockseg;
-
-    if (0 == seg_index) {
-        return -1;
-    }
-
-    block = msb_pos_for_level(level, seg_index);
+    ucc_rank_t span = step * radix;
+    ucc_rank_t rem  = tsize % span;
 
-    if (block < 0) {
-        return -1;
-    }
+    return (tsize / span) * step +
+           ((rem > digit * step) ? ucc_min(rem - digit * step, step) : 0);
+}
 
-    /* remove block bit from seg_index */
-    blockseg = ((seg_index >> (block + 1)) << block) |
-                (seg_index & UCC_MASK(block));
-    return block * nsegs_per_rblock + blockseg;
+/* Number of blocks that reach their final position at the step */
+static inline ucc_rank_t bruck_step_nfinal(ucc_rank_t tsize, ucc_rank_t step,
+                                           uint32_t digit)
+{
+    return ucc_min(step, tsize - digit * step);
 }
 
-ucc_status_t ucc_tl_ucp_alltoall_bruck_backward_rotation(void *dst,
-                                                         void *src,
-                                                         ucc_rank_t trank,
-                                                         ucc_rank_t tsize,
-                                                         size_t seg_size)
+/* Current location of block j before the step "step" */
+static inline void *bruck_block_ptr(ucc_tl_ucp_task_t *task, ucc_rank_t j,
+                                    ucc_rank_t step, ucc_rank_t trank,
+                                    ucc_rank_t tsize, size_t seg_size)
 {
-    ucc_status_t st;
-    ucc_rank_t index, level, nsegs_per_rblock;
-    size_t snd_offset;
-    int send_buffer_index;
-
-    level = lognum(tsize);
-    nsegs_per_rblock = tsize / 2;
-    for (index = 1; index < tsize; index++) {
-        send_buffer_index = find_seg_index(index, level + 1, nsegs_per_rblock);
-        ucc_assert(send_buffer_index >= 0);
-        snd_offset = send_buffer_index * seg_size;
-        st = ucc_mc_memcpy(PTR_OFFSET(dst, seg_size *
-                                      ((trank - index + tsize) % tsize)),
-                           PTR_OFFSET(src, snd_offset), seg_size,
-                           UCC_MEMORY_TYPE_HOST, UCC_MEMORY_TYPE_HOST);
-        if (ucc_unlikely(st != UCC_OK)) {
-            return st;
+    uint32_t   radix = task->alltoall_bruck.radix;
+    ucc_rank_t last  = 0;
+    int        level = -1;
+    int        l;
+    ucc_rank_t p;
+    uint32_t   d;
+    size_t     index;
+
+    for (l = 0, p = 1; p < step; l++, p *= radix) {
+        if ((j / p) % radix) {
+            level = l;
+            last  = p;
         }
     }
-
-    return UCC_OK;
+    if (level < 0) {
+        return PTR_OFFSET(task->alltoall_bruck.src,
+                          ((trank - j + tsize) % tsize) * seg_size);
+    }
+    d     = (j / last) % radix;
+    index = (j / (last * radix)) * last + j % last - last;
+    return PTR_OFFSET(task->alltoall_bruck.storage,
+                      ((level * (radix - 1) + d - 1) *
+                       task->alltoall_bruck.stride + index) * seg_size);
 }
 
 ucc_status_t ucc_tl_ucp_alltoall_bruck_finalize(ucc_coll_task_t *coll_task)
@@ -106,24 +103,107 @@ ucc_status_t ucc_tl_ucp_alltoall_bruck_finalize(ucc_coll_task_t *coll_task)
     return global_st;
 }
 
+/* Packs the blocks of the step (step, digit) and posts the exchange.
+   Both sides split the message at the same boundaries: the final blocks
+   that wrap around the end of the receiver's dst buffer and the blocks
+   stored for the next levels. */
+static ucc_status_t ucc_tl_ucp_alltoall_bruck_post_step(ucc_tl_ucp_task_t *task,
+                                                        ucc_rank_t level,
+                                                        ucc_rank_t step,
+                                                        uint32_t   digit,
+                                                        size_t     seg_size)
+{
+    ucc_tl_ucp_team_t *team     = TASK_TEAM(task);
+    ucc_rank_t         trank    = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         tsize    = UCC_TL_TEAM_SIZE(team);
+    uint32_t           radix    = task->alltoall_bruck.radix;
+    ucc_rank_t         nblocks  = bruck_step_nblocks(tsize, radix, step,
+                                                     digit);
+    ucc_rank_t         nfinal   = bruck_step_nfinal(tsize, step, digit);
+    ucc_rank_t         sendto   = get_bruck_recv_peer(trank, tsize, step,
+                                                      digit);
+    ucc_rank_t         recvfrom = get_bruck_send_peer(trank, tsize, step,
+                                                      digit);
+    void              *packbuf  = PTR_OFFSET(task->alltoall_bruck.pack,
+                                             (digit - 1) * seg_size *
+                                             task->alltoall_bruck.max_blocks);
+    void              *storage  = PTR_OFFSET(task->alltoall_bruck.storage,
+                                             (level * (radix - 1) + digit - 1) *
+                                             task->alltoall_bruck.stride *
+                                             seg_size);
+    ucc_rank_t         j, n, s_wrap, r_wrap;
+    ucc_status_t       status;
+
+    n = 0;
+    for (j = digit * step; j < tsize; j = GET_NEXT_BRUCK_NUM(j, radix, step)) {
+        status = ucc_mc_memcpy(PTR_OFFSET(packbuf, n * seg_size),
+                               bruck_block_ptr(task, j, step, trank, tsize,
+                                               seg_size),
+                               seg_size, UCC_MEMORY_TYPE_HOST,
+                               UCC_MEMORY_TYPE_HOST);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+        n++;
+    }
+    ucc_assert(n == nblocks);
+
+    /* receiver of my data places its final blocks starting at offset trank,
+       my final blocks start at offset recvfrom */
+    s_wrap = ucc_min(nfinal, tsize - trank);
+    r_wrap = ucc_min(nfinal, tsize - recvfrom);
+    UCPCHECK_GOTO(ucc_tl_ucp_send_nb(packbuf, s_wrap * seg_size,
+                                     UCC_MEMORY_TYPE_HOST, sendto, team, task),
+                  task, out);
+    UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(PTR_OFFSET(task->alltoall_bruck.dst,
+                                                recvfrom * seg_size),
+                                     r_wrap * seg_size, UCC_MEMORY_TYPE_HOST,
+                                     recvfrom, team, task),
+                  task, out);
+    if (nfinal > s_wrap) {
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(PTR_OFFSET(packbuf, s_wrap * seg_size),
+                                         (nfinal - s_wrap) * seg_size,
+                                         UCC_MEMORY_TYPE_HOST, sendto, team,
+                                         task),
+                      task, out);
+    }
+    if (nfinal > r_wrap) {
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(task->alltoall_bruck.dst,
+                                         (nfinal - r_wrap) * seg_size,
+                                         UCC_MEMORY_TYPE_HOST, recvfrom, team,
+                                         task),
+                      task, out);
+    }
+    if (nblocks > nfinal) {
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(PTR_OFFSET(packbuf, nfinal * seg_size),
+                                         (nblocks - nfinal) * seg_size,
+                                         UCC_MEMORY_TYPE_HOST, sendto, team,
+                                         task),
+                      task, out);
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(storage, (nblocks - nfinal) * seg_size,
+                                         UCC_MEMORY_TYPE_HOST, recvfrom, team,
+                                         task),
+                      task, out);
+    }
+    return UCC_OK;
+out:
+    return task->super.status;
+}
+
 void ucc_tl_ucp_alltoall_bruck_progress(ucc_coll_task_t *coll_task)
 {
-    ucc_tl_ucp_task_t *task       = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
-    ucc_tl_ucp_team_t *team       = TASK_TEAM(task);
-    ucc_rank_t         trank      = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         tsize      = UCC_TL_TEAM_SIZE(team);
-    ucc_coll_args_t   *args       = &TASK_ARGS(task);
-    void              *scratch    = task->alltoall_bruck.scratch_mc_header->addr;
-    void              *mergebuf   = task->alltoall_bruck.dst;
-    const ucc_rank_t   nrecv_segs = tsize / 2;
-    const size_t       seg_size   = ucc_dt_size(args->src.info.datatype) *
-                                    args->src.info.count / tsize;
-    ucc_memory_type_t  smtype     = args->src.info.mem_type;
-    ucc_memory_type_t  dmtype     = args->dst.info.mem_type;
-    ucc_rank_t sendto, recvfrom, step, index;
-    void *data;
-    ucc_rank_t level, snd_count;
-    int send_buffer_index;
+    ucc_tl_ucp_task_t *task     = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team     = TASK_TEAM(task);
+    ucc_rank_t         trank    = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         tsize    = UCC_TL_TEAM_SIZE(team);
+    ucc_coll_args_t   *args     = &TASK_ARGS(task);
+    uint32_t           radix    = task->alltoall_bruck.radix;
+    const size_t       seg_size = ucc_dt_size(args->src.info.datatype) *
+                                  args->src.info.count / tsize;
+    ucc_memory_type_t  smtype   = args->src.info.mem_type;
+    ucc_memory_type_t  dmtype   = args->dst.info.mem_type;
+    ucc_rank_t         step;
+    uint32_t           digit;
     ucc_status_t status;
     ucc_ee_executor_t *exec;
     ucc_ee_executor_task_args_t eargs;
@@ -139,63 +219,34 @@ void ucc_tl_ucp_alltoall_bruck_progress(ucc_coll_task_t *coll_task)
         goto out;
     }
 
-    step = 1 << (task->alltoall_bruck.iteration - 1);
-    while (step < tsize) {
-        level = task->alltoall_bruck.iteration - 1;
-        sendto = get_bruck_send_peer(trank, tsize, step, 1);
-        recvfrom = get_bruck_recv_peer(trank, tsize, step, 1);
-
-        snd_count = 0;
-        for (index = get_bruck_step_start(step, 1);
-             index <= get_bruck_step_finish(tsize - 1, RADIX, 1, step);
-             index = GET_NEXT_BRUCK_NUM(index, RADIX, step)) {
-            send_buffer_index = find_seg_index(index, level + 1, nrecv_segs);
-            if (send_buffer_index == -1) {
-                data = PTR_OFFSET(task->alltoall_bruck.src,
-                                  ((index + trank) % tsize) * seg_size);
-            } else {
-                data = PTR_OFFSET(scratch, send_buffer_index * seg_size);
-            }
-            status = ucc_mc_memcpy(PTR_OFFSET(mergebuf, seg_size * snd_count),
-                                   data, seg_size, UCC_MEMORY_TYPE_HOST,
-                                   UCC_MEMORY_TYPE_HOST);
-            if (ucc_unlikely(UCC_OK != status)) {
+    status = ucc_mc_memcpy(PTR_OFFSET(task->alltoall_bruck.dst,
+                                      trank * seg_size),
+                           PTR_OFFSET(task->alltoall_bruck.src,
+                                      trank * seg_size),
+                           seg_size, UCC_MEMORY_TYPE_HOST,
+                           UCC_MEMORY_TYPE_HOST);
+    if (ucc_unlikely(status != UCC_OK)) {
+        task->super.status = status;
+        return;
+    }
+
+    while (task->alltoall_bruck.step < tsize) {
+        step = task->alltoall_bruck.step;
+        for (digit = 1; digit < radix && digit * step < tsize; digit++) {
+            status = ucc_tl_ucp_alltoall_bruck_post_step(
+                task, task->alltoall_bruck.iteration, step, digit, seg_size);
+            if (ucc_unlikely(status != UCC_OK)) {
                 task->super.status = status;
                 return;
             }
-            snd_count++;
         }
-        data = PTR_OFFSET(scratch, level * nrecv_segs * seg_size);
-        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(mergebuf, snd_count * seg_size,
-                                         UCC_MEMORY_TYPE_HOST, sendto, team,
-                                         task),
-                      task, out);
-        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(data, snd_count * seg_size,
-                                         UCC_MEMORY_TYPE_HOST, recvfrom, team,
-                                         task),
-                      task, out);
 ALLTOALL_BRUCK_PHASE_SENDRECV:
         if (ucc_tl_ucp_test(task) == UCC_INPROGRESS) {
             SAVE_STATE(PHASE_SENDRECV);
             return;
         }
         task->alltoall_bruck.iteration++;
-        step = 1 << (task->alltoall_bruck.iteration - 1);
-    }
-
-    status = ucc_mc_memcpy(PTR_OFFSET(task->alltoall_bruck.dst, trank * seg_size),
-                           PTR_OFFSET(task->alltoall_bruck.src, trank * seg_size),
-                           seg_size, UCC_MEMORY_TYPE_HOST, UCC_MEMORY_TYPE_HOST);
-    if (ucc_unlikely(status != UCC_OK)) {
-        task->super.status = status;
-        return;
-    }
-    status = ucc_tl_ucp_alltoall_bruck_backward_rotation(mergebuf, scratch,
-                                                         trank, tsize,
-                                                         seg_size);
-    if (ucc_unlikely(status != UCC_OK)) {
-        task->super.status = status;
-        return;
+        task->alltoall_bruck.step *= radix;
     }
 
     if (smtype != UCC_MEMORY_TYPE_HOST || dmtype != UCC_MEMORY_TYPE_HOST) {
@@ -207,7 +258,7 @@ ALLTOALL_BRUCK_PHASE_SENDRECV:
         }
 
         eargs.task_type = UCC_EE_EXECUTOR_TASK_COPY;
-        eargs.copy.src  = mergebuf;
+        eargs.copy.src  = task->alltoall_bruck.dst;
         eargs.copy.dst  = args->dst.info.buffer;
         eargs.copy.len  = seg_size * tsize;
         status = ucc_ee_executor_task_post(exec, &eargs,
@@ -237,7 +288,8 @@ ucc_status_t ucc_tl_ucp_alltoall_bruck_start(ucc_coll_task_t *coll_task)
     ucc_status_t status;
 
     ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
-    task->alltoall_bruck.iteration = 1;
+    task->alltoall_bruck.iteration = 0;
+    task->alltoall_bruck.step      = 1;
     task->alltoall_bruck.phase     = PHASE_MERGE;
     task->alltoall_bruck.etask     = NULL;
 
@@ -269,22 +321,48 @@ ucc_status_t ucc_tl_ucp_alltoall_bruck_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_team_t *tl_team  = ucc_derived_of(team, ucc_tl_ucp_team_t);
     ucc_rank_t         tsize    = UCC_TL_TEAM_SIZE(tl_team);
     ucc_coll_args_t   *args     = &coll_args->args;
-    size_t             ssize    = ucc_dt_size(args->src.info.datatype) *
-                                  args->src.info.count;
-    size_t             seg_size = ssize / tsize;
     int                is_bcopy = 0;
-    size_t scratch_size;
+    size_t ssize, seg_size, scratch_size, storage_size, pack_size;
+    ucc_rank_t step, nblocks, nlevels, stride, max_blocks;
+    uint32_t radix, digit;
     ucc_tl_ucp_task_t *task;
     ucc_status_t status;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_alltoall_bruck_init, task_h);
+
     ALLTOALL_TASK_CHECK(coll_args->args, tl_team);
+    ssize                = ucc_dt_size(args->src.info.datatype) *
+                           args->src.info.count;
+    seg_size             = ssize / tsize;
+    radix                = ucc_tl_ucp_get_radix_from_range(
+                               tl_team, ssize, args->src.info.mem_type,
+                               &tl_team->cfg.alltoall_bruck_radix, 2);
+    radix                = ucc_max(2, ucc_min(radix, tsize));
     task                 = ucc_tl_ucp_init_task(coll_args, team);
     task->super.post     = ucc_tl_ucp_alltoall_bruck_start;
     task->super.progress = ucc_tl_ucp_alltoall_bruck_progress;
     task->super.finalize = ucc_tl_ucp_alltoall_bruck_finalize;
     task->super.flags    |= UCC_COLL_TASK_FLAG_EXECUTOR;
 
-    scratch_size = lognum(tsize) * ucc_div_round_up(tsize, 2) * seg_size;
+    /* storage for non final blocks of every step except the last level and
+       one pack buffer per digit */
+    nlevels    = 0;
+    stride     = 0;
+    max_blocks = 0;
+    for (step = 1; step < tsize; step *= radix) {
+        for (digit = 1; digit < radix && digit * step < tsize; digit++) {
+            nblocks    = bruck_step_nblocks(tsize, radix, step, digit);
+            max_blocks = ucc_max(max_blocks, nblocks);
+            stride     = ucc_max(stride, nblocks -
+                                 bruck_step_nfinal(tsize, step, digit));
+        }
+        nlevels++;
+    }
+    storage_size = (nlevels ? nlevels - 1 : 0) * (radix - 1) * stride *
+                   seg_size;
+    pack_size    = (radix - 1) * max_blocks * seg_size;
+    scratch_size = storage_size + pack_size;
     if ((coll_args->args.src.info.mem_type != UCC_MEMORY_TYPE_HOST) ||
         (coll_args->args.dst.info.mem_type != UCC_MEMORY_TYPE_HOST)) {
         is_bcopy = 1;
@@ -298,11 +376,18 @@ ucc_status_t ucc_tl_ucp_alltoall_bruck_init(ucc_base_coll_args_t *coll_args,
         ucc_tl_ucp_coll_finalize(&task->super);
         return status;
     }
-
+    ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), scratch_size);
+
+    task->alltoall_bruck.radix      = radix;
+    task->alltoall_bruck.stride     = stride;
+    task->alltoall_bruck.max_blocks = max_blocks;
+    task->alltoall_bruck.storage    =
+        task->alltoall_bruck.scratch_mc_header->addr;
+    task->alltoall_bruck.pack       =
+        PTR_OFFSET(task->alltoall_bruck.storage, storage_size);
     if (is_bcopy) {
         task->alltoall_bruck.src =
-            PTR_OFFSET(task->alltoall_bruck.scratch_mc_header->addr,
-                       lognum(tsize) * ucc_div_round_up(tsize, 2) * seg_size);
+            PTR_OFFSET(task->alltoall_bruck.pack, pack_size);
         task->alltoall_bruck.dst =
             PTR_OFFSET(task->alltoall_bruck.src, ssize);
     } else {
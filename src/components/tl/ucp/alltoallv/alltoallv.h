@@ -9,6 +9,7 @@
 
 #include "../tl_ucp.h"
 #include "../tl_ucp_coll.h"
+#include "../tl_ucp_dt_generic.h"
 
 enum {
     UCC_TL_UCP_ALLTOALLV_ALG_PAIRWISE,
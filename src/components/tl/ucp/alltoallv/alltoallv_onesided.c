@@ -78,6 +78,11 @@ ucc_status_t ucc_tl_ucp_alltoallv_onesided_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t       status;
 
+    if (ucc_tl_ucp_coll_args_is_generic_dt(&coll_args->args)) {
+        /* remote buffers are accessed directly, can't be packed */
+        status = UCC_ERR_NOT_SUPPORTED;
+        goto out;
+    }
     ALLTOALLV_TASK_CHECK(coll_args->args, tl_team);
     if (!(coll_args->args.mask & UCC_COLL_ARGS_FIELD_GLOBAL_WORK_BUFFER)) {
         tl_error(UCC_TL_TEAM_LIB(tl_team),
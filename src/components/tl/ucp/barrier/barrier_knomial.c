@@ -21,7 +21,7 @@ void ucc_tl_ucp_barrier_knomial_progress(ucc_coll_task_t *coll_task)
 {
     ucc_tl_ucp_task_t     *task       = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
     ucc_tl_ucp_team_t     *team       = TASK_TEAM(task);
-    ucc_rank_t             rank       = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t             rank       = task->subset.myrank;
     ucc_kn_radix_t         radix      = task->barrier.p.radix;
     uint8_t                node_type  = task->barrier.p.node_type;
     ucc_knomial_pattern_t *p          = &task->barrier.p;
@@ -32,7 +32,8 @@ void ucc_tl_ucp_barrier_knomial_progress(ucc_coll_task_t *coll_task)
 
     UCC_KN_GOTO_PHASE(task->barrier.phase);
     if (KN_NODE_EXTRA == node_type) {
-        peer = ucc_knomial_pattern_get_proxy(p, rank);
+        peer = ucc_ep_map_eval(task->subset.map,
+                               ucc_knomial_pattern_get_proxy(p, rank));
         UCPCHECK_GOTO(ucc_tl_ucp_send_nb(NULL, 0, mtype, peer, team, task),
                       task, out);
         UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(NULL, 0, mtype, peer, team, task),
@@ -40,7 +41,8 @@ void ucc_tl_ucp_barrier_knomial_progress(ucc_coll_task_t *coll_task)
     }
 
     if (KN_NODE_PROXY == node_type) {
-        peer = ucc_knomial_pattern_get_extra(p, rank);
+        peer = ucc_ep_map_eval(task->subset.map,
+                               ucc_knomial_pattern_get_extra(p, rank));
         UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(NULL, 0, mtype, peer, team, task),
                       task, out);
     }
@@ -60,6 +62,7 @@ UCC_KN_PHASE_EXTRA:
             peer = ucc_knomial_pattern_get_loop_peer(p, rank, loop_step);
             if (peer == UCC_KN_PEER_NULL)
                 continue;
+            peer = ucc_ep_map_eval(task->subset.map, peer);
             UCPCHECK_GOTO(ucc_tl_ucp_send_nb(NULL, 0, mtype, peer, team, task),
                           task, out);
         }
@@ -68,6 +71,7 @@ UCC_KN_PHASE_EXTRA:
             peer = ucc_knomial_pattern_get_loop_peer(p, rank, loop_step);
             if (peer == UCC_KN_PEER_NULL)
                 continue;
+            peer = ucc_ep_map_eval(task->subset.map, peer);
             UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(NULL, 0, mtype, peer, team, task),
                           task, out);
         }
@@ -79,7 +83,8 @@ UCC_KN_PHASE_EXTRA:
         ucc_knomial_pattern_next_iteration(p);
     }
     if (KN_NODE_PROXY == node_type) {
-        peer = ucc_knomial_pattern_get_extra(p, rank);
+        peer = ucc_ep_map_eval(task->subset.map,
+                               ucc_knomial_pattern_get_extra(p, rank));
         UCPCHECK_GOTO(ucc_tl_ucp_send_nb(NULL, 0, mtype, peer, team, task),
                       task, out);
         goto UCC_KN_PHASE_PROXY;
@@ -105,8 +110,8 @@ ucc_status_t ucc_tl_ucp_barrier_knomial_start(ucc_coll_task_t *coll_task)
 {
     ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
     ucc_tl_ucp_team_t *team = TASK_TEAM(task);
-    ucc_rank_t         rank = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         size = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         rank = task->subset.myrank;
+    ucc_rank_t         size = (ucc_rank_t)task->subset.map.ep_num;
 
     UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_barrier_kn_start", 0);
     ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
@@ -32,8 +32,11 @@ ucc_status_t ucc_tl_ucp_bcast_init(ucc_tl_ucp_task_t *task)
     ucc_tl_ucp_team_t *team      = TASK_TEAM(task);
     ucc_rank_t         team_size = (ucc_rank_t)task->subset.map.ep_num;
 
+    ucc_tl_ucp_task_reorder_ranks(task);
     task->bcast_kn.radix =
         ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.bcast_kn_radix, team_size);
+    task->bcast_kn.root  =
+        ucc_tl_ucp_task_subset_root(task, (ucc_rank_t)TASK_ARGS(task).root);
 
     task->super.post     = ucc_tl_ucp_bcast_knomial_start;
     task->super.progress = ucc_tl_ucp_bcast_knomial_progress;
@@ -47,6 +50,9 @@ ucc_status_t ucc_tl_ucp_bcast_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_tl_ucp_task_t *task;
     ucc_status_t       status;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_bcast_knomial_init, task_h);
+
     task    = ucc_tl_ucp_init_task(coll_args, team);
     status  = ucc_tl_ucp_bcast_init(task);
     *task_h = &task->super;
@@ -254,6 +254,9 @@ ucc_status_t ucc_tl_ucp_bcast_dbt_init(
     ucc_tl_ucp_task_t *task;
     ucc_rank_t         rank, size;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_bcast_dbt_init, task_h);
+
     task                 = ucc_tl_ucp_init_task(coll_args, team);
     task->super.post     = ucc_tl_ucp_bcast_dbt_start;
     task->super.progress = ucc_tl_ucp_bcast_dbt_progress;
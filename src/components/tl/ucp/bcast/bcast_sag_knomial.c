@@ -84,6 +84,9 @@ ucc_tl_ucp_bcast_sag_knomial_init(ucc_base_coll_args_t *coll_args,
     ucc_status_t         status;
     ucc_kn_radix_t       radix, cfg_radix;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team,
+                                ucc_tl_ucp_bcast_sag_knomial_init, task_h);
+
     if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
         /* ActiveSets currently are only supported with KN alg */
         return ucc_tl_ucp_bcast_knomial_init(coll_args, team, task_h);
@@ -36,6 +36,7 @@ ucc_status_t ucc_tl_ucp_fanin_init(ucc_tl_ucp_task_t *task)
     task->super.progress  = ucc_tl_ucp_reduce_knomial_progress;
     task->reduce_kn.radix =
         ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.fanin_kn_radix, team_size);
+    task->reduce_kn.root  = (ucc_rank_t)TASK_ARGS(task).root;
 
     CALC_KN_TREE_DIST(team_size, task->reduce_kn.radix,
                       task->reduce_kn.max_dist);
@@ -28,6 +28,7 @@ ucc_status_t ucc_tl_ucp_fanout_init(ucc_tl_ucp_task_t *task)
     TASK_ARGS(task).src.info.datatype = UCC_DT_INT8;
     task->bcast_kn.radix =
         ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.fanout_kn_radix, team_size);
+    task->bcast_kn.root  = (ucc_rank_t)TASK_ARGS(task).root;
 
     task->super.post      = ucc_tl_ucp_bcast_knomial_start;
     task->super.progress  = ucc_tl_ucp_bcast_knomial_progress;
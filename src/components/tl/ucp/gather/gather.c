@@ -20,7 +20,7 @@ ucc_base_coll_alg_info_t
 ucc_status_t ucc_tl_ucp_gather_init(ucc_tl_ucp_task_t *task)
 {
     ucc_tl_ucp_team_t *team    = TASK_TEAM(task);
-    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         size    = (ucc_rank_t)task->subset.map.ep_num;
     ucc_kn_radix_t radix;
 
     radix = ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.gather_kn_radix, size);
@@ -35,9 +35,10 @@ void ucc_tl_ucp_gather_knomial_progress(ucc_coll_task_t *coll_task)
     ucc_tl_ucp_task_t     *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
     ucc_coll_args_t       *args      = &TASK_ARGS(task);
     ucc_tl_ucp_team_t     *team      = TASK_TEAM(task);
-    ucc_rank_t             tsize     = UCC_TL_TEAM_SIZE(team);
-    ucc_rank_t             rank      = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t             root      = (ucc_rank_t)args->root;
+    ucc_rank_t             tsize     = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_rank_t             rank      = task->subset.myrank;
+    ucc_rank_t             root      = ucc_tl_ucp_task_subset_root(task,
+                                                                   args->root);
     uint32_t               radix     = task->gather_kn.radix;
     ucc_rank_t             vrank     = VRANK(rank, root, tsize);
     ucc_memory_type_t      mtype     = args->src.info.mem_type;
@@ -87,7 +88,10 @@ UCC_GATHER_KN_PHASE_INIT:
                                                     task->gather_kn.dist);
                     }
                     UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(scratch_offset,
-                                                     msg_size, mtype, peer,
+                                                     msg_size, mtype,
+                                                     ucc_ep_map_eval(
+                                                         task->subset.map,
+                                                         peer),
                                                      team, task),
                                   task, out);
                 } else {
@@ -108,7 +112,10 @@ UCC_GATHER_KN_PHASE_INIT:
                         }
                         UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(scratch_offset,
                                                          msg_size, mtype,
-                                                         peer, team, task),
+                                                         ucc_ep_map_eval(
+                                                             task->subset.map,
+                                                             peer),
+                                                         team, task),
                                         task, out);
                     } else {
                         /*
@@ -118,12 +125,18 @@ UCC_GATHER_KN_PHASE_INIT:
                         msg_size = data_size * (tsize - peer);
                         UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(scratch_offset,
                                                          msg_size, mtype,
-                                                         peer, team, task),
+                                                         ucc_ep_map_eval(
+                                                             task->subset.map,
+                                                             peer),
+                                                         team, task),
                                       task, out);
                         msg_size = data_size * (num_blocks - (tsize - peer));
                         UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(task->gather_kn.scratch,
                                                          msg_size, mtype,
-                                                         peer, team, task),
+                                                         ucc_ep_map_eval(
+                                                             task->subset.map,
+                                                             peer),
+                                                         team, task),
                                       task, out);
                     }
                 }
@@ -163,6 +176,8 @@ UCC_GATHER_KN_PHASE_INIT:
             if ((ct == UCC_COLL_TYPE_REDUCE) ||
                 (root_at_level != root) ||
                 (num_blocks <= tsize - rank)) {
+                root_at_level = ucc_ep_map_eval(task->subset.map,
+                                                root_at_level);
                 ucc_kn_g_pattern_peer_seg(vrank, p, &peer_seg_count,
                                           &peer_seg_offset);
                 msg_size = peer_seg_count * dt_size;
@@ -178,6 +193,8 @@ UCC_GATHER_KN_PHASE_INIT:
                                 task, out);
             } else {
                 // need to split in this case due to root and tree topology
+                root_at_level = ucc_ep_map_eval(task->subset.map,
+                                                root_at_level);
                 msg_size = data_size * (tsize - rank);
                 UCPCHECK_GOTO(ucc_tl_ucp_send_nb(task->gather_kn.scratch,
                                                  msg_size, mtype,
@@ -214,9 +231,9 @@ ucc_status_t ucc_tl_ucp_gather_knomial_start(ucc_coll_task_t *coll_task)
     ucc_tl_ucp_task_t *task  = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
     ucc_coll_args_t   *args  = &TASK_ARGS(task);
     ucc_tl_ucp_team_t *team  = TASK_TEAM(task);
-    ucc_rank_t         root  = (ucc_rank_t)args->root;
-    ucc_rank_t         trank = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root  = ucc_tl_ucp_task_subset_root(task, args->root);
+    ucc_rank_t         trank = task->subset.myrank;
+    ucc_rank_t         size  = (ucc_rank_t)task->subset.map.ep_num;
 
     if (root == trank && UCC_IS_INPLACE(*args)) {
         args->src.info       = args->dst.info;
@@ -259,10 +276,10 @@ ucc_status_t ucc_tl_ucp_gather_knomial_init_common(ucc_tl_ucp_task_t *task,
                                                    ucc_kn_radix_t radix)
 {
     ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
-    ucc_rank_t         trank  = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         tsize  = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         trank  = task->subset.myrank;
+    ucc_rank_t         tsize  = (ucc_rank_t)task->subset.map.ep_num;
     ucc_coll_args_t   *args   = &TASK_ARGS(task);
-    ucc_rank_t         root   = args->root;
+    ucc_rank_t         root   = ucc_tl_ucp_task_subset_root(task, args->root);
     ucc_rank_t         vrank  = VRANK(trank, root, tsize);
     ucc_status_t       status = UCC_OK;
     ucc_memory_type_t  mtype;
@@ -271,7 +288,7 @@ ucc_status_t ucc_tl_ucp_gather_knomial_init_common(ucc_tl_ucp_task_t *task,
     uint32_t           buffer_size;
     int                is_leaf;
 
-    if (UCC_IS_ROOT(*args, trank)) {
+    if (trank == root) {
         count = args->dst.info.count;
         dt    = args->dst.info.datatype;
         mtype = args->dst.info.mem_type;
@@ -302,6 +319,11 @@ ucc_status_t ucc_tl_ucp_gather_knomial_init_common(ucc_tl_ucp_task_t *task,
             buffer_size = calc_buffer_size(vrank, task->gather_kn.radix, tsize);
             status      = ucc_mc_alloc(&task->gather_kn.scratch_mc_header,
                                        buffer_size * data_size, mtype);
+            if (ucc_unlikely(status != UCC_OK)) {
+                return status;
+            }
+            ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task),
+                                       buffer_size * data_size);
             task->gather_kn.scratch = task->gather_kn.scratch_mc_header->addr;
         }
     }
@@ -314,7 +336,6 @@ ucc_status_t ucc_tl_ucp_gather_knomial_init(ucc_base_coll_args_t *coll_args,
                                             ucc_coll_task_t **task_h)
 {
     ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
-    ucc_rank_t         tsize    = UCC_TL_TEAM_SIZE(tl_team);
     ucc_tl_ucp_task_t *task;
     ucc_status_t status;
     ucc_kn_radix_t radix;
@@ -324,7 +345,8 @@ ucc_status_t ucc_tl_ucp_gather_knomial_init(ucc_base_coll_args_t *coll_args,
         return UCC_ERR_NO_MEMORY;
     }
 
-    radix = ucc_min(UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.gather_kn_radix, tsize);
+    radix = ucc_min(UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.gather_kn_radix,
+                    (ucc_rank_t)task->subset.map.ep_num);
 
     status = ucc_tl_ucp_gather_knomial_init_common(task, radix);
     if (ucc_unlikely(status != UCC_OK)) {
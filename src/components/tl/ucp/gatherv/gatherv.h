@@ -12,12 +12,36 @@
 
 enum {
     UCC_TL_UCP_GATHERV_ALG_LINEAR,
+    UCC_TL_UCP_GATHERV_ALG_KNOMIAL,
     UCC_TL_UCP_GATHERV_ALG_LAST
 };
 
 extern ucc_base_coll_alg_info_t
              ucc_tl_ucp_gatherv_algs[UCC_TL_UCP_GATHERV_ALG_LAST + 1];
 
+static inline int ucc_tl_ucp_gatherv_alg_from_str(const char *str)
+{
+    int i;
+    for (i = 0; i < UCC_TL_UCP_GATHERV_ALG_LAST; i++) {
+        if (0 == strcasecmp(str, ucc_tl_ucp_gatherv_algs[i].name)) {
+            break;
+        }
+    }
+    return i;
+}
+
+ucc_status_t ucc_tl_ucp_gatherv_linear_init_common(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_gatherv_linear_init(ucc_base_coll_args_t *coll_args,
+                                            ucc_base_team_t      *team,
+                                            ucc_coll_task_t     **task_h);
+
+ucc_status_t ucc_tl_ucp_gatherv_knomial_init_common(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_gatherv_knomial_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t      *team,
+                                             ucc_coll_task_t     **task_h);
+
 ucc_status_t ucc_tl_ucp_gatherv_init(ucc_tl_ucp_task_t *task);
 
 #endif
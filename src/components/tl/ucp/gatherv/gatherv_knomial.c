@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "gatherv.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+
+/* Only root knows the counts of all ranks, so every non-root interior node
+   of the tree first collects the sizes of its children subtrees, reports
+   the sum to its parent and then gathers subtree data contiguously in
+   vrank order. Root receives O(log(size)) messages, each of them directly
+   into dst if the subtree data is contiguous there. */
+enum {
+    UCC_GATHERV_KN_PHASE_SIZES, /* children subtree sizes are received */
+    UCC_GATHERV_KN_PHASE_DATA,  /* children subtree data are received */
+    UCC_GATHERV_KN_PHASE_SEND   /* subtree data are sent to parent */
+};
+
+static ucc_status_t
+ucc_tl_ucp_gatherv_knomial_root_post(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team    = TASK_TEAM(task);
+    ucc_coll_args_t   *args    = &TASK_ARGS(task);
+    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         rank    = UCC_TL_TEAM_RANK(team);
+    uint32_t           radix   = task->gatherv_kn.radix;
+    ucc_memory_type_t  mtype   = args->dst.info_v.mem_type;
+    size_t             dt_size = ucc_dt_size(args->dst.info_v.datatype);
+    void              *rbuf    = args->dst.info_v.buffer;
+    size_t             offset  = 0;
+    ucc_rank_t         child, span, peer;
+    size_t             msg_size, displ;
+    uint64_t           dist;
+    uint32_t           j;
+    ucc_status_t       status;
+
+    if (!UCC_IS_INPLACE(*args)) {
+        displ  = ucc_coll_args_get_displacement(args,
+                        args->dst.info_v.displacements, rank) * dt_size;
+        status = ucc_mc_memcpy(PTR_OFFSET(rbuf, displ), args->src.info.buffer,
+                               ucc_coll_args_get_count(args,
+                                    args->dst.info_v.counts, rank) * dt_size,
+                               mtype, args->src.info.mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    for (dist = 1; dist < size; dist *= radix) {
+        for (j = 1; j < radix && j * dist < size; j++) {
+            child    = j * dist;
+            span     = ucc_min(dist, size - child);
+            peer     = INV_VRANK(child, rank, size);
+            msg_size = ucc_tl_ucp_kn_v_count(args, args->dst.info_v.counts,
+                                             child, span, size) * dt_size;
+            if (ucc_tl_ucp_kn_v_is_contig(args, args->dst.info_v.counts,
+                                          args->dst.info_v.displacements,
+                                          child, span, size)) {
+                displ = ucc_coll_args_get_displacement(args,
+                            args->dst.info_v.displacements, peer) * dt_size;
+                status = ucc_tl_ucp_recv_nz(PTR_OFFSET(rbuf, displ), msg_size,
+                                            mtype, peer, team, task);
+            } else {
+                status = ucc_tl_ucp_recv_nz(PTR_OFFSET(task->gatherv_kn.scratch,
+                                                       offset),
+                                            msg_size, mtype, peer, team, task);
+                offset += msg_size;
+            }
+            if (ucc_unlikely(UCC_OK != status)) {
+                return status;
+            }
+        }
+    }
+    return UCC_OK;
+}
+
+/* Copies the data of the subtrees that were not contiguous in dst
+   from scratch to their displacements */
+static ucc_status_t
+ucc_tl_ucp_gatherv_knomial_root_unpack(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team    = TASK_TEAM(task);
+    ucc_coll_args_t   *args    = &TASK_ARGS(task);
+    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(team);
+    uint32_t           radix   = task->gatherv_kn.radix;
+    ucc_memory_type_t  mtype   = args->dst.info_v.mem_type;
+    size_t             dt_size = ucc_dt_size(args->dst.info_v.datatype);
+    size_t             offset  = 0;
+    ucc_rank_t         child, span, peer, i;
+    size_t             msg_size, displ;
+    uint64_t           dist;
+    uint32_t           j;
+    ucc_status_t       status;
+
+    for (dist = 1; dist < size; dist *= radix) {
+        for (j = 1; j < radix && j * dist < size; j++) {
+            child = j * dist;
+            span  = ucc_min(dist, size - child);
+            if (ucc_tl_ucp_kn_v_is_contig(args, args->dst.info_v.counts,
+                                          args->dst.info_v.displacements,
+                                          child, span, size)) {
+                continue;
+            }
+            for (i = child; i < child + span; i++) {
+                peer     = INV_VRANK(i, args->root, size);
+                msg_size = ucc_coll_args_get_count(args,
+                                args->dst.info_v.counts, peer) * dt_size;
+                displ    = ucc_coll_args_get_displacement(args,
+                                args->dst.info_v.displacements, peer) * dt_size;
+                status   = ucc_mc_memcpy(PTR_OFFSET(args->dst.info_v.buffer,
+                                                    displ),
+                                         PTR_OFFSET(task->gatherv_kn.scratch,
+                                                    offset),
+                                         msg_size, mtype, mtype);
+                if (ucc_unlikely(UCC_OK != status)) {
+                    return status;
+                }
+                offset += msg_size;
+            }
+        }
+    }
+    return UCC_OK;
+}
+
+/* Non-root interior node: children subtree sizes are known, report own
+   subtree size to parent and post receives of children subtree data */
+static ucc_status_t
+ucc_tl_ucp_gatherv_knomial_post_data(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team    = TASK_TEAM(task);
+    ucc_coll_args_t   *args    = &TASK_ARGS(task);
+    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root    = args->root;
+    uint32_t           radix   = task->gatherv_kn.radix;
+    ucc_rank_t         vrank   = VRANK(UCC_TL_TEAM_RANK(team), root, size);
+    ucc_rank_t         vspan   = ucc_tl_ucp_kn_tree_span(vrank, radix, size);
+    ucc_rank_t         parent  = ucc_tl_ucp_kn_tree_parent(vrank, radix);
+    ucc_memory_type_t  mtype   = args->src.info.mem_type;
+    size_t             own     = args->src.info.count *
+                                 ucc_dt_size(args->src.info.datatype);
+    size_t             offset  = own;
+    int                n_child = 0;
+    ucc_rank_t         child;
+    uint64_t           dist;
+    uint32_t           j;
+    ucc_status_t       status;
+
+    task->gatherv_kn.total = own;
+    for (dist = 1; dist < vspan; dist *= radix) {
+        for (j = 1; j < radix && j * dist < vspan; j++) {
+            task->gatherv_kn.total += task->gatherv_kn.sizes[n_child++];
+        }
+    }
+    if (parent != 0) {
+        status = ucc_tl_ucp_send_nb(&task->gatherv_kn.total, sizeof(uint64_t),
+                                    UCC_MEMORY_TYPE_HOST,
+                                    INV_VRANK(parent, root, size), team, task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    status = ucc_tl_ucp_kn_v_scratch_get(&task->gatherv_kn.scratch_mc_header,
+                                         &task->gatherv_kn.scratch_size,
+                                         task->gatherv_kn.total, mtype);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    task->gatherv_kn.scratch = task->gatherv_kn.scratch_mc_header->addr;
+    status = ucc_mc_memcpy(task->gatherv_kn.scratch, args->src.info.buffer,
+                           own, mtype, mtype);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    n_child = 0;
+    for (dist = 1; dist < vspan; dist *= radix) {
+        for (j = 1; j < radix && j * dist < vspan; j++) {
+            child  = vrank + j * dist;
+            status = ucc_tl_ucp_recv_nz(PTR_OFFSET(task->gatherv_kn.scratch,
+                                                   offset),
+                                        task->gatherv_kn.sizes[n_child],
+                                        mtype, INV_VRANK(child, root, size),
+                                        team, task);
+            if (ucc_unlikely(UCC_OK != status)) {
+                return status;
+            }
+            offset += task->gatherv_kn.sizes[n_child++];
+        }
+    }
+    return UCC_OK;
+}
+
+void ucc_tl_ucp_gatherv_knomial_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task   = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
+    ucc_coll_args_t   *args   = &TASK_ARGS(task);
+    ucc_rank_t         size   = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         vrank  = VRANK(UCC_TL_TEAM_RANK(team), args->root, size);
+    ucc_rank_t         parent;
+    ucc_status_t       status;
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return;
+    }
+    if (task->gatherv_kn.phase == UCC_GATHERV_KN_PHASE_SIZES) {
+        status = ucc_tl_ucp_gatherv_knomial_post_data(task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.status = status;
+            return;
+        }
+        task->gatherv_kn.phase = UCC_GATHERV_KN_PHASE_DATA;
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return;
+        }
+    }
+    if (task->gatherv_kn.phase == UCC_GATHERV_KN_PHASE_DATA) {
+        if (vrank == 0) {
+            task->super.status = ucc_tl_ucp_gatherv_knomial_root_unpack(task);
+            goto out;
+        }
+        parent = ucc_tl_ucp_kn_tree_parent(vrank, task->gatherv_kn.radix);
+        status = ucc_tl_ucp_send_nz(task->gatherv_kn.scratch,
+                                    task->gatherv_kn.total,
+                                    args->src.info.mem_type,
+                                    INV_VRANK(parent, args->root, size), team,
+                                    task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.status = status;
+            return;
+        }
+        task->gatherv_kn.phase = UCC_GATHERV_KN_PHASE_SEND;
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return;
+        }
+    }
+    task->super.status = UCC_OK;
+out:
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_gatherv_kn_done", 0);
+}
+
+ucc_status_t ucc_tl_ucp_gatherv_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task   = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
+    ucc_coll_args_t   *args   = &TASK_ARGS(task);
+    ucc_rank_t         size   = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root   = args->root;
+    uint32_t           radix  = task->gatherv_kn.radix;
+    ucc_rank_t         vrank  = VRANK(UCC_TL_TEAM_RANK(team), root, size);
+    ucc_rank_t         vspan  = ucc_tl_ucp_kn_tree_span(vrank, radix, size);
+    int                n_child = 0;
+    ucc_rank_t         parent, child;
+    uint64_t           dist;
+    uint32_t           j;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_gatherv_kn_start", 0);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+
+    if (vrank == 0) {
+        task->gatherv_kn.phase = UCC_GATHERV_KN_PHASE_DATA;
+        UCPCHECK_GOTO(ucc_tl_ucp_gatherv_knomial_root_post(task), task, out);
+    } else if (vspan == 1) {
+        /* leaf: parent knows nothing about our count unless it is root */
+        parent                 = ucc_tl_ucp_kn_tree_parent(vrank, radix);
+        task->gatherv_kn.phase = UCC_GATHERV_KN_PHASE_SEND;
+        task->gatherv_kn.total = args->src.info.count *
+                                 ucc_dt_size(args->src.info.datatype);
+        if (parent != 0) {
+            UCPCHECK_GOTO(ucc_tl_ucp_send_nb(&task->gatherv_kn.total,
+                                             sizeof(uint64_t),
+                                             UCC_MEMORY_TYPE_HOST,
+                                             INV_VRANK(parent, root, size),
+                                             team, task),
+                          task, out);
+        }
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nz(args->src.info.buffer,
+                                         task->gatherv_kn.total,
+                                         args->src.info.mem_type,
+                                         INV_VRANK(parent, root, size),
+                                         team, task),
+                      task, out);
+    } else {
+        task->gatherv_kn.phase = UCC_GATHERV_KN_PHASE_SIZES;
+        for (dist = 1; dist < vspan; dist *= radix) {
+            for (j = 1; j < radix && j * dist < vspan; j++) {
+                child = vrank + j * dist;
+                UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(
+                                  &task->gatherv_kn.sizes[n_child++],
+                                  sizeof(uint64_t), UCC_MEMORY_TYPE_HOST,
+                                  INV_VRANK(child, root, size), team, task),
+                              task, out);
+            }
+        }
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+out:
+    return task->super.status;
+}
+
+ucc_status_t ucc_tl_ucp_gatherv_knomial_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    if (task->gatherv_kn.scratch_mc_header) {
+        ucc_mc_free(task->gatherv_kn.scratch_mc_header);
+    }
+    ucc_free(task->gatherv_kn.sizes);
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_gatherv_knomial_init_common(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team    = TASK_TEAM(task);
+    ucc_coll_args_t   *args    = &TASK_ARGS(task);
+    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         vrank   = VRANK(UCC_TL_TEAM_RANK(team), args->root,
+                                       size);
+    uint32_t           radix   = ucc_min(
+        UCC_TL_UCP_TEAM_LIB(team)->cfg.gatherv_kn_radix, size);
+    size_t             scratch = 0;
+    ucc_rank_t         vspan, child, span;
+    size_t             n_child;
+    uint64_t           dist;
+    uint32_t           j;
+    ucc_status_t       status;
+
+    radix                              = ucc_max(radix, 2);
+    task->super.post                   = ucc_tl_ucp_gatherv_knomial_start;
+    task->super.progress               = ucc_tl_ucp_gatherv_knomial_progress;
+    task->super.finalize               = ucc_tl_ucp_gatherv_knomial_finalize;
+    task->gatherv_kn.radix             = radix;
+    task->gatherv_kn.sizes             = NULL;
+    task->gatherv_kn.scratch           = NULL;
+    task->gatherv_kn.scratch_size      = 0;
+    task->gatherv_kn.scratch_mc_header = NULL;
+
+    vspan = ucc_tl_ucp_kn_tree_span(vrank, radix, size);
+    if (vrank == 0) {
+        /* scratch for subtrees that are not contiguous in dst */
+        for (dist = 1; dist < size; dist *= radix) {
+            for (j = 1; j < radix && j * dist < size; j++) {
+                child = j * dist;
+                span  = ucc_min(dist, size - child);
+                if (!ucc_tl_ucp_kn_v_is_contig(args, args->dst.info_v.counts,
+                                               args->dst.info_v.displacements,
+                                               child, span, size)) {
+                    scratch += ucc_tl_ucp_kn_v_count(args,
+                                                     args->dst.info_v.counts,
+                                                     child, span, size);
+                }
+            }
+        }
+        if (scratch > 0) {
+            scratch *= ucc_dt_size(args->dst.info_v.datatype);
+            status = ucc_mc_alloc(&task->gatherv_kn.scratch_mc_header,
+                                  scratch, args->dst.info_v.mem_type);
+            if (ucc_unlikely(UCC_OK != status)) {
+                return status;
+            }
+            ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), scratch);
+            task->gatherv_kn.scratch =
+                task->gatherv_kn.scratch_mc_header->addr;
+        }
+    } else if (vspan > 1) {
+        n_child = 0;
+        for (dist = 1; dist < vspan; dist *= radix) {
+            n_child += ucc_min(radix - 1, ucc_div_round_up(vspan - dist, dist));
+        }
+        task->gatherv_kn.sizes = ucc_malloc(n_child * sizeof(uint64_t),
+                                            "gatherv_kn_sizes");
+        if (ucc_unlikely(!task->gatherv_kn.sizes)) {
+            tl_error(UCC_TL_TEAM_LIB(team),
+                     "failed to allocate %zd bytes for subtree sizes",
+                     n_child * sizeof(uint64_t));
+            return UCC_ERR_NO_MEMORY;
+        }
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_gatherv_knomial_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t      *team,
+                                             ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    task   = ucc_tl_ucp_init_task(coll_args, team);
+    status = ucc_tl_ucp_gatherv_knomial_init_common(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
+    *task_h = &task->super;
+    return UCC_OK;
+}
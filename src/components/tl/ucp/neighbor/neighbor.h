@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef NEIGHBOR_H_
+#define NEIGHBOR_H_
+
+#include "../tl_ucp.h"
+#include "../tl_ucp_coll.h"
+#include "../tl_ucp_dt_generic.h"
+
+/* Neighbor graph attached to the core team, ranks are team ranks. NULL if
+   the graph was not passed down to this TL team: core team created without
+   it, or a sub-team created by hierarchical CL with its own params. */
+static inline const ucc_team_neighbors_t *
+ucc_tl_ucp_team_neighbors(ucc_tl_ucp_team_t *team)
+{
+    const ucc_team_params_t *params = &team->super.super.params.params;
+
+    if (!(params->mask & UCC_TEAM_PARAM_FIELD_NEIGHBORS)) {
+        return NULL;
+    }
+    return &params->neighbors;
+}
+
+ucc_status_t ucc_tl_ucp_neighbor_alltoallv_init(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_neighbor_allgather_init(ucc_tl_ucp_task_t *task);
+
+void ucc_tl_ucp_neighbor_progress(ucc_coll_task_t *coll_task);
+
+#endif
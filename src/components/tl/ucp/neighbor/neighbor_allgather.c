@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "neighbor.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+
+/* Block i of dst is received from sources[i], src goes to every destination */
+static ucc_status_t
+ucc_tl_ucp_neighbor_allgather_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t          *task = ucc_derived_of(coll_task,
+                                                      ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t          *team = TASK_TEAM(task);
+    ucc_coll_args_t            *args = &TASK_ARGS(task);
+    const ucc_team_neighbors_t *nb   = ucc_tl_ucp_team_neighbors(team);
+    ucc_memory_type_t           rmem = args->dst.info.mem_type;
+    ucc_memory_type_t           smem = args->src.info.mem_type;
+    size_t                      data_size;
+    uint64_t                    i;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task,
+                                     "ucp_neighbor_allgather_start", 0);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+
+    data_size = args->src.info.count * ucc_dt_size(args->src.info.datatype);
+    for (i = 0; i < nb->n_sources; i++) {
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nz(PTR_OFFSET(args->dst.info.buffer,
+                                                    i * data_size),
+                                         data_size, rmem,
+                                         (ucc_rank_t)nb->sources[i], team,
+                                         task),
+                      task, error);
+    }
+    for (i = 0; i < nb->n_destinations; i++) {
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nz(args->src.info.buffer, data_size,
+                                         smem,
+                                         (ucc_rank_t)nb->destinations[i],
+                                         team, task),
+                      task, error);
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+error:
+    return task->super.status;
+}
+
+ucc_status_t ucc_tl_ucp_neighbor_allgather_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_coll_args_t   *args = &TASK_ARGS(task);
+
+    if (!ucc_tl_ucp_team_neighbors(team)) {
+        tl_debug(UCC_TL_TEAM_LIB(team),
+                 "neighbor graph is not available on tl team");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (UCC_IS_INPLACE(*args) ||
+        UCC_DT_IS_NONCONTIG(args->src.info.datatype) ||
+        UCC_DT_IS_NONCONTIG(args->dst.info.datatype)) {
+        tl_debug(UCC_TL_TEAM_LIB(team),
+                 "inplace and generic datatypes are not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task->super.post     = ucc_tl_ucp_neighbor_allgather_start;
+    task->super.progress = ucc_tl_ucp_neighbor_progress;
+    return UCC_OK;
+}
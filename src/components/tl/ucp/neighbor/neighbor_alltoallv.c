@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "neighbor.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_coll_utils.h"
+
+void ucc_tl_ucp_neighbor_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    task->super.status = ucc_tl_ucp_test(task);
+    if (task->super.status != UCC_INPROGRESS) {
+        UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_neighbor_done", 0);
+    }
+}
+
+/* Only graph neighbors are touched: posting is O(in degree + out degree) */
+static ucc_status_t
+ucc_tl_ucp_neighbor_alltoallv_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t          *task = ucc_derived_of(coll_task,
+                                                      ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t          *team = TASK_TEAM(task);
+    ucc_coll_args_t            *args = &TASK_ARGS(task);
+    const ucc_team_neighbors_t *nb   = ucc_tl_ucp_team_neighbors(team);
+    ucc_memory_type_t           rmem = args->dst.info_v.mem_type;
+    ucc_memory_type_t           smem = args->src.info_v.mem_type;
+    size_t                      rdt_size, sdt_size, data_size, data_displ;
+    uint64_t                    i;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task,
+                                     "ucp_neighbor_alltoallv_start", 0);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+
+    rdt_size = ucc_dt_size(args->dst.info_v.datatype);
+    sdt_size = ucc_dt_size(args->src.info_v.datatype);
+    for (i = 0; i < nb->n_sources; i++) {
+        data_size  = ucc_coll_args_get_count(args, args->dst.info_v.counts,
+                                             i) * rdt_size;
+        data_displ = ucc_coll_args_get_displacement(args,
+                        args->dst.info_v.displacements, i) * rdt_size;
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nz(PTR_OFFSET(args->dst.info_v.buffer,
+                                                    data_displ),
+                                         data_size, rmem,
+                                         (ucc_rank_t)nb->sources[i], team,
+                                         task),
+                      task, error);
+    }
+    for (i = 0; i < nb->n_destinations; i++) {
+        data_size  = ucc_coll_args_get_count(args, args->src.info_v.counts,
+                                             i) * sdt_size;
+        data_displ = ucc_coll_args_get_displacement(args,
+                        args->src.info_v.displacements, i) * sdt_size;
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nz(PTR_OFFSET(args->src.info_v.buffer,
+                                                    data_displ),
+                                         data_size, smem,
+                                         (ucc_rank_t)nb->destinations[i],
+                                         team, task),
+                      task, error);
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+error:
+    return task->super.status;
+}
+
+ucc_status_t ucc_tl_ucp_neighbor_alltoallv_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_coll_args_t   *args = &TASK_ARGS(task);
+
+    if (!ucc_tl_ucp_team_neighbors(team)) {
+        tl_debug(UCC_TL_TEAM_LIB(team),
+                 "neighbor graph is not available on tl team");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (UCC_IS_INPLACE(*args) ||
+        UCC_DT_IS_NONCONTIG(args->src.info_v.datatype) ||
+        UCC_DT_IS_NONCONTIG(args->dst.info_v.datatype)) {
+        tl_debug(UCC_TL_TEAM_LIB(team),
+                 "inplace and generic datatypes are not supported");
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    task->super.post     = ucc_tl_ucp_neighbor_alltoallv_start;
+    task->super.progress = ucc_tl_ucp_neighbor_progress;
+    return UCC_OK;
+}
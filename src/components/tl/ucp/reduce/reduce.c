@@ -26,10 +26,10 @@ ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task)
     ucc_coll_args_t   *args      = &TASK_ARGS(task);
     ucc_tl_ucp_team_t *team      = TASK_TEAM(task);
     ucc_rank_t         myrank    = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         team_size = UCC_TL_TEAM_SIZE(team);
     ucc_rank_t         root      = args->root;
-    ucc_rank_t         vrank     = (myrank - root + team_size) % team_size;
+    ucc_rank_t         team_size;
     ucc_status_t       status    = UCC_OK;
+    ucc_rank_t         vrank;
     ucc_memory_type_t  mtype;
     ucc_datatype_t     dt;
     size_t             count, data_size;
@@ -50,8 +50,13 @@ ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task)
     task->super.post      = ucc_tl_ucp_reduce_knomial_start;
     task->super.progress  = ucc_tl_ucp_reduce_knomial_progress;
     task->super.finalize  = ucc_tl_ucp_reduce_knomial_finalize;
+    ucc_tl_ucp_task_reorder_ranks(task);
+    team_size             = (ucc_rank_t)task->subset.map.ep_num;
     task->reduce_kn.radix =
         ucc_min(UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_kn_radix, team_size);
+    task->reduce_kn.root  = ucc_tl_ucp_task_subset_root(task, root);
+    vrank = (task->subset.myrank - task->reduce_kn.root + team_size) %
+            team_size;
     CALC_KN_TREE_DIST(team_size, task->reduce_kn.radix,
                       task->reduce_kn.max_dist);
     isleaf   = (vrank % task->reduce_kn.radix != 0 || vrank == team_size - 1);
@@ -65,6 +70,11 @@ ucc_status_t ucc_tl_ucp_reduce_init(ucc_tl_ucp_task_t *task)
     	and an additional 1 for previous step reduce multi result */
         status = ucc_mc_alloc(&task->reduce_kn.scratch_mc_header,
                               task->reduce_kn.radix * data_size, mtype);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+        ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task),
+                                   task->reduce_kn.radix * data_size);
         task->reduce_kn.scratch =
                         task->reduce_kn.scratch_mc_header->addr;
     }
@@ -329,6 +329,9 @@ ucc_status_t ucc_tl_ucp_reduce_dbt_init(ucc_base_coll_args_t *coll_args,
     size_t             data_size;
     ucc_status_t       status;
 
+    if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
+        return ucc_tl_ucp_reduce_knomial_init(coll_args, team, task_h);
+    }
     task                 = ucc_tl_ucp_init_task(coll_args, team);
     task->super.flags    |= UCC_COLL_TASK_FLAG_EXECUTOR;
     task->super.post     = ucc_tl_ucp_reduce_dbt_start;
@@ -356,6 +359,7 @@ ucc_status_t ucc_tl_ucp_reduce_dbt_init(ucc_base_coll_args_t *coll_args,
     if (ucc_unlikely(status != UCC_OK)) {
         return status;
     }
+    ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), 3 * data_size);
     task->reduce_dbt.scratch = task->reduce_dbt.scratch_mc_header->addr;
     *task_h = &task->super;
     return UCC_OK;
@@ -24,9 +24,9 @@ void ucc_tl_ucp_reduce_knomial_progress(ucc_coll_task_t *coll_task)
     ucc_tl_ucp_team_t *team       = TASK_TEAM(task);
     int                avg_pre_op =
         UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_avg_pre_op;
-    ucc_rank_t         rank       = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         size       = UCC_TL_TEAM_SIZE(team);
-    ucc_rank_t         root       = (ucc_rank_t)args->root;
+    ucc_rank_t         rank       = task->subset.myrank;
+    ucc_rank_t         size       = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_rank_t         root       = task->reduce_kn.root;
     uint32_t           radix      = task->reduce_kn.radix;
     ucc_rank_t         vrank      = (rank - root + size) % size;
     void              *rbuf       = (rank == root) ? args->dst.info.buffer :
@@ -74,7 +74,8 @@ UCC_REDUCE_KN_PHASE_INIT:
                     	break;
                     } else {
                         task->reduce_kn.children_per_cycle += 1;
-                        peer = (vpeer + root) % size;
+                        peer = ucc_ep_map_eval(task->subset.map,
+                                               (vpeer + root) % size);
                         UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(scratch_offset,
                                           data_size, mtype, peer, team, task),
                                           task, out);
@@ -109,8 +110,10 @@ UCC_REDUCE_KN_PHASE_MULTI:
             } else {
                 vroot_at_level = vrank - pos * task->reduce_kn.dist;
                 root_at_level  = (vroot_at_level + root) % size;
+                peer           = ucc_ep_map_eval(task->subset.map,
+                                                 root_at_level);
                 UCPCHECK_GOTO(ucc_tl_ucp_send_nb(task->reduce_kn.scratch,
-                                  data_size, mtype, root_at_level, team, task),
+                                  data_size, mtype, peer, team, task),
                                   task, out);
             }
         }
@@ -133,9 +136,9 @@ ucc_status_t ucc_tl_ucp_reduce_knomial_start(ucc_coll_task_t *coll_task)
     ucc_coll_args_t   *args       = &TASK_ARGS(task);
     ucc_tl_ucp_team_t *team       = TASK_TEAM(task);
     uint32_t           radix      = task->reduce_kn.radix;
-    ucc_rank_t         root       = (ucc_rank_t)args->root;
-    ucc_rank_t         rank       = UCC_TL_TEAM_RANK(team);
-    ucc_rank_t         size       = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root       = task->reduce_kn.root;
+    ucc_rank_t         rank       = task->subset.myrank;
+    ucc_rank_t         size       = (ucc_rank_t)task->subset.map.ep_num;
     ucc_rank_t         vrank      = (rank - root + size) % size;
     int                isleaf     =
         (vrank % radix != 0 || vrank == size - 1);
@@ -182,7 +185,7 @@ ucc_status_t ucc_tl_ucp_reduce_knomial_start(ucc_coll_task_t *coll_task)
             ucc_dt_reduce(args->src.info.buffer, args->src.info.buffer,
                           task->reduce_kn.scratch, count, dt, args,
                           UCC_EEE_TASK_FLAG_REDUCE_WITH_ALPHA,
-                          1.0 / (double)(UCC_TL_TEAM_SIZE(TASK_TEAM(task)) * 2),
+                          AVG_ALPHA(task) / 2,
                           task->reduce_kn.executor, &task->reduce_kn.etask);
         if (ucc_unlikely(UCC_OK != status)) {
             tl_error(UCC_TASK_LIB(task),
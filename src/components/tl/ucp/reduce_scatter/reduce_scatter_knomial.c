@@ -518,6 +518,7 @@ ucc_tl_ucp_reduce_scatter_knomial_init_r(ucc_base_coll_args_t *coll_args,
             ucc_tl_ucp_coll_finalize(&task->super);
             return status;
         }
+        ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), scratch_size);
         task->reduce_scatter_kn.scratch =
             task->reduce_scatter_kn.scratch_mc_header->addr;
     }
@@ -6,6 +6,7 @@
 
 #include "reduce_scatter.h"
 #include "tl_ucp_sendrecv.h"
+#include "tl_ucp_reduce.h"
 #include "core/ucc_progress_queue.h"
 #include "components/mc/ucc_mc.h"
 #include "utils/ucc_math.h"
@@ -95,6 +96,8 @@ static void ucc_tl_ucp_reduce_scatter_ring_progress(ucc_coll_task_t *coll_task)
     size_t                  count    = args->dst.info.count * size;
     ucc_datatype_t          dt       = args->dst.info.datatype;
     size_t                  dt_size  = ucc_dt_size(dt);
+    ucc_datatype_t          wire_dt  = task->reduce_scatter_ring.wire_dt;
+    size_t                  wire_size = ucc_dt_size(wire_dt);
     ucc_rank_t              sendto   = (rank + 1) % size;
     ucc_rank_t              recvfrom = (rank - 1 + size) % size;
     ucp_send_nbx_callback_t cb[2]    = {send_completion_1, send_completion_2};
@@ -153,6 +156,9 @@ static void ucc_tl_ucp_reduce_scatter_ring_progress(ucc_coll_task_t *coll_task)
         }
         is_avg = (args->op == UCC_OP_AVG) &&
                  (task->tagged.recv_completed == (size - 1));
+        if (wire_dt != dt) {
+            ucc_tl_ucp_wire_unpack(r_scratch, r_scratch, frag_count, wire_dt);
+        }
         if (UCC_OK !=
             (status = ucc_dt_reduce(
                  r_scratch,
@@ -173,8 +179,12 @@ static void ucc_tl_ucp_reduce_scatter_ring_progress(ucc_coll_task_t *coll_task)
         ucc_assert(task->tagged.send_posted - task->tagged.send_completed <= 1);
         ucc_assert(task->tagged.send_posted < size);
 
+        if (wire_dt != dt) {
+            ucc_tl_ucp_wire_pack(reduce_target, reduce_target, frag_count,
+                                 wire_dt);
+        }
         busy[id] = 1;
-        UCPCHECK_GOTO(ucc_tl_ucp_send_cb(reduce_target, frag_count * dt_size,
+        UCPCHECK_GOTO(ucc_tl_ucp_send_cb(reduce_target, frag_count * wire_size,
                                          mem_type, sendto, team, task, cb[id], (void *)task),
                       task, out);
 
@@ -186,8 +196,8 @@ static void ucc_tl_ucp_reduce_scatter_ring_progress(ucc_coll_task_t *coll_task)
         }
         ucc_ring_frag_count(task, count, recv_data_from, &frag_count);
 
-        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(r_scratch, frag_count * dt_size, mem_type,
-                                         recvfrom, team, task),
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(r_scratch, frag_count * wire_size,
+                                         mem_type, recvfrom, team, task),
                       task, out);
 
         if (UCC_INPROGRESS == ucc_tl_ucp_test_ring(task)) {
@@ -213,6 +223,8 @@ ucc_tl_ucp_reduce_scatter_ring_start(ucc_coll_task_t *coll_task)
     size_t             count    = args->dst.info.count * size;
     ucc_datatype_t     dt       = args->dst.info.datatype;
     size_t             dt_size  = ucc_dt_size(dt);
+    ucc_datatype_t     wire_dt  = task->reduce_scatter_ring.wire_dt;
+    size_t             wire_size = ucc_dt_size(wire_dt);
     ucc_memory_type_t  mem_type = args->dst.info.mem_type;
     void *             sbuf     = args->src.info.buffer;
     int                step     = 0;
@@ -221,7 +233,7 @@ ucc_tl_ucp_reduce_scatter_ring_start(ucc_coll_task_t *coll_task)
     ucc_rank_t         recv_block = (rank - 2 - step + size) % size;
     ucc_rank_t         send_block = (rank - 1 - step + size) % size;
     size_t             block_offset, frag_count, frag_offset;
-    void              *r_scratch;
+    void              *r_scratch, *s_scratch;
     ucc_status_t       status;
 
     ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
@@ -248,13 +260,30 @@ ucc_tl_ucp_reduce_scatter_ring_start(ucc_coll_task_t *coll_task)
     }
 
     ucc_ring_frag_count(task, count, recv_block, &frag_count);
-    UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(r_scratch, frag_count * dt_size, mem_type,
-                                     recvfrom, team, task),
+    UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(r_scratch, frag_count * wire_size,
+                                     mem_type, recvfrom, team, task),
                   task, out);
 
     ucc_ring_frag_count(task, count, send_block, &frag_count);
     ucc_ring_frag_block_offset(task, count, send_block, &block_offset,
                                &frag_offset);
+    if (wire_dt != dt) {
+        /* sbuf is user memory: compress into send scratch of slot 0 */
+        s_scratch = PTR_OFFSET(r_scratch,
+                               task->reduce_scatter_ring.max_block_count *
+                               dt_size);
+        ucc_tl_ucp_wire_pack(s_scratch,
+                             PTR_OFFSET(sbuf, (block_offset + frag_offset) *
+                                        dt_size),
+                             frag_count, wire_dt);
+        task->reduce_scatter_ring.s_scratch_busy[0] = 1;
+        UCPCHECK_GOTO(ucc_tl_ucp_send_cb(s_scratch, frag_count * wire_size,
+                                         mem_type, sendto, team, task,
+                                         send_completion_1, (void *)task),
+                      task, out);
+        return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq,
+                                          &task->super);
+    }
     UCPCHECK_GOTO(ucc_tl_ucp_send_nb(
                       PTR_OFFSET(sbuf, (block_offset + frag_offset) * dt_size),
                       frag_count * dt_size, mem_type, sendto, team, task),
@@ -311,6 +340,9 @@ static ucc_status_t ucc_tl_ucp_reduce_scatter_ring_init_subset(
     task->reduce_scatter_ring.max_block_count   = max_block_count;
     task->reduce_scatter_ring.s_scratch_busy[0] = 0;
     task->reduce_scatter_ring.s_scratch_busy[1] = 0;
+    task->reduce_scatter_ring.wire_dt           = ucc_tl_ucp_reduce_wire_dt(
+        tl_team, &TASK_ARGS(task), TASK_ARGS(task).dst.info.datatype,
+        TASK_ARGS(task).dst.info.mem_type);
     *task_h = &task->super;
     return UCC_OK;
 }
@@ -395,6 +427,8 @@ ucc_tl_ucp_reduce_scatter_ring_init(ucc_base_coll_args_t *coll_args,
                                 to_alloc_per_set * dt_size * n_subsets,
                                 mem_type),
                    out, status);
+    ucc_coll_stats_add_scratch(coll_args->team,
+                               to_alloc_per_set * dt_size * n_subsets);
     for (i = 0; i < n_subsets; i++) {
         UCC_CHECK_GOTO(ucc_tl_ucp_reduce_scatter_ring_init_subset(
                            coll_args, team, &ctask, s, n_subsets, i,
@@ -415,6 +415,8 @@ ucc_tl_ucp_reduce_scatterv_ring_init(ucc_base_coll_args_t *coll_args,
                                 to_alloc_per_set * dt_size * n_subsets,
                                 mem_type),
                    out, status);
+    ucc_coll_stats_add_scratch(coll_args->team,
+                               to_alloc_per_set * dt_size * n_subsets);
 
     for (i = 0; i < n_subsets; i++) {
         UCC_CHECK_GOTO(ucc_tl_ucp_reduce_scatterv_ring_init_subset(
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+#include "tl_ucp.h"
+#include "scan.h"
+#include "components/mc/ucc_mc.h"
+
+ucc_base_coll_alg_info_t
+    ucc_tl_ucp_scan_algs[UCC_TL_UCP_SCAN_ALG_LAST + 1] = {
+        [UCC_TL_UCP_SCAN_ALG_RECURSIVE_DOUBLING] =
+            {.id   = UCC_TL_UCP_SCAN_ALG_RECURSIVE_DOUBLING,
+             .name = "recursive_doubling",
+             .desc = "recursive doubling with log2(N) full message exchanges "
+                     "(optimized for latency)"},
+        [UCC_TL_UCP_SCAN_ALG_KNOMIAL] =
+            {.id   = UCC_TL_UCP_SCAN_ALG_KNOMIAL,
+             .name = "knomial",
+             .desc = "up/down sweep over knomial tree with arbitrary radix, "
+                     "O(N) messages in total (optimized for BW)"},
+        [UCC_TL_UCP_SCAN_ALG_LAST] = {
+            .id = 0, .name = NULL, .desc = NULL}};
+
+ucc_status_t ucc_tl_ucp_scan_init(ucc_tl_ucp_task_t *task)
+{
+    ucc_status_t status;
+
+    SCAN_TASK_CHECK(TASK_ARGS(task), TASK_TEAM(task));
+    status = ucc_tl_ucp_scan_recursive_doubling_init_common(task);
+out:
+    return status;
+}
+
+ucc_status_t ucc_tl_ucp_scan_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_status_t       st, global_st;
+
+    global_st = ucc_mc_free(task->scan.scratch_mc_header);
+    if (ucc_unlikely(global_st != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed to free scratch buffer");
+    }
+
+    st = ucc_tl_ucp_coll_finalize(&task->super);
+    if (ucc_unlikely(st != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed finalize collective");
+        global_st = st;
+    }
+    return global_st;
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+#ifndef SCAN_H_
+#define SCAN_H_
+#include "tl_ucp_coll.h"
+
+/* Algorithms are shared by scan and exscan */
+enum
+{
+    UCC_TL_UCP_SCAN_ALG_RECURSIVE_DOUBLING,
+    UCC_TL_UCP_SCAN_ALG_KNOMIAL,
+    UCC_TL_UCP_SCAN_ALG_LAST
+};
+
+extern ucc_base_coll_alg_info_t
+    ucc_tl_ucp_scan_algs[UCC_TL_UCP_SCAN_ALG_LAST + 1];
+
+#define UCC_TL_UCP_SCAN_DEFAULT_ALG_SELECT_STR                                 \
+    "scan:0-4k:@recursive_doubling#scan:4k-inf:@knomial"
+
+#define UCC_TL_UCP_EXSCAN_DEFAULT_ALG_SELECT_STR                               \
+    "exscan:0-4k:@recursive_doubling#exscan:4k-inf:@knomial"
+
+#define SCAN_TASK_CHECK(_args, _team)                                          \
+    do {                                                                       \
+        if (!UCC_IS_INPLACE(_args) &&                                          \
+            (_args.src.info.mem_type != _args.dst.info.mem_type)) {            \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "asymmetric src/dst memory types are not supported yet"); \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+        if (_args.op == UCC_OP_AVG) {                                          \
+            tl_error(UCC_TL_TEAM_LIB(_team),                                   \
+                     "avg operation is not supported for scan");               \
+            status = UCC_ERR_NOT_SUPPORTED;                                    \
+            goto out;                                                          \
+        }                                                                      \
+    } while (0)
+
+static inline int ucc_tl_ucp_scan_alg_from_str(const char *str)
+{
+    int i;
+    for (i = 0; i < UCC_TL_UCP_SCAN_ALG_LAST; i++) {
+        if (0 == strcasecmp(str, ucc_tl_ucp_scan_algs[i].name)) {
+            break;
+        }
+    }
+    return i;
+}
+
+static inline int ucc_tl_ucp_scan_is_exclusive(ucc_tl_ucp_task_t *task)
+{
+    return TASK_ARGS(task).coll_type == UCC_COLL_TYPE_EXSCAN;
+}
+
+ucc_status_t ucc_tl_ucp_scan_init(ucc_tl_ucp_task_t *task);
+
+ucc_status_t ucc_tl_ucp_scan_finalize(ucc_coll_task_t *coll_task);
+
+ucc_status_t
+ucc_tl_ucp_scan_recursive_doubling_init_common(ucc_tl_ucp_task_t *task);
+
+ucc_status_t
+ucc_tl_ucp_scan_recursive_doubling_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task_h);
+
+ucc_status_t ucc_tl_ucp_scan_knomial_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *team,
+                                          ucc_coll_task_t     **task_h);
+#endif
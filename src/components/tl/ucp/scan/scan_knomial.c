@@ -0,0 +1,328 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "scan.h"
+#include "core/ucc_progress_queue.h"
+#include "utils/ucc_dt_reduce.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "components/mc/ucc_mc.h"
+#include "components/ec/ucc_ec.h"
+
+/* Up/down sweep over knomial tree of rank ranges. At level l ranks are split
+   into blocks of radix^(l+1) ranks, each made of radix sub-blocks of
+   radix^l ranks. Last rank of a (sub-)block, or the last rank of the team for
+   the tail one, is its leader.
+   Up sweep: leaders of the sub-blocks send the reduction of the sub-block to
+   the leader of the block. Block leader keeps received vectors of every
+   level in scratch.
+   Down sweep: block leader knowing the exclusive prefix of the block sends
+   exclusive prefix of every sub-block to the sub-block leader.
+   Scratch: partial reduction, exclusive prefix and (radix - 1) vectors per
+   level the rank is a block leader at. */
+
+enum {
+    UCC_SCAN_KN_PHASE_INIT,
+    UCC_SCAN_KN_PHASE_UP,
+    UCC_SCAN_KN_PHASE_UP_REDUCE,
+    UCC_SCAN_KN_PHASE_DOWN,
+    UCC_SCAN_KN_PHASE_DOWN_REDUCE,
+    UCC_SCAN_KN_PHASE_COMPLETE,
+    UCC_SCAN_KN_PHASE_COMPLETE_REDUCE
+};
+
+#define SAVE_STATE(_phase)                                                     \
+    do {                                                                       \
+        task->scan.phase = _phase;                                             \
+    } while (0)
+
+#define SCAN_KN_CHILD_BUF(_level, _child)                                      \
+    PTR_OFFSET(task->scan.scratch,                                             \
+               (2 + (size_t)(_level) * (radix - 1) + (_child)) * data_size)
+
+/* leader of the block of "block" ranks the rank belongs to */
+static inline ucc_rank_t scan_kn_leader(ucc_rank_t rank, ucc_rank_t size,
+                                        size_t block)
+{
+    return (ucc_rank_t)ucc_min((rank / block) * block + block - 1,
+                               (size_t)size - 1);
+}
+
+/* number of sub-blocks of size "dist" preceding the one of the block leader */
+static inline ucc_rank_t scan_kn_n_children(ucc_rank_t rank, size_t dist,
+                                            ucc_kn_radix_t radix)
+{
+    return (ucc_rank_t)((rank % (dist * radix)) / dist);
+}
+
+static inline ucc_rank_t scan_kn_child(ucc_rank_t rank, size_t dist,
+                                       ucc_kn_radix_t radix, ucc_rank_t child)
+{
+    return (ucc_rank_t)(rank - rank % (dist * radix) + (child + 1) * dist - 1);
+}
+
+static void ucc_tl_ucp_scan_knomial_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_coll_args_t   *args      = &TASK_ARGS(task);
+    ucc_tl_ucp_team_t *team      = TASK_TEAM(task);
+    ucc_rank_t         size      = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_rank_t         rank      = task->subset.myrank;
+    ucc_kn_radix_t     radix     = task->scan.radix;
+    void              *rbuf      = args->dst.info.buffer;
+    ucc_memory_type_t  mem_type  = args->dst.info.mem_type;
+    size_t             count     = args->dst.info.count;
+    ucc_datatype_t     dt        = args->dst.info.datatype;
+    size_t             data_size = count * ucc_dt_size(dt);
+    int                exclusive = ucc_tl_ucp_scan_is_exclusive(task);
+    void              *pbuf      = task->scan.scratch;
+    void              *xbuf      = PTR_OFFSET(pbuf, data_size);
+    void              *sbuf      = args->src.info.buffer;
+    void              *sub_prefix;
+    ucc_rank_t         n_children, child, peer;
+    size_t             dist;
+    int                level;
+    ucc_status_t       status;
+
+    if (UCC_IS_INPLACE(*args)) {
+        sbuf = rbuf;
+    }
+
+    switch (task->scan.phase) {
+    case UCC_SCAN_KN_PHASE_UP:
+        goto UCC_SCAN_KN_PHASE_UP;
+    case UCC_SCAN_KN_PHASE_UP_REDUCE:
+        goto UCC_SCAN_KN_PHASE_UP_REDUCE;
+    case UCC_SCAN_KN_PHASE_DOWN:
+        goto UCC_SCAN_KN_PHASE_DOWN;
+    case UCC_SCAN_KN_PHASE_DOWN_REDUCE:
+        goto UCC_SCAN_KN_PHASE_DOWN_REDUCE;
+    case UCC_SCAN_KN_PHASE_COMPLETE:
+        goto UCC_SCAN_KN_PHASE_COMPLETE;
+    case UCC_SCAN_KN_PHASE_COMPLETE_REDUCE:
+        goto UCC_SCAN_KN_PHASE_COMPLETE_REDUCE;
+    default:
+        break;
+    }
+
+    /* up sweep: levels the rank is a block leader at */
+    while (task->scan.level < task->scan.top_level) {
+        dist       = task->scan.dist;
+        n_children = scan_kn_n_children(rank, dist, radix);
+        for (child = 0; child < n_children; child++) {
+            peer = scan_kn_child(rank, dist, radix, child);
+            UCPCHECK_GOTO(
+                ucc_tl_ucp_recv_nb(SCAN_KN_CHILD_BUF(task->scan.level, child),
+                                   data_size, mem_type,
+                                   ucc_ep_map_eval(task->subset.map, peer),
+                                   team, task),
+                task, out);
+        }
+UCC_SCAN_KN_PHASE_UP:
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            SAVE_STATE(UCC_SCAN_KN_PHASE_UP);
+            return;
+        }
+        n_children = scan_kn_n_children(rank, task->scan.dist, radix);
+        if (n_children > 0) {
+            status = ucc_dt_reduce_strided(
+                task->scan.partial, SCAN_KN_CHILD_BUF(task->scan.level, 0),
+                pbuf, n_children, count, data_size, dt, args, 0, 0,
+                task->scan.executor, &task->scan.etask);
+            if (ucc_unlikely(UCC_OK != status)) {
+                tl_error(UCC_TASK_LIB(task), "failed to perform dt reduction");
+                task->super.status = status;
+                return;
+            }
+            task->scan.partial = pbuf;
+UCC_SCAN_KN_PHASE_UP_REDUCE:
+            EXEC_TASK_TEST(UCC_SCAN_KN_PHASE_UP_REDUCE,
+                           "failed to perform dt reduction",
+                           task->scan.etask);
+        }
+        task->scan.level++;
+        task->scan.dist *= radix;
+    }
+
+    dist = task->scan.dist;
+    if (dist < size) {
+        /* leader of a sub-block at top level: hand over the reduction and
+           get the exclusive prefix unless the sub-block starts at rank 0 */
+        peer = ucc_ep_map_eval(task->subset.map,
+                               scan_kn_leader(rank, size, dist * radix));
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(task->scan.partial, data_size,
+                                         mem_type, peer, team, task),
+                      task, out);
+        if (rank + 1 > dist) {
+            UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(xbuf, data_size, mem_type, peer,
+                                             team, task),
+                          task, out);
+            task->scan.prefix = xbuf;
+        }
+    }
+UCC_SCAN_KN_PHASE_DOWN:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        SAVE_STATE(UCC_SCAN_KN_PHASE_DOWN);
+        return;
+    }
+
+    /* down sweep: sub-block j gets prefix op S_0 op .. op S_j-1, running
+       prefix is accumulated in place of the received S_j */
+    while (task->scan.level > 0) {
+        level      = task->scan.level - 1;
+        dist       = task->scan.dist / radix;
+        n_children = scan_kn_n_children(rank, dist, radix);
+        for (; task->scan.step < n_children; task->scan.step++) {
+            child      = task->scan.step;
+            sub_prefix = (child == 0) ? task->scan.prefix
+                                      : SCAN_KN_CHILD_BUF(level, child - 1);
+            if (sub_prefix == NULL) {
+                continue;
+            }
+            peer = scan_kn_child(rank, dist, radix, child);
+            UCPCHECK_GOTO(ucc_tl_ucp_send_nb(sub_prefix, data_size, mem_type,
+                                             ucc_ep_map_eval(task->subset.map,
+                                                             peer),
+                                             team, task),
+                          task, out);
+            status = ucc_dt_reduce(sub_prefix,
+                                   SCAN_KN_CHILD_BUF(level, child),
+                                   SCAN_KN_CHILD_BUF(level, child), count, dt,
+                                   args, 0, 0, task->scan.executor,
+                                   &task->scan.etask);
+            if (ucc_unlikely(UCC_OK != status)) {
+                tl_error(UCC_TASK_LIB(task), "failed to perform dt reduction");
+                task->super.status = status;
+                return;
+            }
+UCC_SCAN_KN_PHASE_DOWN_REDUCE:
+            EXEC_TASK_TEST(UCC_SCAN_KN_PHASE_DOWN_REDUCE,
+                           "failed to perform dt reduction",
+                           task->scan.etask);
+            /* locals are not valid when resumed from the label above */
+            level      = task->scan.level - 1;
+            dist       = task->scan.dist / radix;
+            n_children = scan_kn_n_children(rank, dist, radix);
+        }
+        if (n_children > 0) {
+            task->scan.prefix = SCAN_KN_CHILD_BUF(level, n_children - 1);
+        }
+        task->scan.step  = 0;
+        task->scan.level = level;
+        task->scan.dist  = dist;
+    }
+
+UCC_SCAN_KN_PHASE_COMPLETE:
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        SAVE_STATE(UCC_SCAN_KN_PHASE_COMPLETE);
+        return;
+    }
+    if (task->scan.prefix) {
+        if (exclusive) {
+            status = ucc_mc_memcpy(rbuf, task->scan.prefix, data_size,
+                                   mem_type, mem_type);
+        } else {
+            status = ucc_dt_reduce(task->scan.prefix, sbuf, rbuf, count, dt,
+                                   args, 0, 0, task->scan.executor,
+                                   &task->scan.etask);
+        }
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TASK_LIB(task), "failed to update scan result");
+            task->super.status = status;
+            return;
+        }
+UCC_SCAN_KN_PHASE_COMPLETE_REDUCE:
+        EXEC_TASK_TEST(UCC_SCAN_KN_PHASE_COMPLETE_REDUCE,
+                       "failed to perform dt reduction", task->scan.etask);
+    } else if (!exclusive && !UCC_IS_INPLACE(*args)) {
+        status = ucc_mc_memcpy(rbuf, sbuf, data_size, mem_type, mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.status = status;
+            return;
+        }
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scan_kn_done", 0);
+out:
+    return;
+}
+
+static ucc_status_t ucc_tl_ucp_scan_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_coll_args_t   *args = &TASK_ARGS(task);
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scan_kn_start", 0);
+    task->scan.phase   = UCC_SCAN_KN_PHASE_INIT;
+    task->scan.partial = UCC_IS_INPLACE(*args) ? args->dst.info.buffer
+                                               : args->src.info.buffer;
+    task->scan.prefix  = NULL;
+    task->scan.dist    = 1;
+    task->scan.level   = 0;
+    task->scan.step    = 0;
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    status = ucc_coll_task_get_executor(&task->super, &task->scan.executor);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+}
+
+ucc_status_t ucc_tl_ucp_scan_knomial_init(ucc_base_coll_args_t *coll_args,
+                                          ucc_base_team_t      *team,
+                                          ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    uint32_t           cfg_radix;
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+    ucc_rank_t         rank, size;
+    ucc_kn_radix_t     radix;
+    size_t             dist, data_size, scratch_size;
+
+    SCAN_TASK_CHECK(coll_args->args, tl_team);
+    task      = ucc_tl_ucp_init_task(coll_args, team);
+    rank      = task->subset.myrank;
+    size      = (ucc_rank_t)task->subset.map.ep_num;
+    cfg_radix = UCC_TL_UCP_TEAM_LIB(tl_team)->cfg.scan_kn_radix;
+    data_size = TASK_ARGS(task).dst.info.count *
+                ucc_dt_size(TASK_ARGS(task).dst.info.datatype);
+    radix     = ucc_max(2, ucc_min(cfg_radix, size));
+
+    /* rank order defines the result, ranks are not reordered */
+    task->super.flags    |= UCC_COLL_TASK_FLAG_EXECUTOR;
+    task->super.post      = ucc_tl_ucp_scan_knomial_start;
+    task->super.progress  = ucc_tl_ucp_scan_knomial_progress;
+    task->super.finalize  = ucc_tl_ucp_scan_finalize;
+    task->scan.etask      = NULL;
+    task->scan.radix      = radix;
+    task->scan.top_level  = 0;
+    for (dist = 1; dist < size; dist *= radix) {
+        if (rank != scan_kn_leader(rank, size, dist * radix)) {
+            break;
+        }
+        task->scan.top_level++;
+    }
+
+    scratch_size = (2 + (size_t)task->scan.top_level * (radix - 1)) *
+                   data_size;
+    status = ucc_mc_alloc(&task->scan.scratch_mc_header, scratch_size,
+                          TASK_ARGS(task).dst.info.mem_type);
+    if (ucc_unlikely(status != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed to allocate scratch buffer");
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
+    task->scan.scratch = task->scan.scratch_mc_header->addr;
+    ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), scratch_size);
+    *task_h = &task->super;
+out:
+    return status;
+}
@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "scan.h"
+#include "core/ucc_progress_queue.h"
+#include "utils/ucc_dt_reduce.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+#include "utils/ucc_coll_utils.h"
+#include "components/mc/ucc_mc.h"
+#include "components/ec/ucc_ec.h"
+
+/* At step k every rank exchanges the reduction of the ranks it has covered
+   so far with rank ^ 2^k. Contribution of a lower peer is also added to the
+   result. Scratch holds the partial reduction and the received vector. */
+
+enum {
+    UCC_SCAN_RD_PHASE_INIT,
+    UCC_SCAN_RD_PHASE_LOOP,
+    UCC_SCAN_RD_PHASE_RESULT,
+    UCC_SCAN_RD_PHASE_PARTIAL
+};
+
+#define SAVE_STATE(_phase)                                                     \
+    do {                                                                       \
+        task->scan.phase = _phase;                                             \
+    } while (0)
+
+static void
+ucc_tl_ucp_scan_recursive_doubling_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task      = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_coll_args_t   *args      = &TASK_ARGS(task);
+    ucc_tl_ucp_team_t *team      = TASK_TEAM(task);
+    ucc_rank_t         size      = (ucc_rank_t)task->subset.map.ep_num;
+    ucc_rank_t         rank      = task->subset.myrank;
+    void              *rbuf      = args->dst.info.buffer;
+    ucc_memory_type_t  mem_type  = args->dst.info.mem_type;
+    size_t             count     = args->dst.info.count;
+    ucc_datatype_t     dt        = args->dst.info.datatype;
+    size_t             data_size = count * ucc_dt_size(dt);
+    int                exclusive = ucc_tl_ucp_scan_is_exclusive(task);
+    void              *pbuf      = task->scan.scratch;
+    void              *tbuf      = PTR_OFFSET(pbuf, data_size);
+    void              *sbuf      = args->src.info.buffer;
+    void              *res_src;
+    ucc_rank_t         peer;
+    ucc_status_t       status;
+
+    if (UCC_IS_INPLACE(*args)) {
+        sbuf = rbuf;
+    }
+
+    switch (task->scan.phase) {
+    case UCC_SCAN_RD_PHASE_LOOP:
+        goto UCC_SCAN_RD_PHASE_LOOP;
+    case UCC_SCAN_RD_PHASE_RESULT:
+        goto UCC_SCAN_RD_PHASE_RESULT;
+    case UCC_SCAN_RD_PHASE_PARTIAL:
+        goto UCC_SCAN_RD_PHASE_PARTIAL;
+    default:
+        break;
+    }
+
+    while (task->scan.dist < size) {
+        peer = (ucc_rank_t)(rank ^ task->scan.dist);
+        if (peer >= size) {
+            task->scan.dist <<= 1;
+            continue;
+        }
+        UCPCHECK_GOTO(ucc_tl_ucp_send_nb(task->scan.partial, data_size,
+                                         mem_type,
+                                         ucc_ep_map_eval(task->subset.map,
+                                                         peer),
+                                         team, task),
+                      task, out);
+        UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(tbuf, data_size, mem_type,
+                                         ucc_ep_map_eval(task->subset.map,
+                                                         peer),
+                                         team, task),
+                      task, out);
+UCC_SCAN_RD_PHASE_LOOP:
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            SAVE_STATE(UCC_SCAN_RD_PHASE_LOOP);
+            return;
+        }
+        peer = (ucc_rank_t)(rank ^ task->scan.dist);
+        if (peer < rank) {
+            if (exclusive && !task->scan.has_result) {
+                status = ucc_mc_memcpy(rbuf, tbuf, data_size, mem_type,
+                                       mem_type);
+            } else {
+                res_src = task->scan.has_result ? rbuf : sbuf;
+                status  = ucc_dt_reduce(tbuf, res_src, rbuf, count, dt, args,
+                                        0, 0, task->scan.executor,
+                                        &task->scan.etask);
+            }
+            if (ucc_unlikely(UCC_OK != status)) {
+                tl_error(UCC_TASK_LIB(task), "failed to update scan result");
+                task->super.status = status;
+                return;
+            }
+            task->scan.has_result = 1;
+UCC_SCAN_RD_PHASE_RESULT:
+            EXEC_TASK_TEST(UCC_SCAN_RD_PHASE_RESULT,
+                           "failed to perform dt reduction",
+                           task->scan.etask);
+        }
+        /* partial is not needed after the last exchange */
+        if ((task->scan.dist << 1) < size) {
+            status = ucc_dt_reduce(tbuf, task->scan.partial, pbuf, count, dt,
+                                   args, 0, 0, task->scan.executor,
+                                   &task->scan.etask);
+            if (ucc_unlikely(UCC_OK != status)) {
+                tl_error(UCC_TASK_LIB(task), "failed to perform dt reduction");
+                task->super.status = status;
+                return;
+            }
+            task->scan.partial = pbuf;
+UCC_SCAN_RD_PHASE_PARTIAL:
+            EXEC_TASK_TEST(UCC_SCAN_RD_PHASE_PARTIAL,
+                           "failed to perform dt reduction",
+                           task->scan.etask);
+        }
+        task->scan.dist <<= 1;
+    }
+
+    if (!exclusive && !task->scan.has_result && !UCC_IS_INPLACE(*args)) {
+        status = ucc_mc_memcpy(rbuf, sbuf, data_size, mem_type, mem_type);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.status = status;
+            return;
+        }
+    }
+    ucc_assert(UCC_TL_UCP_TASK_P2P_COMPLETE(task));
+    task->super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scan_rd_done", 0);
+out:
+    return;
+}
+
+static ucc_status_t
+ucc_tl_ucp_scan_recursive_doubling_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_coll_args_t   *args = &TASK_ARGS(task);
+    size_t             size = args->dst.info.count *
+                              ucc_dt_size(args->dst.info.datatype);
+    ucc_status_t       status;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scan_rd_start", 0);
+    task->scan.phase      = UCC_SCAN_RD_PHASE_INIT;
+    task->scan.partial    = args->src.info.buffer;
+    if (UCC_IS_INPLACE(*args)) {
+        /* dst is overwritten by the result while partial is still needed,
+           keep partial in scratch from the start */
+        status = ucc_mc_memcpy(task->scan.scratch, args->dst.info.buffer,
+                               size, args->dst.info.mem_type,
+                               args->dst.info.mem_type);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
+        task->scan.partial = task->scan.scratch;
+    }
+    task->scan.dist       = 1;
+    task->scan.has_result = 0;
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+    status = ucc_coll_task_get_executor(&task->super, &task->scan.executor);
+    if (ucc_unlikely(status != UCC_OK)) {
+        return status;
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+}
+
+ucc_status_t
+ucc_tl_ucp_scan_recursive_doubling_init_common(ucc_tl_ucp_task_t *task)
+{
+    size_t         count     = TASK_ARGS(task).dst.info.count;
+    ucc_datatype_t dt        = TASK_ARGS(task).dst.info.datatype;
+    size_t         data_size = count * ucc_dt_size(dt);
+    ucc_status_t   status;
+
+    /* rank order defines the result, ranks are not reordered */
+    task->super.flags    |= UCC_COLL_TASK_FLAG_EXECUTOR;
+    task->super.post      = ucc_tl_ucp_scan_recursive_doubling_start;
+    task->super.progress  = ucc_tl_ucp_scan_recursive_doubling_progress;
+    task->super.finalize  = ucc_tl_ucp_scan_finalize;
+    task->scan.etask      = NULL;
+
+    status = ucc_mc_alloc(&task->scan.scratch_mc_header, 2 * data_size,
+                          TASK_ARGS(task).dst.info.mem_type);
+    if (ucc_unlikely(status != UCC_OK)) {
+        tl_error(UCC_TASK_LIB(task), "failed to allocate scratch buffer");
+        return status;
+    }
+    task->scan.scratch = task->scan.scratch_mc_header->addr;
+    ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), 2 * data_size);
+    return UCC_OK;
+}
+
+ucc_status_t
+ucc_tl_ucp_scan_recursive_doubling_init(ucc_base_coll_args_t *coll_args,
+                                        ucc_base_team_t      *team,
+                                        ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_team_t *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    SCAN_TASK_CHECK(coll_args->args, tl_team);
+    task   = ucc_tl_ucp_init_task(coll_args, team);
+    status = ucc_tl_ucp_scan_recursive_doubling_init_common(task);
+    if (ucc_unlikely(status != UCC_OK)) {
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
+    *task_h = &task->super;
+out:
+    return status;
+}
@@ -19,20 +19,28 @@ ucc_base_coll_alg_info_t
             {.id   = UCC_TL_UCP_SCATTERV_ALG_LINEAR,
              .name = "linear",
              .desc = "linear scatterv algorithm"},
+        [UCC_TL_UCP_SCATTERV_ALG_KNOMIAL] =
+            {.id   = UCC_TL_UCP_SCATTERV_ALG_KNOMIAL,
+             .name = "knomial",
+             .desc = "scatterv over knomial tree with arbitrary radix"},
         [UCC_TL_UCP_SCATTERV_ALG_LAST] = {
             .id = 0, .name = NULL, .desc = NULL}};
 
-ucc_status_t ucc_tl_ucp_scatterv_linear_init(ucc_tl_ucp_task_t *task);
-
 ucc_status_t ucc_tl_ucp_scatterv_init(ucc_tl_ucp_task_t *task)
 {
     ucc_tl_ucp_team_t *team  = TASK_TEAM(task);
     ucc_coll_args_t   *args  = &TASK_ARGS(task);
     ucc_rank_t         trank = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t         tsize = UCC_TL_TEAM_SIZE(team);
 
     if (!ucc_coll_args_is_predefined_dt(args, trank)) {
         return UCC_ERR_NOT_SUPPORTED;
     }
 
-    return ucc_tl_ucp_scatterv_linear_init(task);
+    /* root handles log(size) messages instead of size, decision depends
+       only on team size so all ranks pick the same algorithm */
+    if (tsize > UCC_TL_UCP_TEAM_LIB(team)->cfg.scatterv_kn_radix) {
+        return ucc_tl_ucp_scatterv_knomial_init_common(task);
+    }
+    return ucc_tl_ucp_scatterv_linear_init_common(task);
 }
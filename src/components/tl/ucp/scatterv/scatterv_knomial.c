@@ -0,0 +1,386 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "scatterv.h"
+#include "core/ucc_progress_queue.h"
+#include "tl_ucp_sendrecv.h"
+#include "utils/ucc_math.h"
+
+/* Only root knows the counts of all ranks, so every interior node of the
+   tree first receives from its parent the per rank sizes of its subtree,
+   then the subtree data packed in vrank order, and forwards both to its
+   children. Root sends O(log(size)) messages, each of them directly from
+   src if the subtree data is contiguous there. */
+enum {
+    UCC_SCATTERV_KN_PHASE_SIZES, /* subtree sizes are received from parent */
+    UCC_SCATTERV_KN_PHASE_DATA,  /* subtree data are received from parent */
+    UCC_SCATTERV_KN_PHASE_SEND   /* children subtrees are sent */
+};
+
+static ucc_status_t
+ucc_tl_ucp_scatterv_knomial_root_post(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team    = TASK_TEAM(task);
+    ucc_coll_args_t   *args    = &TASK_ARGS(task);
+    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         rank    = UCC_TL_TEAM_RANK(team);
+    uint32_t           radix   = task->scatterv_kn.radix;
+    ucc_memory_type_t  mtype   = args->src.info_v.mem_type;
+    size_t             dt_size = ucc_dt_size(args->src.info_v.datatype);
+    void              *sbuf    = args->src.info_v.buffer;
+    size_t             offset  = 0;
+    uint64_t          *sizes   = task->scatterv_kn.sizes;
+    ucc_rank_t         child, span, peer, i;
+    size_t             msg_size, displ;
+    uint64_t           dist;
+    uint32_t           j;
+    ucc_status_t       status;
+
+    if (sizes) {
+        for (i = 0; i < size; i++) {
+            sizes[i] = ucc_coll_args_get_count(args, args->src.info_v.counts,
+                                               INV_VRANK(i, rank, size)) *
+                       dt_size;
+        }
+    }
+    for (dist = 1; dist < size; dist *= radix) {
+        for (j = 1; j < radix && j * dist < size; j++) {
+            child    = j * dist;
+            span     = ucc_min(dist, size - child);
+            peer     = INV_VRANK(child, rank, size);
+            msg_size = ucc_tl_ucp_kn_v_count(args, args->src.info_v.counts,
+                                             child, span, size) * dt_size;
+            if (span > 1) {
+                status = ucc_tl_ucp_send_nb(&sizes[child],
+                                            span * sizeof(uint64_t),
+                                            UCC_MEMORY_TYPE_HOST, peer, team,
+                                            task);
+                if (ucc_unlikely(UCC_OK != status)) {
+                    return status;
+                }
+            }
+            if (ucc_tl_ucp_kn_v_is_contig(args, args->src.info_v.counts,
+                                          args->src.info_v.displacements,
+                                          child, span, size)) {
+                displ = ucc_coll_args_get_displacement(args,
+                            args->src.info_v.displacements, peer) * dt_size;
+                status = ucc_tl_ucp_send_nz(PTR_OFFSET(sbuf, displ), msg_size,
+                                            mtype, peer, team, task);
+            } else {
+                /* pack subtree data in vrank order */
+                for (i = child; i < child + span; i++) {
+                    peer  = INV_VRANK(i, rank, size);
+                    displ = ucc_coll_args_get_displacement(args,
+                                args->src.info_v.displacements, peer) *
+                            dt_size;
+                    status = ucc_mc_memcpy(
+                        PTR_OFFSET(task->scatterv_kn.scratch, offset),
+                        PTR_OFFSET(sbuf, displ),
+                        ucc_coll_args_get_count(args, args->src.info_v.counts,
+                                                peer) * dt_size,
+                        mtype, mtype);
+                    if (ucc_unlikely(UCC_OK != status)) {
+                        return status;
+                    }
+                    offset += ucc_coll_args_get_count(args,
+                                  args->src.info_v.counts, peer) * dt_size;
+                }
+                status = ucc_tl_ucp_send_nz(
+                    PTR_OFFSET(task->scatterv_kn.scratch, offset - msg_size),
+                    msg_size, mtype, INV_VRANK(child, rank, size), team, task);
+            }
+            if (ucc_unlikely(UCC_OK != status)) {
+                return status;
+            }
+        }
+    }
+    if (!UCC_IS_INPLACE(*args)) {
+        displ  = ucc_coll_args_get_displacement(args,
+                        args->src.info_v.displacements, rank) * dt_size;
+        status = ucc_mc_memcpy(args->dst.info.buffer, PTR_OFFSET(sbuf, displ),
+                               ucc_coll_args_get_count(args,
+                                    args->src.info_v.counts, rank) * dt_size,
+                               args->dst.info.mem_type, mtype);
+        if (ucc_unlikely(UCC_OK != status)) {
+            return status;
+        }
+    }
+    return UCC_OK;
+}
+
+/* Non-root interior node: subtree sizes are known, receive subtree data */
+static ucc_status_t
+ucc_tl_ucp_scatterv_knomial_post_data(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
+    ucc_coll_args_t   *args   = &TASK_ARGS(task);
+    ucc_rank_t         size   = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root   = args->root;
+    uint32_t           radix  = task->scatterv_kn.radix;
+    ucc_rank_t         vrank  = VRANK(UCC_TL_TEAM_RANK(team), root, size);
+    ucc_rank_t         vspan  = ucc_tl_ucp_kn_tree_span(vrank, radix, size);
+    ucc_rank_t         parent = ucc_tl_ucp_kn_tree_parent(vrank, radix);
+    ucc_memory_type_t  mtype  = args->dst.info.mem_type;
+    uint64_t           total  = 0;
+    ucc_rank_t         i;
+    ucc_status_t       status;
+
+    for (i = 0; i < vspan; i++) {
+        total += task->scatterv_kn.sizes[i];
+    }
+    status = ucc_tl_ucp_kn_v_scratch_get(&task->scatterv_kn.scratch_mc_header,
+                                         &task->scatterv_kn.scratch_size,
+                                         total, mtype);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    task->scatterv_kn.scratch = task->scatterv_kn.scratch_mc_header->addr;
+    return ucc_tl_ucp_recv_nz(task->scatterv_kn.scratch, total, mtype,
+                              INV_VRANK(parent, root, size), team, task);
+}
+
+/* Non-root interior node: subtree data are received, keep own part and
+   forward sizes and data of children subtrees */
+static ucc_status_t
+ucc_tl_ucp_scatterv_knomial_forward(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team   = TASK_TEAM(task);
+    ucc_coll_args_t   *args   = &TASK_ARGS(task);
+    ucc_rank_t         size   = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root   = args->root;
+    uint32_t           radix  = task->scatterv_kn.radix;
+    ucc_rank_t         vrank  = VRANK(UCC_TL_TEAM_RANK(team), root, size);
+    ucc_rank_t         vspan  = ucc_tl_ucp_kn_tree_span(vrank, radix, size);
+    ucc_memory_type_t  mtype  = args->dst.info.mem_type;
+    uint64_t          *sizes  = task->scatterv_kn.sizes;
+    size_t             offset = sizes[0];
+    ucc_rank_t         child, span, i;
+    size_t             msg_size;
+    uint64_t           dist;
+    uint32_t           j;
+    ucc_status_t       status;
+
+    status = ucc_mc_memcpy(args->dst.info.buffer, task->scatterv_kn.scratch,
+                           sizes[0], mtype, mtype);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    for (dist = 1; dist < vspan; dist *= radix) {
+        for (j = 1; j < radix && j * dist < vspan; j++) {
+            child    = j * dist;
+            span     = ucc_min(dist, vspan - child);
+            msg_size = 0;
+            for (i = child; i < child + span; i++) {
+                msg_size += sizes[i];
+            }
+            if (span > 1) {
+                status = ucc_tl_ucp_send_nb(&sizes[child],
+                                            span * sizeof(uint64_t),
+                                            UCC_MEMORY_TYPE_HOST,
+                                            INV_VRANK(vrank + child, root,
+                                                      size),
+                                            team, task);
+                if (ucc_unlikely(UCC_OK != status)) {
+                    return status;
+                }
+            }
+            status = ucc_tl_ucp_send_nz(PTR_OFFSET(task->scatterv_kn.scratch,
+                                                   offset),
+                                        msg_size, mtype,
+                                        INV_VRANK(vrank + child, root, size),
+                                        team, task);
+            if (ucc_unlikely(UCC_OK != status)) {
+                return status;
+            }
+            offset += msg_size;
+        }
+    }
+    return UCC_OK;
+}
+
+void ucc_tl_ucp_scatterv_knomial_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_status_t       status;
+
+    if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+        return;
+    }
+    if (task->scatterv_kn.phase == UCC_SCATTERV_KN_PHASE_SIZES) {
+        status = ucc_tl_ucp_scatterv_knomial_post_data(task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.status = status;
+            return;
+        }
+        task->scatterv_kn.phase = UCC_SCATTERV_KN_PHASE_DATA;
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return;
+        }
+    }
+    if (task->scatterv_kn.phase == UCC_SCATTERV_KN_PHASE_DATA) {
+        status = ucc_tl_ucp_scatterv_knomial_forward(task);
+        if (ucc_unlikely(UCC_OK != status)) {
+            task->super.status = status;
+            return;
+        }
+        task->scatterv_kn.phase = UCC_SCATTERV_KN_PHASE_SEND;
+        if (UCC_INPROGRESS == ucc_tl_ucp_test(task)) {
+            return;
+        }
+    }
+    task->super.status = UCC_OK;
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scatterv_kn_done", 0);
+}
+
+ucc_status_t ucc_tl_ucp_scatterv_knomial_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task  = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team  = TASK_TEAM(task);
+    ucc_coll_args_t   *args  = &TASK_ARGS(task);
+    ucc_rank_t         size  = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         root  = args->root;
+    uint32_t           radix = task->scatterv_kn.radix;
+    ucc_rank_t         vrank = VRANK(UCC_TL_TEAM_RANK(team), root, size);
+    ucc_rank_t         vspan = ucc_tl_ucp_kn_tree_span(vrank, radix, size);
+    ucc_rank_t         parent;
+
+    UCC_TL_UCP_PROFILE_REQUEST_EVENT(coll_task, "ucp_scatterv_kn_start", 0);
+    ucc_tl_ucp_task_reset(task, UCC_INPROGRESS);
+
+    if (vrank == 0) {
+        task->scatterv_kn.phase = UCC_SCATTERV_KN_PHASE_SEND;
+        UCPCHECK_GOTO(ucc_tl_ucp_scatterv_knomial_root_post(task), task, out);
+    } else {
+        parent = INV_VRANK(ucc_tl_ucp_kn_tree_parent(vrank, radix), root,
+                           size);
+        if (vspan == 1) {
+            task->scatterv_kn.phase = UCC_SCATTERV_KN_PHASE_SEND;
+            UCPCHECK_GOTO(ucc_tl_ucp_recv_nz(args->dst.info.buffer,
+                                             args->dst.info.count *
+                                             ucc_dt_size(
+                                                 args->dst.info.datatype),
+                                             args->dst.info.mem_type, parent,
+                                             team, task),
+                          task, out);
+        } else {
+            task->scatterv_kn.phase = UCC_SCATTERV_KN_PHASE_SIZES;
+            UCPCHECK_GOTO(ucc_tl_ucp_recv_nb(task->scatterv_kn.sizes,
+                                             vspan * sizeof(uint64_t),
+                                             UCC_MEMORY_TYPE_HOST, parent,
+                                             team, task),
+                          task, out);
+        }
+    }
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+out:
+    return task->super.status;
+}
+
+ucc_status_t ucc_tl_ucp_scatterv_knomial_finalize(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+
+    if (task->scatterv_kn.scratch_mc_header) {
+        ucc_mc_free(task->scatterv_kn.scratch_mc_header);
+    }
+    ucc_free(task->scatterv_kn.sizes);
+    return ucc_tl_ucp_coll_finalize(coll_task);
+}
+
+ucc_status_t ucc_tl_ucp_scatterv_knomial_init_common(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team    = TASK_TEAM(task);
+    ucc_coll_args_t   *args    = &TASK_ARGS(task);
+    ucc_rank_t         size    = UCC_TL_TEAM_SIZE(team);
+    ucc_rank_t         vrank   = VRANK(UCC_TL_TEAM_RANK(team), args->root,
+                                       size);
+    uint32_t           radix   = ucc_min(
+        UCC_TL_UCP_TEAM_LIB(team)->cfg.scatterv_kn_radix, size);
+    size_t             scratch = 0;
+    size_t             n_sizes = 0;
+    ucc_rank_t         vspan, child, span;
+    uint64_t           dist;
+    uint32_t           j;
+    ucc_status_t       status;
+
+    radix                               = ucc_max(radix, 2);
+    task->super.post                    = ucc_tl_ucp_scatterv_knomial_start;
+    task->super.progress                = ucc_tl_ucp_scatterv_knomial_progress;
+    task->super.finalize                = ucc_tl_ucp_scatterv_knomial_finalize;
+    task->scatterv_kn.radix             = radix;
+    task->scatterv_kn.sizes             = NULL;
+    task->scatterv_kn.scratch           = NULL;
+    task->scatterv_kn.scratch_size      = 0;
+    task->scatterv_kn.scratch_mc_header = NULL;
+
+    vspan = ucc_tl_ucp_kn_tree_span(vrank, radix, size);
+    if (vrank == 0) {
+        /* scratch for subtrees that are not contiguous in src */
+        for (dist = 1; dist < size; dist *= radix) {
+            for (j = 1; j < radix && j * dist < size; j++) {
+                child = j * dist;
+                span  = ucc_min(dist, size - child);
+                if (span > 1) {
+                    n_sizes = size;
+                }
+                if (!ucc_tl_ucp_kn_v_is_contig(args, args->src.info_v.counts,
+                                               args->src.info_v.displacements,
+                                               child, span, size)) {
+                    scratch += ucc_tl_ucp_kn_v_count(args,
+                                                     args->src.info_v.counts,
+                                                     child, span, size);
+                }
+            }
+        }
+        if (scratch > 0) {
+            scratch *= ucc_dt_size(args->src.info_v.datatype);
+            status = ucc_mc_alloc(&task->scatterv_kn.scratch_mc_header,
+                                  scratch, args->src.info_v.mem_type);
+            if (ucc_unlikely(UCC_OK != status)) {
+                return status;
+            }
+            ucc_coll_stats_add_scratch(TASK_CORE_TEAM(task), scratch);
+            task->scatterv_kn.scratch =
+                task->scatterv_kn.scratch_mc_header->addr;
+        }
+    } else if (vspan > 1) {
+        n_sizes = vspan;
+    }
+    if (n_sizes > 0) {
+        task->scatterv_kn.sizes = ucc_malloc(n_sizes * sizeof(uint64_t),
+                                             "scatterv_kn_sizes");
+        if (ucc_unlikely(!task->scatterv_kn.sizes)) {
+            tl_error(UCC_TL_TEAM_LIB(team),
+                     "failed to allocate %zd bytes for subtree sizes",
+                     n_sizes * sizeof(uint64_t));
+            if (task->scatterv_kn.scratch_mc_header) {
+                ucc_mc_free(task->scatterv_kn.scratch_mc_header);
+                task->scatterv_kn.scratch_mc_header = NULL;
+            }
+            return UCC_ERR_NO_MEMORY;
+        }
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_scatterv_knomial_init(ucc_base_coll_args_t *coll_args,
+                                              ucc_base_team_t      *team,
+                                              ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_task_t *task;
+    ucc_status_t       status;
+
+    task   = ucc_tl_ucp_init_task(coll_args, team);
+    status = ucc_tl_ucp_scatterv_knomial_init_common(task);
+    if (ucc_unlikely(UCC_OK != status)) {
+        ucc_tl_ucp_put_task(task);
+        return status;
+    }
+    *task_h = &task->super;
+    return UCC_OK;
+}
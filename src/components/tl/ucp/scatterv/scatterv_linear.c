@@ -114,7 +114,7 @@ error:
 
 }
 
-ucc_status_t ucc_tl_ucp_scatterv_linear_init(ucc_tl_ucp_task_t *task)
+ucc_status_t ucc_tl_ucp_scatterv_linear_init_common(ucc_tl_ucp_task_t *task)
 {
     task->super.post     = ucc_tl_ucp_scatterv_linear_start;
     task->super.progress = ucc_tl_ucp_scatterv_linear_progress;
@@ -122,3 +122,15 @@ ucc_status_t ucc_tl_ucp_scatterv_linear_init(ucc_tl_ucp_task_t *task)
     task->n_polls = ucc_max(1, task->n_polls);
     return UCC_OK;
 }
+
+ucc_status_t ucc_tl_ucp_scatterv_linear_init(ucc_base_coll_args_t *coll_args,
+                                             ucc_base_team_t      *team,
+                                             ucc_coll_task_t     **task_h)
+{
+    ucc_tl_ucp_task_t *task;
+
+    task = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_tl_ucp_scatterv_linear_init_common(task);
+    *task_h = &task->super;
+    return UCC_OK;
+}
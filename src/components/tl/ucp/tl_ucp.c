@@ -17,6 +17,7 @@
 #include "allgatherv/allgatherv.h"
 #include "reduce_scatter/reduce_scatter.h"
 #include "reduce_scatterv/reduce_scatterv.h"
+#include "scan/scan.h"
 #include "reduce/reduce.h"
 #include "gather/gather.h"
 #include "gatherv/gatherv.h"
@@ -32,6 +33,12 @@ ucc_status_t ucc_tl_ucp_get_lib_properties(ucc_base_lib_properties_t *prop);
 ucc_status_t ucc_tl_ucp_get_context_attr(const ucc_base_context_t *context,
                                          ucc_base_ctx_attr_t      *base_attr);
 
+static const char *wire_dts[] = {
+    [UCC_TL_UCP_WIRE_DT_BF16] = "bf16",
+    [UCC_TL_UCP_WIRE_DT_FP16] = "fp16",
+    [UCC_TL_UCP_WIRE_DT_LAST] = NULL
+};
+
 ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
     {"", "", NULL, ucc_offsetof(ucc_tl_ucp_lib_config_t, super),
      UCC_CONFIG_TYPE_TABLE(ucc_tl_lib_config_table)},
@@ -42,6 +49,12 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, alltoall_pairwise_num_posts),
      UCC_CONFIG_TYPE_ULUNITS},
 
+    {"ALLTOALL_BRUCK_RADIX", "2",
+     "Radix of the Bruck alltoall algorithm. Can be set per message size "
+     "range, e.g. 0-4k:8,2",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, alltoall_bruck_radix),
+     UCC_CONFIG_TYPE_UINT_RANGED},
+
     {"ALLTOALLV_PAIRWISE_NUM_POSTS", "auto",
      "Maximum number of outstanding send and receive messages in alltoallv "
      "pairwise algorithm",
@@ -126,11 +139,29 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sra_kn_radix),
      UCC_CONFIG_TYPE_UINT_RANGED},
 
+    {"ALLREDUCE_SPARSE_KN_RADIX", "2",
+     "Radix of the sparse recursive knomial allreduce algorithm",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sparse_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
+    {"ALLREDUCE_SPARSE_DENSITY", "10",
+     "Maximum percentage of non zero elements for which sparse allreduce "
+     "sends index/value pairs instead of the dense vector",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sparse_density),
+     UCC_CONFIG_TYPE_UINT},
+
     {"ALLREDUCE_SRA_KN_PIPELINE", "auto",
      "Pipelining settings for SRA Knomial allreduce algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, allreduce_sra_kn_pipeline),
      UCC_CONFIG_TYPE_PIPELINE_PARAMS},
 
+    {"GENERIC_DT_PIPELINE", "thresh=0:fragsize=256K:nfrags=1:pdepth=2:ordered",
+     "Pipelining settings for collectives over generic non-contiguous "
+     "datatypes: pack of the next fragment overlaps with the transfer "
+     "of the previous one",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, generic_dt_pipeline),
+     UCC_CONFIG_TYPE_PIPELINE_PARAMS},
+
     {"REDUCE_SCATTER_KN_RADIX", "4",
      "Radix of the knomial reduce-scatter algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_scatter_kn_radix),
@@ -157,12 +188,23 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, gather_kn_radix),
      UCC_CONFIG_TYPE_UINT},
 
+    {"SCAN_KN_RADIX", "4",
+     "Radix of the knomial up/down sweep scan and exscan algorithm",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, scan_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
     {"GATHERV_LINEAR_NUM_POSTS", "0",
      "Maximum number of outstanding send and receive messages in gatherv "
      "linear algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, gatherv_linear_num_posts),
      UCC_CONFIG_TYPE_UINT},
 
+    {"GATHERV_KN_RADIX", "4",
+     "Radix of the knomial gatherv algorithm, also the team size up to which "
+     "linear gatherv is used by default",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, gatherv_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
     {"SCATTER_KN_RADIX", "4", "Radix of the knomial scatter algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, scatter_kn_radix),
      UCC_CONFIG_TYPE_UINT},
@@ -178,6 +220,12 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, scatterv_linear_num_posts),
      UCC_CONFIG_TYPE_UINT},
 
+    {"SCATTERV_KN_RADIX", "4",
+     "Radix of the knomial scatterv algorithm, also the team size up to "
+     "which linear scatterv is used by default",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, scatterv_kn_radix),
+     UCC_CONFIG_TYPE_UINT},
+
     {"REDUCE_AVG_PRE_OP", "1",
      "Reduce will perform division by team_size in early stages of the "
      "algorithm,\n"
@@ -185,6 +233,14 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_avg_pre_op),
      UCC_CONFIG_TYPE_BOOL},
 
+    {"REDUCE_WIRE_DT", "bf16",
+     "16 bit format used on the wire for float32 reductions requested with "
+     "UCC_COLL_ARGS_FLAG_REDUCED_PRECISION\n"
+     "bf16 - bfloat16, keeps the float32 range\n"
+     "fp16 - IEEE half precision, keeps more mantissa bits",
+     ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_wire_dt),
+     UCC_CONFIG_TYPE_ENUM(wire_dts)},
+
     {"REDUCE_SCATTER_RING_BIDIRECTIONAL", "y",
      "Launch 2 inverted rings concurrently during ReduceScatter Ring algorithm",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, reduce_scatter_ring_bidirectional),
@@ -202,7 +258,8 @@ ucc_config_field_t ucc_tl_ucp_lib_config_table[] = {
      UCC_CONFIG_TYPE_TERNARY},
 
     {"RANKS_REORDERING", "y",
-     "Use topology information in TL UCP to reorder ranks. Requires topo info",
+     "Use topology information in TL UCP to reorder ranks by host, socket "
+     "and numa for ring and knomial algorithms. Requires topo info",
      ucc_offsetof(ucc_tl_ucp_lib_config_t, use_reordering),
      UCC_CONFIG_TYPE_BOOL},
 
@@ -220,9 +277,28 @@ static ucs_config_field_t ucc_tl_ucp_context_config_table[] = {
      UCC_CONFIG_TYPE_UINT},
 
     {"NPOLLS", "10",
-     "Number of ucp progress polling cycles for p2p requests testing",
+     "Number of ucp progress polling cycles for p2p requests testing. With "
+     "COALESCED_PROGRESS it also limits the number of worker polls done by "
+     "all the tasks within a single context progress call",
      ucc_offsetof(ucc_tl_ucp_context_config_t, n_polls), UCC_CONFIG_TYPE_UINT},
 
+    {"COALESCED_PROGRESS", "y",
+     "Share ucp worker progress between all the outstanding tasks within a "
+     "single context progress call. Number of worker polls per call adapts "
+     "between 1 and NPOLLS depending on whether polls of the previous call "
+     "progressed any communication. Once polls are exhausted the tasks only "
+     "check their completion counters. If disabled, every task polls the "
+     "worker up to NPOLLS times. Not used with UCC_THREAD_MULTIPLE",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, coalesced_progress),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"WAKEUP", "n",
+     "Enable ucp worker wakeup feature and register worker event fds into "
+     "the ucc context, so that ucc_context_wait can sleep instead of busy "
+     "polling",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, wakeup),
+     UCC_CONFIG_TYPE_BOOL},
+
     {"OOB_NPOLLS", "20",
      "Number of polling cycles for oob allgather and service coll request",
      ucc_offsetof(ucc_tl_ucp_context_config_t, oob_npolls),
@@ -246,6 +322,14 @@ static ucs_config_field_t ucc_tl_ucp_context_config_table[] = {
      ucc_offsetof(ucc_tl_ucp_context_config_t, service_throttling_thresh),
      UCC_CONFIG_TYPE_UINT},
 
+    {"MAX_EPS", "0",
+     "Maximal number of connected endpoints per ucp worker. Least recently "
+     "used endpoints are closed once the limit is reached and reconnected "
+     "on demand. 0 - unlimited. Ignored if memory is mapped for one-sided "
+     "collectives",
+     ucc_offsetof(ucc_tl_ucp_context_config_t, max_eps),
+     UCC_CONFIG_TYPE_UINT},
+
     {NULL}};
 
 UCC_CLASS_DEFINE_NEW_FUNC(ucc_tl_ucp_lib_t, ucc_base_lib_t,
@@ -380,6 +464,10 @@ __attribute__((constructor)) static void tl_ucp_iface_init(void)
         ucc_tl_ucp_reduce_scatterv_algs;
     ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_SCATTERV)] =
         ucc_tl_ucp_scatterv_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_SCAN)] =
+        ucc_tl_ucp_scan_algs;
+    ucc_tl_ucp.super.alg_info[ucc_ilog2(UCC_COLL_TYPE_EXSCAN)] =
+        ucc_tl_ucp_scan_algs;
 
     /* no need to check return value, plugins can be absent */
     (void)ucc_components_load("tlcp_ucp", &ucc_tl_ucp.super.coll_plugins);
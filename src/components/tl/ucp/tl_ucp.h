@@ -42,6 +42,12 @@ typedef struct ucc_tl_ucp_iface {
 /* Extern iface should follow the pattern: ucc_tl_<tl_name> */
 extern ucc_tl_ucp_iface_t ucc_tl_ucp;
 
+typedef enum ucc_tl_ucp_wire_dt {
+    UCC_TL_UCP_WIRE_DT_BF16,
+    UCC_TL_UCP_WIRE_DT_FP16,
+    UCC_TL_UCP_WIRE_DT_LAST
+} ucc_tl_ucp_wire_dt_t;
+
 typedef struct ucc_tl_ucp_lib_config {
     ucc_tl_lib_config_t      super;
     uint32_t                 kn_radix;
@@ -53,6 +59,8 @@ typedef struct ucc_tl_ucp_lib_config {
     uint32_t                 allreduce_sliding_window_num_get_bufs;
     ucc_mrange_uint_t        allreduce_kn_radix;
     ucc_mrange_uint_t        allreduce_sra_kn_radix;
+    uint32_t                 allreduce_sparse_kn_radix;
+    uint32_t                 allreduce_sparse_density;
     uint32_t                 reduce_scatter_kn_radix;
     uint32_t                 allgather_kn_radix;
     uint32_t                 bcast_kn_radix;
@@ -60,15 +68,21 @@ typedef struct ucc_tl_ucp_lib_config {
     uint32_t                 reduce_kn_radix;
     uint32_t                 gather_kn_radix;
     uint32_t                 gatherv_linear_num_posts;
+    uint32_t                 gatherv_kn_radix;
     uint32_t                 scatter_kn_radix;
     ucc_on_off_auto_value_t  scatter_kn_enable_recv_zcopy;
     uint32_t                 scatterv_linear_num_posts;
+    uint32_t                 scatterv_kn_radix;
+    uint32_t                 scan_kn_radix;
     unsigned long            alltoall_pairwise_num_posts;
+    ucc_mrange_uint_t        alltoall_bruck_radix;
     unsigned long            alltoallv_pairwise_num_posts;
     ucc_pipeline_params_t    allreduce_sra_kn_pipeline;
+    ucc_pipeline_params_t    generic_dt_pipeline;
     int                      reduce_avg_pre_op;
     int                      reduce_scatter_ring_bidirectional;
     int                      reduce_scatterv_ring_bidirectional;
+    int                      reduce_wire_dt;
     uint32_t                 alltoallv_hybrid_radix;
     size_t                   alltoallv_hybrid_buff_size;
     size_t                   alltoallv_hybrid_chunk_byte_limit;
@@ -83,10 +97,13 @@ typedef struct ucc_tl_ucp_context_config {
     ucc_tl_context_config_t super;
     uint32_t                preconnect;
     uint32_t                n_polls;
+    int                     coalesced_progress;
+    int                     wakeup;
     uint32_t                oob_npolls;
     uint32_t                pre_reg_mem;
     uint32_t                service_worker;
     uint32_t                service_throttling_thresh;
+    uint32_t                max_eps;
 } ucc_tl_ucp_context_config_t;
 
 typedef ucc_tl_ucp_lib_config_t ucc_tl_ucp_team_config_t;
@@ -114,6 +131,31 @@ typedef struct ucc_tl_ucp_worker {
     ucp_address_t *   worker_address;
     tl_ucp_ep_hash_t *ep_hash;
     ucp_ep_h *        eps;
+    /* coalesced progress state: context progress pass the counters belong
+       to, worker polls done by tasks in the pass, polls that progressed
+       something and adaptive polls budget of the pass. Not synchronized,
+       used only if the context is not UCC_THREAD_MULTIPLE */
+    uint32_t          pass_seq;
+    uint32_t          pass_polls;
+    uint32_t          pass_hits;
+    uint32_t          pass_budget;
+    uint32_t          pass_max_budget;
+    /* worker event fd registered in the core context epoll set, -1 if
+       wakeup is disabled */
+    int               efd;
+    /* bounded ep cache, enabled if ep_lru_max > 0: connected eps in least
+       recently used order, lookup of lru entry by ep, evicted eps whose
+       close is still in progress and sends waiting for that close to
+       reconnect */
+    uint32_t          ep_lru_max;
+    uint32_t          ep_lru_n;
+    ucc_list_link_t   ep_lru;
+    ucc_list_link_t   ep_closing;
+    ucc_list_link_t   ep_pending;
+    int               ep_pending_retry;
+    tl_ucp_ep_lru_hash_t *ep_lru_hash;
+    uint64_t          n_ep_evictions;
+    uint64_t          n_ep_reconnects;
 } ucc_tl_ucp_worker_t;
 
 typedef struct ucc_tl_ucp_context {
@@ -167,7 +209,50 @@ extern ucc_config_field_t ucc_tl_ucp_lib_config_table[];
      UCC_COLL_TYPE_REDUCE |                                                    \
      UCC_COLL_TYPE_REDUCE_SCATTER |                                            \
      UCC_COLL_TYPE_REDUCE_SCATTERV |                                           \
-     UCC_COLL_TYPE_SCATTERV)
+     UCC_COLL_TYPE_SCATTERV |                                                  \
+     UCC_COLL_TYPE_SCAN |                                                      \
+     UCC_COLL_TYPE_EXSCAN |                                                    \
+     UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV |                                        \
+     UCC_COLL_TYPE_NEIGHBOR_ALLGATHER)
+
+static inline void ucc_tl_ucp_worker_pass_init(ucc_tl_ucp_worker_t *worker,
+                                               uint32_t max_budget)
+{
+    worker->pass_seq        = 0;
+    worker->pass_polls      = 0;
+    worker->pass_hits       = 0;
+    worker->pass_max_budget = ucc_max(max_budget, 1);
+    worker->pass_budget     = worker->pass_max_budget;
+}
+
+/* Polls the worker on behalf of a task unless the budget of the current
+   context progress pass is exhausted. Budget is adjusted once per pass: it
+   is halved if polls of the previous pass found nothing and doubled if they
+   kept finding events until the budget ran out.
+   Returns 0 if the worker was not polled. */
+static inline int ucc_tl_ucp_worker_pass_poll(ucc_tl_ucp_worker_t *worker,
+                                              uint32_t             seq)
+{
+    if (worker->pass_seq != seq) {
+        if (worker->pass_polls > 0 && worker->pass_hits == 0) {
+            worker->pass_budget = ucc_max(worker->pass_budget / 2, 1);
+        } else if (worker->pass_polls >= worker->pass_budget) {
+            worker->pass_budget = ucc_min(worker->pass_budget * 2,
+                                          worker->pass_max_budget);
+        }
+        worker->pass_seq   = seq;
+        worker->pass_polls = 0;
+        worker->pass_hits  = 0;
+    }
+    if (worker->pass_polls >= worker->pass_budget) {
+        return 0;
+    }
+    worker->pass_polls++;
+    if (ucp_worker_progress(worker->ucp_worker)) {
+        worker->pass_hits++;
+    }
+    return 1;
+}
 
 #define UCC_TL_UCP_TEAM_LIB(_team)                                             \
     (ucc_derived_of((_team)->super.super.context->lib, ucc_tl_ucp_lib_t))
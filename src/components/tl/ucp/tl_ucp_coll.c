@@ -23,6 +23,8 @@
 #include "fanin/fanin.h"
 #include "fanout/fanout.h"
 #include "scatterv/scatterv.h"
+#include "scan/scan.h"
+#include "neighbor/neighbor.h"
 
 const ucc_tl_ucp_default_alg_desc_t
     ucc_tl_ucp_default_alg_descs[UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR] = {
@@ -61,6 +63,14 @@ const ucc_tl_ucp_default_alg_desc_t
         {
             .select_str = UCC_TL_UCP_ALLTOALLV_DEFAULT_ALG_SELECT_STR,
             .str_get_fn = NULL
+        },
+        {
+            .select_str = UCC_TL_UCP_SCAN_DEFAULT_ALG_SELECT_STR,
+            .str_get_fn = NULL
+        },
+        {
+            .select_str = UCC_TL_UCP_EXSCAN_DEFAULT_ALG_SELECT_STR,
+            .str_get_fn = NULL
         }
 };
 
@@ -163,9 +173,13 @@ ucc_status_t ucc_tl_ucp_coll_init(ucc_base_coll_args_t *coll_args,
                                   ucc_base_team_t *team,
                                   ucc_coll_task_t **task_h)
 {
-    ucc_tl_ucp_task_t    *task = ucc_tl_ucp_init_task(coll_args, team);
+    ucc_tl_ucp_task_t    *task;
     ucc_status_t          status;
 
+    UCC_TL_UCP_DT_GENERIC_CHECK(coll_args, team, ucc_tl_ucp_coll_init,
+                                task_h);
+
+    task = ucc_tl_ucp_init_task(coll_args, team);
     switch (coll_args->args.coll_type) {
     case UCC_COLL_TYPE_BARRIER:
         status = ucc_tl_ucp_barrier_init(task);
@@ -206,6 +220,16 @@ ucc_status_t ucc_tl_ucp_coll_init(ucc_base_coll_args_t *coll_args,
     case UCC_COLL_TYPE_GATHERV:
         status = ucc_tl_ucp_gatherv_init(task);
         break;
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
+        status = ucc_tl_ucp_scan_init(task);
+        break;
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
+        status = ucc_tl_ucp_neighbor_alltoallv_init(task);
+        break;
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
+        status = ucc_tl_ucp_neighbor_allgather_init(task);
+        break;
     default:
         status = UCC_ERR_NOT_SUPPORTED;
     }
@@ -233,12 +257,19 @@ static inline int alg_id_from_str(ucc_coll_type_t coll_type, const char *str)
         return ucc_tl_ucp_alltoallv_alg_from_str(str);
     case UCC_COLL_TYPE_BCAST:
         return ucc_tl_ucp_bcast_alg_from_str(str);
+    case UCC_COLL_TYPE_GATHERV:
+        return ucc_tl_ucp_gatherv_alg_from_str(str);
     case UCC_COLL_TYPE_REDUCE:
         return ucc_tl_ucp_reduce_alg_from_str(str);
     case UCC_COLL_TYPE_REDUCE_SCATTER:
         return ucc_tl_ucp_reduce_scatter_alg_from_str(str);
     case UCC_COLL_TYPE_REDUCE_SCATTERV:
         return ucc_tl_ucp_reduce_scatterv_alg_from_str(str);
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
+        return ucc_tl_ucp_scan_alg_from_str(str);
+    case UCC_COLL_TYPE_SCATTERV:
+        return ucc_tl_ucp_scatterv_alg_from_str(str);
     default:
         break;
     }
@@ -306,6 +337,9 @@ ucc_status_t ucc_tl_ucp_alg_id_to_init(int alg_id, const char *alg_id_str,
         case UCC_TL_UCP_ALLREDUCE_ALG_SLIDING_WINDOW:
             *init = ucc_tl_ucp_allreduce_sliding_window_init;
             break;
+        case UCC_TL_UCP_ALLREDUCE_ALG_SPARSE:
+            *init = ucc_tl_ucp_allreduce_sparse_init;
+            break;
         default:
             status = UCC_ERR_INVALID_PARAM;
             break;
@@ -327,6 +361,19 @@ ucc_status_t ucc_tl_ucp_alg_id_to_init(int alg_id, const char *alg_id_str,
            break;
         };
         break;
+    case UCC_COLL_TYPE_GATHERV:
+        switch (alg_id) {
+        case UCC_TL_UCP_GATHERV_ALG_LINEAR:
+            *init = ucc_tl_ucp_gatherv_linear_init;
+            break;
+        case UCC_TL_UCP_GATHERV_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_gatherv_knomial_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
     case UCC_COLL_TYPE_ALLTOALL:
         switch (alg_id) {
         case UCC_TL_UCP_ALLTOALL_ALG_PAIRWISE:
@@ -395,6 +442,33 @@ ucc_status_t ucc_tl_ucp_alg_id_to_init(int alg_id, const char *alg_id_str,
             break;
         };
         break;
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
+        switch (alg_id) {
+        case UCC_TL_UCP_SCAN_ALG_RECURSIVE_DOUBLING:
+            *init = ucc_tl_ucp_scan_recursive_doubling_init;
+            break;
+        case UCC_TL_UCP_SCAN_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_scan_knomial_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
+    case UCC_COLL_TYPE_SCATTERV:
+        switch (alg_id) {
+        case UCC_TL_UCP_SCATTERV_ALG_LINEAR:
+            *init = ucc_tl_ucp_scatterv_linear_init;
+            break;
+        case UCC_TL_UCP_SCATTERV_ALG_KNOMIAL:
+            *init = ucc_tl_ucp_scatterv_knomial_init;
+            break;
+        default:
+            status = UCC_ERR_INVALID_PARAM;
+            break;
+        };
+        break;
     default:
         status = UCC_ERR_NOT_SUPPORTED;
         break;
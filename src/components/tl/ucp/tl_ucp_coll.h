@@ -15,10 +15,11 @@
 #include "components/mc/base/ucc_mc_base.h"
 #include "components/ec/ucc_ec.h"
 #include "tl_ucp_tag.h"
+#include "tl_ucp_ep.h"
 
 #define UCC_UUNITS_AUTO_RADIX 4
 #define UCC_TL_UCP_TASK_PLUGIN_MAX_DATA 128
-#define UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR 9
+#define UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR 11
 
 ucc_status_t ucc_tl_ucp_team_default_score_str_alloc(ucc_tl_ucp_team_t *team,
     char *default_select_str[UCC_TL_UCP_N_DEFAULT_ALG_SELECT_STR]);
@@ -40,6 +41,100 @@ void ucc_tl_ucp_team_default_score_str_free(
 #define INV_VRANK(_rank, _root, _team_size)                                   \
     (((_rank) + (_root)) % (_team_size))
 
+/* Knomial tree rooted at vrank 0 used by gatherv and scatterv: subtree of
+   vrank v covers vranks [v, v + span) and children of v are v + j * dist,
+   j = 1 .. radix - 1, for dist = 1, radix, radix^2, ... < span.
+   Returns the span of vrank subtree. */
+static inline ucc_rank_t ucc_tl_ucp_kn_tree_span(ucc_rank_t vrank,
+                                                 uint32_t radix,
+                                                 ucc_rank_t size)
+{
+    uint64_t dist = 1;
+
+    while (dist < size && (vrank % (dist * radix)) == 0) {
+        dist *= radix;
+    }
+    return (ucc_rank_t)ucc_min(dist, size - vrank);
+}
+
+static inline ucc_rank_t ucc_tl_ucp_kn_tree_parent(ucc_rank_t vrank,
+                                                   uint32_t radix)
+{
+    uint64_t dist = 1;
+
+    ucc_assert(vrank != 0);
+    while ((vrank % (dist * radix)) == 0) {
+        dist *= radix;
+    }
+    return vrank - (ucc_rank_t)(((vrank / dist) % radix) * dist);
+}
+
+/* Checks if data of vranks [vstart, vstart + n) is stored contiguously in
+   the v buffer of the root, so it can be sent or received in place */
+static inline int ucc_tl_ucp_kn_v_is_contig(ucc_coll_args_t   *args,
+                                            const ucc_count_t *counts,
+                                            const ucc_aint_t  *displs,
+                                            ucc_rank_t vstart, ucc_rank_t n,
+                                            ucc_rank_t size)
+{
+    ucc_rank_t r = INV_VRANK(vstart, args->root, size);
+    ucc_rank_t i;
+
+    if (r + n > size) {
+        return 0;
+    }
+    for (i = r + 1; i < r + n; i++) {
+        if (ucc_coll_args_get_displacement(args, displs, i) !=
+            ucc_coll_args_get_displacement(args, displs, i - 1) +
+            ucc_coll_args_get_count(args, counts, i - 1)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Number of elements of vranks [vstart, vstart + n) in the root v buffer */
+static inline size_t ucc_tl_ucp_kn_v_count(ucc_coll_args_t   *args,
+                                           const ucc_count_t *counts,
+                                           ucc_rank_t vstart, ucc_rank_t n,
+                                           ucc_rank_t size)
+{
+    size_t     count = 0;
+    ucc_rank_t i;
+
+    for (i = vstart; i < vstart + n; i++) {
+        count += ucc_coll_args_get_count(args, counts,
+                                         INV_VRANK(i, args->root, size));
+    }
+    return count;
+}
+
+/* Scratch of non-root interior node is allocated on data phase, once the
+   subtree size is known. It is kept between starts of persistent coll and
+   reallocated only if the subtree size grows */
+static inline ucc_status_t
+ucc_tl_ucp_kn_v_scratch_get(ucc_mc_buffer_header_t **header,
+                            size_t *scratch_size, size_t size,
+                            ucc_memory_type_t mtype)
+{
+    ucc_status_t status;
+
+    if (*header && size <= *scratch_size) {
+        return UCC_OK;
+    }
+    if (*header) {
+        ucc_mc_free(*header);
+        *header       = NULL;
+        *scratch_size = 0;
+    }
+    status = ucc_mc_alloc(header, size, mtype);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    *scratch_size = size;
+    return UCC_OK;
+}
+
 #define EXEC_TASK_TEST(_phase, _errmsg, _etask) do {                           \
     if (_etask != NULL) {                                                      \
         status = ucc_ee_executor_task_test(_etask);                            \
@@ -86,7 +181,14 @@ typedef struct ucc_tl_ucp_default_alg_desc {
 
 enum ucc_tl_ucp_task_flags {
     /*indicates whether subset field of tl_ucp_task is set*/
-    UCC_TL_UCP_TASK_FLAG_SUBSET = UCC_BIT(0),
+    UCC_TL_UCP_TASK_FLAG_SUBSET     = UCC_BIT(0),
+    /*indicates that subset is the team ordered by host, socket and numa,
+      while root in coll args is still given in team rank space*/
+    UCC_TL_UCP_TASK_FLAG_REORDERED  = UCC_BIT(1),
+    /*tag and active set are given in coll args, cached so that send/recv
+      and progress do not read args*/
+    UCC_TL_UCP_TASK_FLAG_USER_TAG   = UCC_BIT(2),
+    UCC_TL_UCP_TASK_FLAG_ACTIVE_SET = UCC_BIT(3),
 };
 
 typedef struct ucc_tl_ucp_allreduce_sw_pipeline
@@ -98,7 +200,10 @@ typedef struct ucc_tl_ucp_dpu_offload_buf_info
 
 typedef struct ucc_tl_ucp_task {
     ucc_coll_task_t super;
-    uint32_t        flags;
+    /* Hot part: flags, p2p counters and n_polls are read by send/recv and
+       test on every progress pass. Start them on a new cache line so that
+       they do not share it with the tail of super (bargs) */
+    uint32_t        flags __attribute__((aligned(UCC_CACHE_LINE_SIZE)));
     union {
         struct {
             uint32_t        send_posted;
@@ -129,6 +234,14 @@ typedef struct ucc_tl_ucp_task {
             ucc_ee_executor_task_t *etask;
             ucc_ee_executor_t      *executor;
         } allreduce_kn;
+        struct {
+            int                     phase;
+            ucc_knomial_pattern_t   p;
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+            size_t                  slot_size;
+            size_t                  max_nnz;
+        } allreduce_sparse;
         struct {
             ucc_tl_ucp_allreduce_sw_pipeline          *pipe;
             ucs_status_ptr_t                          *put_requests;
@@ -153,6 +266,7 @@ typedef struct ucc_tl_ucp_task {
             int                     n_frags;
             int                     frag;
             char                    s_scratch_busy[2];
+            ucc_datatype_t          wire_dt;
             ucc_ee_executor_task_t *etask;
             ucc_ee_executor_t      *executor;
         } reduce_scatter_ring;
@@ -166,6 +280,23 @@ typedef struct ucc_tl_ucp_task {
             ucc_ee_executor_task_t *etask;
             ucc_ee_executor_t      *executor;
         } reduce_scatterv_ring;
+        struct {
+            int                     phase;
+            void                   *scratch;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+            ucc_ee_executor_task_t *etask;
+            ucc_ee_executor_t      *executor;
+            /* reduction of the ranks covered so far */
+            void                   *partial;
+            /* exclusive prefix of the rank (knomial), NULL if not known */
+            void                   *prefix;
+            size_t                  dist;
+            ucc_kn_radix_t          radix;
+            int                     level;
+            int                     top_level;
+            ucc_rank_t              step;
+            int                     has_result;
+        } scan;
         struct {
             int                     phase;
             ucc_knomial_pattern_t   p;
@@ -209,6 +340,7 @@ typedef struct ucc_tl_ucp_task {
         struct {
             ucc_rank_t              dist;
             uint32_t                radix;
+            ucc_rank_t              root;
         } bcast_kn;
         struct {
             ucc_dbt_single_tree_t   t1;
@@ -220,6 +352,7 @@ typedef struct ucc_tl_ucp_task {
             ucc_rank_t              max_dist;
             int                     children_per_cycle;
             uint32_t                radix;
+            ucc_rank_t              root;
             int                     phase;
             void                   *scratch;
             ucc_mc_buffer_header_t *scratch_mc_header;
@@ -245,6 +378,23 @@ typedef struct ucc_tl_ucp_task {
             void *                  scratch;
             ucc_mc_buffer_header_t *scratch_mc_header;
         } gather_kn;
+        struct {
+            int                     phase;
+            uint32_t                radix;
+            uint64_t                total;
+            uint64_t               *sizes;
+            void                   *scratch;
+            size_t                  scratch_size;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } gatherv_kn;
+        struct {
+            int                     phase;
+            uint32_t                radix;
+            uint64_t               *sizes;
+            void                   *scratch;
+            size_t                  scratch_size;
+            ucc_mc_buffer_header_t *scratch_mc_header;
+        } scatterv_kn;
         struct {
             size_t                  merge_buf_size;
             ucc_mc_buffer_header_t *scratch_mc_header;
@@ -265,9 +415,21 @@ typedef struct ucc_tl_ucp_task {
             ucc_ee_executor_task_t *etask;
             void                   *src;
             void                   *dst;
+            void                   *storage;
+            void                   *pack;
+            size_t                  stride;
+            size_t                  max_blocks;
+            uint32_t                radix;
+            ucc_rank_t              step;
             ucc_rank_t              iteration;
             int                     phase;
         } alltoall_bruck;
+        struct {
+            struct ucc_tl_ucp_dt_generic *dtg;
+            void                         *scratch;
+            int                           frag_num;
+            int                           unpack;
+        } dt_generic;
         char                        plugin_data[UCC_TL_UCP_TASK_PLUGIN_MAX_DATA];
     };
 } ucc_tl_ucp_task_t;
@@ -275,6 +437,8 @@ typedef struct ucc_tl_ucp_task {
 typedef struct ucc_tl_ucp_schedule {
     ucc_schedule_pipelined_t super;
     ucc_mc_buffer_header_t  *scratch_mc_header;
+    /* pack/unpack state of generic datatype collectives */
+    struct ucc_tl_ucp_dt_generic *dt_generic;
 } ucc_tl_ucp_schedule_t;
 
 #define TASK_TEAM(_task)                                                       \
@@ -284,8 +448,48 @@ typedef struct ucc_tl_ucp_schedule {
 #define TASK_LIB(_task)                                                        \
     (ucc_derived_of((_task)->super.team->context->lib, ucc_tl_ucp_lib_t))
 #define TASK_ARGS(_task) (_task)->super.bargs.args
+#define TASK_CORE_TEAM(_task) (_task)->super.bargs.team
+/* user tag bits of the ucp tag, same as (args.mask & UCC_COLL_ARGS_FIELD_TAG)
+   but taken from the task flags */
+#define TASK_USER_TAG(_task)                                                   \
+    (((_task)->flags & UCC_TL_UCP_TASK_FLAG_USER_TAG)                          \
+         ? UCC_COLL_ARGS_FIELD_TAG                                             \
+         : 0)
+
+/* number of contributions is the size of the active set if one is used */
+#define AVG_ALPHA(_task)                                                       \
+    (1.0 / (double)(((_task)->flags & UCC_TL_UCP_TASK_FLAG_ACTIVE_SET)         \
+                        ? (_task)->subset.map.ep_num                           \
+                        : UCC_TL_TEAM_SIZE(TASK_TEAM(_task))))
+
+/* Switches the task to the team ranks ordered by host, socket and numa, so
+   that ring and knomial algorithms cross socket and node boundaries
+   a minimal number of times. Applies only to the tasks over the full team. */
+static inline void ucc_tl_ucp_task_reorder_ranks(ucc_tl_ucp_task_t *task)
+{
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+    ucc_sbgp_t        *sbgp;
 
-#define AVG_ALPHA(_task) (1.0 / (double)UCC_TL_TEAM_SIZE(TASK_TEAM(_task)))
+    if ((task->flags & UCC_TL_UCP_TASK_FLAG_SUBSET) ||
+        !team->cfg.use_reordering) {
+        return;
+    }
+    sbgp = ucc_topo_get_sbgp(team->topo, UCC_SBGP_FULL_HOST_ORDERED);
+    task->flags        |= UCC_TL_UCP_TASK_FLAG_REORDERED;
+    task->subset.myrank = sbgp->group_rank;
+    task->subset.map    = sbgp->map;
+}
+
+/* Converts root from team rank space into the task subset rank space */
+static inline ucc_rank_t ucc_tl_ucp_task_subset_root(ucc_tl_ucp_task_t *task,
+                                                     ucc_rank_t         root)
+{
+    if (task->flags &
+        (UCC_TL_UCP_TASK_FLAG_ACTIVE_SET | UCC_TL_UCP_TASK_FLAG_REORDERED)) {
+        return ucc_ep_map_local_rank(task->subset.map, root);
+    }
+    return root;
+}
 
 static inline void ucc_tl_ucp_task_reset(ucc_tl_ucp_task_t *task,
                                          ucc_status_t status)
@@ -300,7 +504,9 @@ static inline void ucc_tl_ucp_task_reset(ucc_tl_ucp_task_t *task,
 static inline ucc_tl_ucp_task_t *ucc_tl_ucp_get_task(ucc_tl_ucp_team_t *team)
 {
     ucc_tl_ucp_context_t *ctx  = UCC_TL_UCP_TEAM_CTX(team);
-    ucc_tl_ucp_task_t    *task = ucc_mpool_get(&ctx->req_mp);;
+    ucc_tl_ucp_task_t    *task;
+
+    task = (ucc_tl_ucp_task_t *)ucc_mpool_get(&ctx->req_mp);
 
     UCC_TL_UCP_PROFILE_REQUEST_NEW(task, "tl_ucp_task", 0);
     task->super.flags       = 0;
@@ -327,7 +533,7 @@ ucc_tl_ucp_get_schedule(ucc_tl_ucp_team_t *team,
 {
     ucc_tl_ucp_context_t  *ctx = UCC_TL_UCP_TEAM_CTX(team);
 
-    *schedule = ucc_mpool_get(&ctx->req_mp);
+    *schedule = (ucc_tl_ucp_schedule_t *)ucc_mpool_get(&ctx->req_mp);
     if (ucc_unlikely(!(*schedule))) {
         return UCC_ERR_NO_MEMORY;
     }
@@ -361,15 +567,18 @@ ucc_tl_ucp_init_task(ucc_base_coll_args_t *coll_args, ucc_base_team_t *team)
 
     ucc_coll_task_init(&task->super, coll_args, team);
 
+    if (coll_args->args.mask & UCC_COLL_ARGS_FIELD_TAG) {
+        task->flags |= UCC_TL_UCP_TASK_FLAG_USER_TAG;
+    }
     if (UCC_COLL_ARGS_ACTIVE_SET(&coll_args->args)) {
         task->tagged.tag = (coll_args->args.mask & UCC_COLL_ARGS_FIELD_TAG)
             ? coll_args->args.tag : UCC_TL_UCP_ACTIVE_SET_TAG;
-        task->flags        |= UCC_TL_UCP_TASK_FLAG_SUBSET;
+        task->flags        |= UCC_TL_UCP_TASK_FLAG_SUBSET |
+                              UCC_TL_UCP_TASK_FLAG_ACTIVE_SET;
         task->subset.map    = ucc_active_set_to_ep_map(&coll_args->args);
         task->subset.myrank =
             ucc_ep_map_local_rank(task->subset.map,
                                   UCC_TL_TEAM_RANK(tl_team));
-        ucc_assert(coll_args->args.coll_type == UCC_COLL_TYPE_BCAST);
     } else {
         if (coll_args->args.mask & UCC_COLL_ARGS_FIELD_TAG) {
             task->tagged.tag = coll_args->args.tag;
@@ -383,6 +592,23 @@ ucc_tl_ucp_init_task(ucc_base_coll_args_t *coll_args, ucc_base_team_t *team)
     return task;
 }
 
+/* Progresses the worker on behalf of the task. Returns 0 if the poll budget
+   of the current context progress pass is exhausted, in which case the task
+   should only check its completion counters */
+static inline int ucc_tl_ucp_task_poll(ucc_tl_ucp_task_t   *task,
+                                       ucc_tl_ucp_worker_t *worker)
+{
+    if (ucc_unlikely(!ucc_list_is_empty(&worker->ep_pending))) {
+        ucc_tl_ucp_ep_pending_progress(worker);
+    }
+    if (!TASK_CTX(task)->cfg.coalesced_progress) {
+        ucp_worker_progress(worker->ucp_worker);
+        return 1;
+    }
+    return ucc_tl_ucp_worker_pass_poll(worker,
+                                       UCC_TASK_CORE_CTX(task)->progress_seq);
+}
+
 #define UCC_TL_UCP_TASK_P2P_COMPLETE(_task)                                    \
     (((_task)->tagged.send_posted == (_task)->tagged.send_completed) &&        \
      ((_task)->tagged.recv_posted == (_task)->tagged.recv_completed))
@@ -398,7 +624,9 @@ static inline ucc_status_t ucc_tl_ucp_test(ucc_tl_ucp_task_t *task)
         if (UCC_TL_UCP_TASK_P2P_COMPLETE(task)) {
             return UCC_OK;
         }
-        ucp_worker_progress(UCC_TL_UCP_TASK_TEAM(task)->worker->ucp_worker);
+        if (!ucc_tl_ucp_task_poll(task, UCC_TL_UCP_TASK_TEAM(task)->worker)) {
+            break;
+        }
     }
     return UCC_INPROGRESS;
 }
@@ -420,7 +648,9 @@ static inline ucc_status_t ucc_tl_ucp_test_recv(ucc_tl_ucp_task_t *task)
         if (UCC_TL_UCP_TASK_RECV_COMPLETE(task)) {
             return UCC_OK;
         }
-        ucp_worker_progress(UCC_TL_UCP_TASK_TEAM(task)->worker->ucp_worker);
+        if (!ucc_tl_ucp_task_poll(task, UCC_TL_UCP_TASK_TEAM(task)->worker)) {
+            break;
+        }
     }
     return UCC_INPROGRESS;
 }
@@ -436,7 +666,9 @@ static inline ucc_status_t ucc_tl_ucp_test_send(ucc_tl_ucp_task_t *task)
         if (UCC_TL_UCP_TASK_SEND_COMPLETE(task)) {
             return UCC_OK;
         }
-        ucp_worker_progress(UCC_TL_UCP_TASK_TEAM(task)->worker->ucp_worker);
+        if (!ucc_tl_ucp_task_poll(task, UCC_TL_UCP_TASK_TEAM(task)->worker)) {
+            break;
+        }
     }
     return UCC_INPROGRESS;
 }
@@ -456,7 +688,9 @@ static inline ucc_status_t ucc_tl_ucp_test_ring(ucc_tl_ucp_task_t *task)
         if (UCC_TL_UCP_TASK_RING_P2P_COMPLETE(task)) {
             return UCC_OK;
         }
-        ucp_worker_progress(TASK_CTX(task)->worker.ucp_worker);
+        if (!ucc_tl_ucp_task_poll(task, &TASK_CTX(task)->worker)) {
+            break;
+        }
     }
     return UCC_INPROGRESS;
 }
@@ -482,7 +716,9 @@ static inline ucc_status_t ucc_tl_ucp_test_onesided(ucc_tl_ucp_task_t *task,
             UCC_TL_UCP_TASK_ONESIDED_SYNC_COMPLETE(task, sync_end)) {
             return UCC_OK;
         }
-        ucp_worker_progress(UCC_TL_UCP_TASK_TEAM(task)->worker->ucp_worker);
+        if (!ucc_tl_ucp_task_poll(task, UCC_TL_UCP_TASK_TEAM(task)->worker)) {
+            break;
+        }
     }
     return UCC_INPROGRESS;
 }
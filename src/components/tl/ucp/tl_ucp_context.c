@@ -29,12 +29,26 @@
         goto go;                                                               \
     }
 
+static unsigned ucc_tl_ucp_worker_progress(void *progress_arg)
+{
+    ucc_tl_ucp_worker_t *worker = (ucc_tl_ucp_worker_t *)progress_arg;
+
+    if (ucc_unlikely(!ucc_list_is_empty(&worker->ep_pending))) {
+        ucc_tl_ucp_ep_pending_progress(worker);
+    }
+    return ucp_worker_progress(worker->ucp_worker);
+}
+
 unsigned ucc_tl_ucp_service_worker_progress(void *progress_arg)
 {
     ucc_tl_ucp_context_t *ctx = (ucc_tl_ucp_context_t *)progress_arg;
     int                   throttling_count =
         ucc_atomic_fadd32(&ctx->service_worker_throttling_count, 1);
 
+    if (ucc_unlikely(!ucc_list_is_empty(&ctx->service_worker.ep_pending))) {
+        ucc_tl_ucp_ep_pending_progress(&ctx->service_worker);
+    }
+
     if (throttling_count == ctx->cfg.service_throttling_thresh) {
         ctx->service_worker_throttling_count = 0;
         return ucp_worker_progress(ctx->service_worker.ucp_worker);
@@ -43,6 +57,53 @@ unsigned ucc_tl_ucp_service_worker_progress(void *progress_arg)
     return 0;
 }
 
+static ucc_status_t ucc_tl_ucp_worker_arm(void *arm_arg)
+{
+    ucs_status_t status = ucp_worker_arm((ucp_worker_h)arm_arg);
+
+    if (status == UCS_ERR_BUSY) {
+        return UCC_INPROGRESS;
+    }
+    return ucs_status_to_ucc_status(status);
+}
+
+/* Registers worker event fd into the core context. Failure is not fatal:
+   ucc_context_wait falls back to bounded sleep for this worker. */
+static void ucc_tl_ucp_worker_wakeup_init(ucc_tl_ucp_context_t *ctx,
+                                          ucc_tl_ucp_worker_t  *worker)
+{
+    ucs_status_t status;
+    int          efd;
+
+    worker->efd = -1;
+    if (!ctx->cfg.wakeup) {
+        return;
+    }
+    status = ucp_worker_get_efd(worker->ucp_worker, &efd);
+    if (UCS_OK != status) {
+        tl_warn(ctx->super.super.lib, "failed to get ucp worker efd, %s",
+                ucs_status_string(status));
+        return;
+    }
+    if (UCC_OK != ucc_context_event_fd_register(ctx->super.super.ucc_context,
+                                                efd, ucc_tl_ucp_worker_arm,
+                                                worker->ucp_worker)) {
+        tl_warn(ctx->super.super.lib, "failed to register ucp worker efd");
+        return;
+    }
+    worker->efd = efd;
+}
+
+static void ucc_tl_ucp_worker_wakeup_cleanup(ucc_tl_ucp_context_t *ctx,
+                                             ucc_tl_ucp_worker_t  *worker)
+{
+    if (worker->efd >= 0) {
+        ucc_context_event_fd_deregister(ctx->super.super.ucc_context,
+                                        worker->efd);
+        worker->efd = -1;
+    }
+}
+
 static inline ucc_status_t
 ucc_tl_ucp_eps_ephash_init(const ucc_base_context_params_t *params,
                            ucc_tl_ucp_context_t *           ctx,
@@ -100,12 +161,17 @@ ucc_tl_ucp_context_service_init(const char *prefix, ucp_params_t ucp_params,
     ctx->service_worker.ucp_context    = ucp_context_service;
     ctx->service_worker.ucp_worker     = ucp_worker_service;
     ctx->service_worker.worker_address = NULL;
+    ucc_tl_ucp_worker_pass_init(&ctx->service_worker, ctx->cfg.n_polls);
+    ctx->service_worker.efd            = -1;
 
     CHECK(UCC_OK != ucc_tl_ucp_eps_ephash_init(params, ctx,
                                                &ctx->service_worker.ep_hash,
                                                &ctx->service_worker.eps),
           "failed to allocate memory for endpoint storage for service worker",
           err_thread_mode, UCC_ERR_NO_MESSAGE, ctx);
+    CHECK(UCC_OK != ucc_tl_ucp_ep_lru_init(&ctx->service_worker, ctx),
+          "failed to init endpoint cache for service worker", err_thread_mode,
+          UCC_ERR_NO_MESSAGE, ctx);
 
     ctx->service_worker_throttling_count = 0;
     CHECK(UCC_OK !=
@@ -155,6 +221,13 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
                               params->context);
     memcpy(&self->cfg, tl_ucp_config, sizeof(*tl_ucp_config));
     lib = ucc_derived_of(self->super.super.lib, ucc_tl_ucp_lib_t);
+    if (self->cfg.coalesced_progress &&
+        params->thread_mode == UCC_THREAD_MULTIPLE) {
+        /* pass counters of the worker are not synchronized */
+        tl_debug(self->super.super.lib,
+                 "coalesced progress is disabled for UCC_THREAD_MULTIPLE");
+        self->cfg.coalesced_progress = 0;
+    }
     prefix = strdup(params->prefix);
     if (!prefix) {
         tl_error(self->super.super.lib, "failed to duplicate prefix str");
@@ -167,6 +240,9 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
     ucp_params.field_mask =
         UCP_PARAM_FIELD_FEATURES | UCP_PARAM_FIELD_TAG_SENDER_MASK | UCP_PARAM_FIELD_NAME;
     ucp_params.features = UCP_FEATURE_TAG | UCP_FEATURE_AM;
+    if (self->cfg.wakeup) {
+        ucp_params.features |= UCP_FEATURE_WAKEUP;
+    }
     if (params->params.mask & UCC_CONTEXT_PARAM_FIELD_MEM_PARAMS) {
         ucp_params.features |= UCP_FEATURE_RMA | UCP_FEATURE_AMO64;
     }
@@ -226,6 +302,8 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
     self->worker.ucp_context    = ucp_context;
     self->worker.ucp_worker     = ucp_worker;
     self->worker.worker_address = NULL;
+    ucc_tl_ucp_worker_pass_init(&self->worker, self->cfg.n_polls);
+    self->worker.efd            = -1;
 
     self->topo_required = (((lib->cfg.use_topo == UCC_TRY ||
                              lib->cfg.use_topo == UCC_AUTO) &&
@@ -246,8 +324,8 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
 
     CHECK(UCC_OK != ucc_context_progress_register(
                         params->context,
-                        (ucc_context_progress_fn_t)ucp_worker_progress,
-                        self->worker.ucp_worker),
+                        (ucc_context_progress_fn_t)ucc_tl_ucp_worker_progress,
+                        &self->worker),
           "failed to register progress function", err_thread_mode,
           UCC_ERR_NO_MESSAGE, self);
 
@@ -268,6 +346,9 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
                         params, self, &self->worker.ep_hash, &self->worker.eps),
           "failed to allocate memory for endpoint storage", err_thread_mode,
           UCC_ERR_NO_MESSAGE, self);
+    CHECK(UCC_OK != ucc_tl_ucp_ep_lru_init(&self->worker, self),
+          "failed to init endpoint cache", err_thread_mode, UCC_ERR_NO_MESSAGE,
+          self);
 
     if (self->cfg.service_worker) {
         CHECK(UCC_OK != ucc_tl_ucp_context_service_init(
@@ -278,6 +359,11 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_context_t,
     ucc_free(prefix);
     prefix = NULL;
 
+    ucc_tl_ucp_worker_wakeup_init(self, &self->worker);
+    if (self->cfg.service_worker) {
+        ucc_tl_ucp_worker_wakeup_init(self, &self->service_worker);
+    }
+
     tl_debug(self->super.super.lib, "initialized tl context: %p", self);
     return UCC_OK;
 
@@ -387,10 +473,14 @@ UCC_CLASS_CLEANUP_FUNC(ucc_tl_ucp_context_t)
     if (self->remote_info) {
         ucc_tl_ucp_rinfo_destroy(self);
     }
+    ucc_tl_ucp_worker_wakeup_cleanup(self, &self->worker);
+    if (self->cfg.service_worker != 0) {
+        ucc_tl_ucp_worker_wakeup_cleanup(self, &self->service_worker);
+    }
     ucc_context_progress_deregister(
         self->super.super.ucc_context,
-        (ucc_context_progress_fn_t)ucp_worker_progress,
-        self->worker.ucp_worker);
+        (ucc_context_progress_fn_t)ucc_tl_ucp_worker_progress,
+        &self->worker);
     if (self->cfg.service_worker != 0) {
         ucc_context_progress_deregister(
             self->super.super.ucc_context,
@@ -0,0 +1,625 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "tl_ucp.h"
+#include "tl_ucp_coll.h"
+#include "tl_ucp_dt_generic.h"
+#include "core/ucc_progress_queue.h"
+#include "core/ucc_coll_stats.h"
+#include "components/mc/ucc_mc.h"
+#include "utils/ucc_coll_utils.h"
+
+/* Number of user buffer blocks the rank packs into the scratch (unpack = 0)
+   or unpacks from the scratch (unpack = 1) */
+static ucc_rank_t
+ucc_tl_ucp_dt_generic_n_blocks(const ucc_coll_args_t *args, ucc_rank_t rank,
+                               ucc_rank_t size, int unpack)
+{
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BCAST:
+        if (UCC_IS_ROOT(*args, rank)) {
+            return unpack ? 0 : 1;
+        }
+        return unpack ? 1 : 0;
+    case UCC_COLL_TYPE_ALLGATHER:
+    case UCC_COLL_TYPE_ALLGATHERV:
+        return unpack ? size : 1;
+    default:
+        return size;
+    }
+}
+
+/* Count and displacement (in elements) of the user buffer block "i". Block
+   "i" is stored at the i-th stride of the scratch. Blocks which are already
+   in place have zero count. */
+static void ucc_tl_ucp_dt_generic_block(const ucc_coll_args_t *args,
+                                        ucc_rank_t rank, ucc_rank_t size,
+                                        int unpack, ucc_rank_t i,
+                                        size_t *count, size_t *displ)
+{
+    int    inplace = UCC_IS_INPLACE(*args);
+    size_t c;
+
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BCAST:
+        *count = args->src.info.count;
+        *displ = 0;
+        break;
+    case UCC_COLL_TYPE_ALLGATHER:
+        c = args->dst.info.count / size;
+        if (!unpack) {
+            *count = c;
+            *displ = inplace ? rank * c : 0;
+        } else {
+            *count = (inplace && i == rank) ? 0 : c;
+            *displ = i * c;
+        }
+        break;
+    case UCC_COLL_TYPE_ALLGATHERV:
+        if (!unpack) {
+            *count = inplace ? ucc_coll_args_get_count(
+                                   args, args->dst.info_v.counts, rank)
+                             : args->src.info.count;
+            *displ = inplace ? ucc_coll_args_get_displacement(
+                                   args, args->dst.info_v.displacements, rank)
+                             : 0;
+        } else {
+            *count = (inplace && i == rank)
+                         ? 0
+                         : ucc_coll_args_get_count(args,
+                                                   args->dst.info_v.counts, i);
+            *displ = ucc_coll_args_get_displacement(
+                args, args->dst.info_v.displacements, i);
+        }
+        break;
+    case UCC_COLL_TYPE_ALLTOALL:
+        c      = args->dst.info.count / size;
+        *count = c;
+        *displ = i * c;
+        break;
+    case UCC_COLL_TYPE_ALLTOALLV:
+        if (!unpack) {
+            *count = ucc_coll_args_get_count(args, args->src.info_v.counts, i);
+            *displ = ucc_coll_args_get_displacement(
+                args, args->src.info_v.displacements, i);
+        } else {
+            *count = ucc_coll_args_get_count(args, args->dst.info_v.counts, i);
+            *displ = ucc_coll_args_get_displacement(
+                args, args->dst.info_v.displacements, i);
+        }
+        break;
+    default:
+        *count = 0;
+        *displ = 0;
+        break;
+    }
+}
+
+static void ucc_tl_ucp_dt_side_start(ucc_tl_ucp_dt_side_t *side, int unpack)
+{
+    ucc_dt_generic_t *dt_gen;
+
+    if (!UCC_DT_IS_NONCONTIG(side->dt) || side->count == 0) {
+        return;
+    }
+    dt_gen      = ucc_dt_to_generic(side->dt);
+    side->state = unpack ? dt_gen->ops.start_unpack(dt_gen->context,
+                                                    side->buffer, side->count)
+                         : dt_gen->ops.start_pack(dt_gen->context,
+                                                  side->buffer, side->count);
+}
+
+static void ucc_tl_ucp_dt_side_finish(ucc_tl_ucp_dt_side_t *side)
+{
+    if (side->state) {
+        ucc_dt_to_generic(side->dt)->ops.finish(side->state);
+        side->state = NULL;
+    }
+}
+
+/* Copies "len" bytes at "offset" of the packed stream of the user buffer
+   to (unpack = 0) or from (unpack = 1) the scratch */
+static inline ucc_status_t ucc_tl_ucp_dt_side_copy(ucc_tl_ucp_dt_side_t *side,
+                                                   int unpack, size_t offset,
+                                                   void *scratch, size_t len)
+{
+    ucc_dt_generic_t *dt_gen;
+
+    if (!side->state) {
+        if (unpack) {
+            memcpy(PTR_OFFSET(side->buffer, offset), scratch, len);
+        } else {
+            memcpy(scratch, PTR_OFFSET(side->buffer, offset), len);
+        }
+        return UCC_OK;
+    }
+    dt_gen = ucc_dt_to_generic(side->dt);
+    if (unpack) {
+        return dt_gen->ops.unpack(side->state, offset, scratch, len);
+    }
+    return (dt_gen->ops.pack(side->state, offset, scratch, len) == len)
+               ? UCC_OK
+               : UCC_ERR_NO_MESSAGE;
+}
+
+static void ucc_tl_ucp_dt_generic_copy_progress(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t       *task   = ucc_derived_of(coll_task,
+                                                     ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t       *team   = TASK_TEAM(task);
+    ucc_tl_ucp_dt_generic_t *dtg    = task->dt_generic.dtg;
+    int                      unpack = task->dt_generic.unpack;
+    int                      frag   = task->dt_generic.frag_num;
+    ucc_rank_t               rank   = UCC_TL_TEAM_RANK(team);
+    ucc_rank_t               size   = UCC_TL_TEAM_SIZE(team);
+    ucc_tl_ucp_dt_side_t    *side   = unpack ? &dtg->dst : &dtg->src;
+    size_t                   stride = unpack ? dtg->dst_stride
+                                             : dtg->src_stride;
+    ucc_status_t             status = UCC_OK;
+    size_t                   count, displ, bytes, offset, len;
+    ucc_rank_t               i, n_blocks;
+
+    n_blocks = ucc_tl_ucp_dt_generic_n_blocks(&TASK_ARGS(task), rank, size,
+                                              unpack);
+    for (i = 0; i < n_blocks; i++) {
+        ucc_tl_ucp_dt_generic_block(&TASK_ARGS(task), rank, size, unpack, i,
+                                    &count, &displ);
+        bytes  = count * dtg->elem_size;
+        offset = ucc_buffer_block_offset(bytes, dtg->n_frags, frag);
+        len    = ucc_buffer_block_count(bytes, dtg->n_frags, frag);
+        if (len == 0) {
+            continue;
+        }
+        status = ucc_tl_ucp_dt_side_copy(
+            side, unpack, displ * dtg->elem_size + offset,
+            PTR_OFFSET(task->dt_generic.scratch, i * stride), len);
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TASK_LIB(task), "failed to %s generic datatype",
+                     unpack ? "unpack" : "pack");
+            break;
+        }
+    }
+    task->super.status = status;
+}
+
+static ucc_status_t ucc_tl_ucp_dt_generic_copy_start(ucc_coll_task_t *coll_task)
+{
+    ucc_tl_ucp_task_t *task = ucc_derived_of(coll_task, ucc_tl_ucp_task_t);
+    ucc_tl_ucp_team_t *team = TASK_TEAM(task);
+
+    task->super.status = UCC_INPROGRESS;
+    return ucc_progress_queue_enqueue(UCC_TL_CORE_CTX(team)->pq, &task->super);
+}
+
+static ucc_coll_task_t *
+ucc_tl_ucp_dt_generic_copy_init(ucc_base_coll_args_t    *coll_args,
+                                ucc_tl_ucp_team_t       *team,
+                                ucc_tl_ucp_dt_generic_t *dtg, void *scratch,
+                                int unpack)
+{
+    ucc_tl_ucp_task_t *task = ucc_tl_ucp_get_task(team);
+
+    ucc_coll_task_init(&task->super, coll_args, &team->super.super);
+    task->super.post           = ucc_tl_ucp_dt_generic_copy_start;
+    task->super.progress       = ucc_tl_ucp_dt_generic_copy_progress;
+    task->super.finalize       = ucc_tl_ucp_coll_finalize;
+    task->dt_generic.dtg       = dtg;
+    task->dt_generic.scratch   = scratch;
+    task->dt_generic.frag_num  = 0;
+    task->dt_generic.unpack    = unpack;
+    return &task->super;
+}
+
+static ucc_status_t ucc_tl_ucp_dt_generic_frag_start(ucc_coll_task_t *task)
+{
+    return ucc_schedule_start(task);
+}
+
+static ucc_status_t ucc_tl_ucp_dt_generic_frag_finalize(ucc_coll_task_t *task)
+{
+    ucc_tl_ucp_schedule_t *frag = ucc_derived_of(task, ucc_tl_ucp_schedule_t);
+    ucc_status_t           status;
+
+    status = ucc_schedule_finalize(task);
+    ucc_mc_free(frag->scratch_mc_header);
+    ucc_tl_ucp_put_schedule(&frag->super.super);
+    return status;
+}
+
+static ucc_status_t
+ucc_tl_ucp_dt_generic_frag_setup(ucc_schedule_pipelined_t *schedule_p, //NOLINT
+                                 ucc_schedule_t *frag, int frag_num)
+{
+    ucc_tl_ucp_task_t *task;
+
+    task = ucc_derived_of(frag->tasks[0], ucc_tl_ucp_task_t); /* pack */
+    task->dt_generic.frag_num = frag_num;
+    task = ucc_derived_of(frag->tasks[2], ucc_tl_ucp_task_t); /* unpack */
+    task->dt_generic.frag_num = frag_num;
+    return UCC_OK;
+}
+
+/* Fragment: pack -> algorithm over UCC_DT_UINT8 -> unpack. Counts of the
+   fragment collective are fixed to the largest fragment, so the algorithm
+   args don't change between fragments; smaller fragments carry padding. */
+static ucc_status_t
+ucc_tl_ucp_dt_generic_frag_init(ucc_base_coll_args_t     *coll_args,
+                                ucc_schedule_pipelined_t *sp,
+                                ucc_base_team_t          *team,
+                                ucc_schedule_t          **frag_p)
+{
+    ucc_tl_ucp_team_t       *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_tl_ucp_dt_generic_t *dtg     =
+        ucc_derived_of(sp, ucc_tl_ucp_schedule_t)->dt_generic;
+    ucc_coll_args_t         *args    = &coll_args->args;
+    ucc_rank_t               rank    = UCC_TL_TEAM_RANK(tl_team);
+    ucc_rank_t               size    = UCC_TL_TEAM_SIZE(tl_team);
+    ucc_base_coll_args_t     bargs   = *coll_args;
+    ucc_coll_args_t         *fargs   = &bargs.args;
+    size_t                   src_size, dst_size, arr_size;
+    ucc_tl_ucp_schedule_t   *frag;
+    ucc_coll_task_t         *pack, *coll, *unpack;
+    uint64_t                *counts;
+    void                    *src, *dst;
+    ucc_status_t             status;
+    ucc_rank_t               i;
+
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BCAST:
+        src_size = dtg->src_stride;
+        dst_size = 0;
+        arr_size = 0;
+        break;
+    case UCC_COLL_TYPE_ALLGATHER:
+    case UCC_COLL_TYPE_ALLGATHERV:
+        src_size = dtg->src_stride;
+        dst_size = size * dtg->dst_stride;
+        arr_size = (args->coll_type == UCC_COLL_TYPE_ALLGATHERV) ?
+                   2 * size * sizeof(uint64_t) : 0;
+        break;
+    default:
+        src_size = size * dtg->src_stride;
+        dst_size = size * dtg->dst_stride;
+        arr_size = (args->coll_type == UCC_COLL_TYPE_ALLTOALLV) ?
+                   4 * size * sizeof(uint64_t) : 0;
+        break;
+    }
+
+    status = ucc_tl_ucp_get_schedule(tl_team, coll_args, &frag);
+    if (ucc_unlikely(UCC_OK != status)) {
+        return status;
+    }
+    status = ucc_mc_alloc(&frag->scratch_mc_header,
+                          src_size + dst_size + arr_size,
+                          UCC_MEMORY_TYPE_HOST);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "failed to allocate scratch for generic datatype");
+        ucc_tl_ucp_put_schedule(&frag->super.super);
+        return status;
+    }
+    ucc_coll_stats_add_scratch(coll_args->team,
+                               src_size + dst_size + arr_size);
+    src    = frag->scratch_mc_header->addr;
+    dst    = (args->coll_type == UCC_COLL_TYPE_BCAST) ?
+             src : PTR_OFFSET(src, src_size);
+    counts = PTR_OFFSET(src, src_size + dst_size);
+
+    bargs.mask  &= ~(UCC_BASE_CARGS_MAX_FRAG_COUNT | UCC_BASE_CARGS_MSGSIZE);
+    bargs.asymmetric_save_info.scratch = NULL;
+    fargs->mask |= UCC_COLL_ARGS_FIELD_FLAGS;
+    fargs->flags &= ~(UCC_COLL_ARGS_FLAG_IN_PLACE |
+                      UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+                      UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT);
+    fargs->src.info.datatype = UCC_DT_UINT8;
+    fargs->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    fargs->dst.info.datatype = UCC_DT_UINT8;
+    fargs->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BCAST:
+        fargs->src.info.buffer = src;
+        fargs->src.info.count  = dtg->src_stride;
+        break;
+    case UCC_COLL_TYPE_ALLGATHER:
+        fargs->src.info.buffer = src;
+        fargs->src.info.count  = dtg->src_stride;
+        fargs->dst.info.buffer = dst;
+        fargs->dst.info.count  = size * dtg->dst_stride;
+        break;
+    case UCC_COLL_TYPE_ALLTOALL:
+        fargs->src.info.buffer = src;
+        fargs->src.info.count  = size * dtg->src_stride;
+        fargs->dst.info.buffer = dst;
+        fargs->dst.info.count  = size * dtg->dst_stride;
+        break;
+    case UCC_COLL_TYPE_ALLGATHERV:
+        for (i = 0; i < size; i++) {
+            counts[i] = ucc_buffer_block_count(
+                ucc_coll_args_get_count(args, args->dst.info_v.counts, i) *
+                    dtg->elem_size,
+                dtg->n_frags, 0);
+            counts[size + i] = i * dtg->dst_stride;
+        }
+        fargs->flags |= UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+                        UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT;
+        fargs->src.info.buffer               = src;
+        fargs->src.info.count                = counts[rank];
+        fargs->dst.info_v.buffer             = dst;
+        fargs->dst.info_v.counts             = (ucc_count_t *)counts;
+        fargs->dst.info_v.displacements      = (ucc_aint_t *)&counts[size];
+        fargs->dst.info_v.datatype           = UCC_DT_UINT8;
+        fargs->dst.info_v.mem_type           = UCC_MEMORY_TYPE_HOST;
+        break;
+    case UCC_COLL_TYPE_ALLTOALLV:
+        for (i = 0; i < size; i++) {
+            counts[i] = ucc_coll_args_get_count(args, args->src.info_v.counts,
+                                                i) * dtg->elem_size;
+            counts[size + i]     = i * dtg->src_stride;
+            counts[2 * size + i] = ucc_coll_args_get_count(
+                                       args, args->dst.info_v.counts, i) *
+                                   dtg->elem_size;
+            counts[3 * size + i] = i * dtg->dst_stride;
+        }
+        fargs->flags |= UCC_COLL_ARGS_FLAG_COUNT_64BIT |
+                        UCC_COLL_ARGS_FLAG_DISPLACEMENTS_64BIT;
+        fargs->src.info_v.buffer        = src;
+        fargs->src.info_v.counts        = (ucc_count_t *)counts;
+        fargs->src.info_v.displacements = (ucc_aint_t *)&counts[size];
+        fargs->src.info_v.datatype      = UCC_DT_UINT8;
+        fargs->src.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+        fargs->dst.info_v.buffer        = dst;
+        fargs->dst.info_v.counts        = (ucc_count_t *)&counts[2 * size];
+        fargs->dst.info_v.displacements = (ucc_aint_t *)&counts[3 * size];
+        fargs->dst.info_v.datatype      = UCC_DT_UINT8;
+        fargs->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+        break;
+    default:
+        break;
+    }
+
+    pack = ucc_tl_ucp_dt_generic_copy_init(coll_args, tl_team, dtg, src, 0);
+    UCC_CHECK_GOTO(ucc_schedule_add_task(&frag->super.super, pack), err,
+                   status);
+    UCC_CHECK_GOTO(ucc_task_subscribe_dep(&frag->super.super.super, pack,
+                                          UCC_EVENT_SCHEDULE_STARTED),
+                   err, status);
+    UCC_CHECK_GOTO(dtg->init(&bargs, team, &coll), err, status);
+    UCC_CHECK_GOTO(ucc_schedule_add_task(&frag->super.super, coll), err,
+                   status);
+    UCC_CHECK_GOTO(ucc_task_subscribe_dep(pack, coll, UCC_EVENT_COMPLETED),
+                   err, status);
+    unpack = ucc_tl_ucp_dt_generic_copy_init(coll_args, tl_team, dtg, dst, 1);
+    UCC_CHECK_GOTO(ucc_schedule_add_task(&frag->super.super, unpack), err,
+                   status);
+    UCC_CHECK_GOTO(ucc_task_subscribe_dep(coll, unpack, UCC_EVENT_COMPLETED),
+                   err, status);
+
+    frag->super.super.super.post     = ucc_tl_ucp_dt_generic_frag_start;
+    frag->super.super.super.finalize = ucc_tl_ucp_dt_generic_frag_finalize;
+    *frag_p                          = &frag->super.super;
+    return UCC_OK;
+err:
+    ucc_schedule_finalize(&frag->super.super.super);
+    ucc_mc_free(frag->scratch_mc_header);
+    ucc_tl_ucp_put_schedule(&frag->super.super);
+    return status;
+}
+
+static ucc_status_t ucc_tl_ucp_dt_generic_start(ucc_coll_task_t *task)
+{
+    ucc_tl_ucp_schedule_t   *schedule = ucc_derived_of(task,
+                                                       ucc_tl_ucp_schedule_t);
+    ucc_tl_ucp_dt_generic_t *dtg      = schedule->dt_generic;
+
+    /* states of the previous post of persistent collective */
+    ucc_tl_ucp_dt_side_finish(&dtg->src);
+    ucc_tl_ucp_dt_side_finish(&dtg->dst);
+    ucc_tl_ucp_dt_side_start(&dtg->src, 0);
+    ucc_tl_ucp_dt_side_start(&dtg->dst, 1);
+    return ucc_schedule_pipelined_post(task);
+}
+
+static ucc_status_t ucc_tl_ucp_dt_generic_finalize(ucc_coll_task_t *task)
+{
+    ucc_tl_ucp_schedule_t   *schedule = ucc_derived_of(task,
+                                                       ucc_tl_ucp_schedule_t);
+    ucc_tl_ucp_dt_generic_t *dtg      = schedule->dt_generic;
+    ucc_status_t             status;
+
+    ucc_tl_ucp_dt_side_finish(&dtg->src);
+    ucc_tl_ucp_dt_side_finish(&dtg->dst);
+    status = ucc_schedule_pipelined_finalize(task);
+    ucc_free(dtg);
+    ucc_tl_ucp_put_schedule(&schedule->super.super);
+    return status;
+}
+
+static ucc_status_t
+ucc_tl_ucp_dt_generic_sides_init(const ucc_coll_args_t   *args,
+                                 ucc_tl_ucp_dt_generic_t *dtg)
+{
+    int               inplace = UCC_IS_INPLACE(*args);
+    ucc_memory_type_t src_mt, dst_mt;
+
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BCAST:
+        dtg->src.dt     = args->src.info.datatype;
+        dtg->src.buffer = args->src.info.buffer;
+        src_mt          = args->src.info.mem_type;
+        dtg->dst        = dtg->src;
+        dst_mt          = src_mt;
+        break;
+    case UCC_COLL_TYPE_ALLGATHER:
+    case UCC_COLL_TYPE_ALLTOALL:
+        dtg->dst.dt     = args->dst.info.datatype;
+        dtg->dst.buffer = args->dst.info.buffer;
+        dst_mt          = args->dst.info.mem_type;
+        if (inplace) {
+            dtg->src = dtg->dst;
+            src_mt   = dst_mt;
+        } else {
+            dtg->src.dt     = args->src.info.datatype;
+            dtg->src.buffer = args->src.info.buffer;
+            src_mt          = args->src.info.mem_type;
+        }
+        break;
+    case UCC_COLL_TYPE_ALLGATHERV:
+        dtg->dst.dt     = args->dst.info_v.datatype;
+        dtg->dst.buffer = args->dst.info_v.buffer;
+        dst_mt          = args->dst.info_v.mem_type;
+        if (inplace) {
+            dtg->src = dtg->dst;
+            src_mt   = dst_mt;
+        } else {
+            dtg->src.dt     = args->src.info.datatype;
+            dtg->src.buffer = args->src.info.buffer;
+            src_mt          = args->src.info.mem_type;
+        }
+        break;
+    case UCC_COLL_TYPE_ALLTOALLV:
+        if (inplace) {
+            return UCC_ERR_NOT_SUPPORTED;
+        }
+        dtg->src.dt     = args->src.info_v.datatype;
+        dtg->src.buffer = args->src.info_v.buffer;
+        src_mt          = args->src.info_v.mem_type;
+        dtg->dst.dt     = args->dst.info_v.datatype;
+        dtg->dst.buffer = args->dst.info_v.buffer;
+        dst_mt          = args->dst.info_v.mem_type;
+        break;
+    default:
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    /* pack/unpack callbacks run on host */
+    if (src_mt != UCC_MEMORY_TYPE_HOST || dst_mt != UCC_MEMORY_TYPE_HOST) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    dtg->src.state = NULL;
+    dtg->dst.state = NULL;
+    return UCC_OK;
+}
+
+ucc_status_t ucc_tl_ucp_dt_generic_init(ucc_base_coll_args_t   *coll_args,
+                                        ucc_base_team_t        *team,
+                                        ucc_base_coll_init_fn_t init,
+                                        ucc_coll_task_t       **task_h)
+{
+    ucc_tl_ucp_team_t       *tl_team = ucc_derived_of(team, ucc_tl_ucp_team_t);
+    ucc_coll_args_t         *args    = &coll_args->args;
+    ucc_rank_t               rank    = UCC_TL_TEAM_RANK(tl_team);
+    ucc_rank_t               size    = UCC_TL_TEAM_SIZE(tl_team);
+    ucc_pipeline_params_t    pp      = tl_team->cfg.generic_dt_pipeline;
+    ucc_tl_ucp_dt_generic_t *dtg;
+    ucc_tl_ucp_schedule_t   *schedule;
+    size_t                   src_esize, dst_esize, max_bytes, count, displ;
+    ucc_rank_t               i, n_blocks;
+    int                      unpack, pdepth;
+    ucc_status_t             status;
+
+    if (UCC_COLL_ARGS_ACTIVE_SET(args)) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    dtg = ucc_malloc(sizeof(*dtg), "tl_ucp_dt_generic");
+    if (!dtg) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team),
+                 "failed to allocate %zd bytes for dt_generic", sizeof(*dtg));
+        return UCC_ERR_NO_MEMORY;
+    }
+    status = ucc_tl_ucp_dt_generic_sides_init(args, dtg);
+    if (UCC_OK != status) {
+        goto err;
+    }
+    /* the packed size of the buffer is assumed to be linear in count */
+    src_esize = ucc_dt_buffer_size(dtg->src.dt, dtg->src.buffer, 1);
+    dst_esize = ucc_dt_buffer_size(dtg->dst.dt, dtg->dst.buffer, 1);
+    if (src_esize != dst_esize || src_esize == 0) {
+        tl_debug(UCC_TL_TEAM_LIB(tl_team),
+                 "packed sizes of src and dst datatypes don't match");
+        status = UCC_ERR_NOT_SUPPORTED;
+        goto err;
+    }
+    dtg->init      = init;
+    dtg->elem_size = src_esize;
+
+    /* number of elements covered by pack and unpack states */
+    for (unpack = 0; unpack < 2; unpack++) {
+        ucc_tl_ucp_dt_side_t *side = unpack ? &dtg->dst : &dtg->src;
+
+        side->count = 0;
+        n_blocks    = ucc_tl_ucp_dt_generic_n_blocks(args, rank, size, unpack);
+        for (i = 0; i < n_blocks; i++) {
+            ucc_tl_ucp_dt_generic_block(args, rank, size, unpack, i, &count,
+                                        &displ);
+            if (count) {
+                side->count = ucc_max(side->count, displ + count);
+            }
+        }
+    }
+
+    /* number of fragments must be the same on all the ranks, so it is
+       computed from the values known to every rank */
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BCAST:
+        max_bytes = args->src.info.count * dtg->elem_size;
+        break;
+    case UCC_COLL_TYPE_ALLGATHERV:
+        max_bytes = ucc_coll_args_get_max_count(args, args->dst.info_v.counts,
+                                                size) * dtg->elem_size;
+        break;
+    case UCC_COLL_TYPE_ALLTOALLV:
+        max_bytes = 0;
+        break;
+    default:
+        max_bytes = args->dst.info.count / size * dtg->elem_size;
+        break;
+    }
+
+    if (args->coll_type == UCC_COLL_TYPE_ALLTOALLV) {
+        /* peers don't know the max block size of each other */
+        dtg->n_frags    = 1;
+        pdepth          = 1;
+        dtg->src_stride = ucc_coll_args_get_max_count(
+                              args, args->src.info_v.counts, size) *
+                          dtg->elem_size;
+        dtg->dst_stride = ucc_coll_args_get_max_count(
+                              args, args->dst.info_v.counts, size) *
+                          dtg->elem_size;
+    } else {
+        ucc_pipeline_nfrags_pdepth(&pp, max_bytes, &dtg->n_frags, &pdepth);
+        pdepth          = ucc_min(pdepth, UCC_SCHEDULE_PIPELINED_MAX_FRAGS);
+        dtg->src_stride = ucc_buffer_block_count(max_bytes, dtg->n_frags, 0);
+        dtg->dst_stride = dtg->src_stride;
+    }
+
+    status = ucc_tl_ucp_get_schedule(tl_team, coll_args, &schedule);
+    if (ucc_unlikely(UCC_OK != status)) {
+        goto err;
+    }
+    schedule->dt_generic = dtg;
+    status = ucc_schedule_pipelined_init(coll_args, team,
+                                         ucc_tl_ucp_dt_generic_frag_init,
+                                         ucc_tl_ucp_dt_generic_frag_setup,
+                                         pdepth, dtg->n_frags, pp.order,
+                                         &schedule->super);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(tl_team), "failed to init pipelined schedule");
+        ucc_tl_ucp_put_schedule(&schedule->super.super);
+        goto err;
+    }
+    tl_debug(UCC_TL_TEAM_LIB(tl_team),
+             "generic datatype %s: elem size %zd, n_frags %d, pdepth %d",
+             ucc_coll_type_str(args->coll_type), dtg->elem_size, dtg->n_frags,
+             pdepth);
+
+    schedule->super.super.super.post     = ucc_tl_ucp_dt_generic_start;
+    schedule->super.super.super.finalize = ucc_tl_ucp_dt_generic_finalize;
+    *task_h = &schedule->super.super.super;
+    return UCC_OK;
+err:
+    ucc_free(dtg);
+    return status;
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_TL_UCP_DT_GENERIC_H_
+#define UCC_TL_UCP_DT_GENERIC_H_
+
+#include "tl_ucp.h"
+#include "core/ucc_dt.h"
+
+/* Collectives over generic non-contiguous datatypes are executed as a
+   pipeline of fragments: pack of the fragment into contiguous scratch,
+   selected algorithm over bytes, unpack of the fragment. Pack of the next
+   fragment overlaps with the transfer of the previous one. */
+#define UCC_TL_UCP_DT_GENERIC_COLLS                                            \
+    (UCC_COLL_TYPE_BCAST | UCC_COLL_TYPE_ALLGATHER |                           \
+     UCC_COLL_TYPE_ALLGATHERV | UCC_COLL_TYPE_ALLTOALL |                       \
+     UCC_COLL_TYPE_ALLTOALLV)
+
+/* Side of the collective the user buffer is packed from or unpacked to */
+typedef struct ucc_tl_ucp_dt_side {
+    ucc_datatype_t dt;
+    void          *buffer;
+    size_t         count; /* elements covered by the pack/unpack state */
+    void          *state; /* NULL for predefined and contiguous datatypes */
+} ucc_tl_ucp_dt_side_t;
+
+typedef struct ucc_tl_ucp_dt_generic {
+    ucc_tl_ucp_dt_side_t    src;
+    ucc_tl_ucp_dt_side_t    dst;
+    ucc_base_coll_init_fn_t init;       /* algorithm of the fragments */
+    size_t                  elem_size;  /* size of packed element */
+    int                     n_frags;
+    size_t                  src_stride; /* max fragment size of src block */
+    size_t                  dst_stride; /* max fragment size of dst block */
+} ucc_tl_ucp_dt_generic_t;
+
+static inline int
+ucc_tl_ucp_coll_args_is_generic_dt(const ucc_coll_args_t *args)
+{
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_BCAST:
+        return UCC_DT_IS_NONCONTIG(args->src.info.datatype);
+    case UCC_COLL_TYPE_ALLGATHER:
+    case UCC_COLL_TYPE_ALLTOALL:
+        return UCC_DT_IS_NONCONTIG(args->dst.info.datatype) ||
+               (!UCC_IS_INPLACE(*args) &&
+                UCC_DT_IS_NONCONTIG(args->src.info.datatype));
+    case UCC_COLL_TYPE_ALLGATHERV:
+        return UCC_DT_IS_NONCONTIG(args->dst.info_v.datatype) ||
+               (!UCC_IS_INPLACE(*args) &&
+                UCC_DT_IS_NONCONTIG(args->src.info.datatype));
+    case UCC_COLL_TYPE_ALLTOALLV:
+        return UCC_DT_IS_NONCONTIG(args->dst.info_v.datatype) ||
+               (!UCC_IS_INPLACE(*args) &&
+                UCC_DT_IS_NONCONTIG(args->src.info_v.datatype));
+    default:
+        return 0;
+    }
+}
+
+/* Builds the pipelined schedule; "init" is the algorithm used for the
+   fragments, it is called with UCC_DT_UINT8 args on host scratch */
+ucc_status_t ucc_tl_ucp_dt_generic_init(ucc_base_coll_args_t   *coll_args,
+                                        ucc_base_team_t        *team,
+                                        ucc_base_coll_init_fn_t init,
+                                        ucc_coll_task_t       **task_h);
+
+/* Used at the beginning of algorithm init functions of the collectives from
+   UCC_TL_UCP_DT_GENERIC_COLLS */
+#define UCC_TL_UCP_DT_GENERIC_CHECK(_coll_args, _team, _init, _task_h)         \
+    do {                                                                       \
+        if (ucc_unlikely(                                                      \
+                ucc_tl_ucp_coll_args_is_generic_dt(&(_coll_args)->args))) {    \
+            return ucc_tl_ucp_dt_generic_init(_coll_args, _team, _init,        \
+                                              _task_h);                        \
+        }                                                                      \
+    } while (0)
+
+#endif
@@ -6,21 +6,41 @@
 
 #include "tl_ucp.h"
 #include "tl_ucp_ep.h"
+#include "tl_ucp_coll.h"
+#include "utils/ucc_malloc.h"
+
+static void ep_lru_evict_entry(ucc_tl_ucp_worker_t *      worker,
+                               ucc_tl_ucp_ep_lru_entry_t *entry,
+                               uint32_t                   close_flags);
 
 //NOLINTNEXTLINE
 static void ucc_tl_ucp_err_handler(void *arg, ucp_ep_h ep, ucs_status_t status)
 {
+    ucc_tl_ucp_worker_t       *worker = (ucc_tl_ucp_worker_t *)arg;
+    ucc_tl_ucp_ep_lru_entry_t *entry;
+
     /* In case we don't have OOB barrier, errors are expected.
      * This cb will suppress UCX from raising errors*/
-    ;
+    if (!worker->ep_lru_hash) {
+        return;
+    }
+    /* With bounded ep cache the peer may have evicted and closed its ep to
+       us. Mark the failed ep evicted, so the next get_ep reconnects. Evicted
+       eps are not in the lru hash anymore, they are already closing */
+    entry = tl_ucp_ep_lru_hash_get(worker->ep_lru_hash, ep);
+    if (!entry) {
+        return;
+    }
+    ucc_list_del(&entry->list_elem);
+    ep_lru_evict_entry(worker, entry, UCP_EP_CLOSE_FLAG_FORCE);
 }
 
 static inline ucc_status_t ucc_tl_ucp_connect_ep(ucc_tl_ucp_context_t *ctx,
                                                  int is_service, ucp_ep_h *ep,
                                                  void *ucp_address)
 {
-    ucp_worker_h worker =
-        (is_service) ? ctx->service_worker.ucp_worker : ctx->worker.ucp_worker;
+    ucc_tl_ucp_worker_t *worker =
+        (is_service) ? &ctx->service_worker : &ctx->worker;
     ucp_ep_params_t ep_params;
     ucs_status_t    status;
     if (*ep) {
@@ -30,14 +50,15 @@ static inline ucc_status_t ucc_tl_ucp_connect_ep(ucc_tl_ucp_context_t *ctx,
     ep_params.field_mask = UCP_EP_PARAM_FIELD_REMOTE_ADDRESS;
     ep_params.address    = (ucp_address_t *)ucp_address;
 
-    if (!UCC_TL_CTX_HAS_OOB(ctx)) {
+    /* evicted eps are closed while the peer may still use its ep to us */
+    if (!UCC_TL_CTX_HAS_OOB(ctx) || worker->ep_lru_max) {
         ep_params.err_mode        = UCP_ERR_HANDLING_MODE_PEER;
         ep_params.err_handler.cb  = ucc_tl_ucp_err_handler;
-        ep_params.err_handler.arg = NULL;
+        ep_params.err_handler.arg = worker;
         ep_params.field_mask     |= UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE |
                                     UCP_EP_PARAM_FIELD_ERR_HANDLER;
     }
-    status = ucp_ep_create(worker, &ep_params, ep);
+    status = ucp_ep_create(worker->ucp_worker, &ep_params, ep);
 
     if (ucc_unlikely(UCS_OK != status)) {
         tl_error(ctx->super.super.lib, "ucp returned connect error: %s",
@@ -62,7 +83,267 @@ ucc_status_t ucc_tl_ucp_connect_team_ep(ucc_tl_ucp_team_t *team,
     return ucc_tl_ucp_connect_ep(ctx, use_service_worker, ep, addr);
 }
 
-/* Finds next non-NULL ep in the storage and returns that handle
+/* Bounded ep cache. Evicted ep is closed in flush mode without waiting, so
+   operations in flight on it complete. Its storage slot is marked with
+   UCC_TL_UCP_EP_EVICTED. A reconnect to the same peer is done only after the
+   close completes, this keeps messages to the peer ordered. Until then sends
+   to the peer are queued on the worker and retried from task progress. */
+ucc_status_t ucc_tl_ucp_ep_lru_init(ucc_tl_ucp_worker_t * worker,
+                                    ucc_tl_ucp_context_t *ctx)
+{
+    worker->ep_lru_max      = ctx->cfg.max_eps;
+    worker->ep_lru_n        = 0;
+    worker->ep_lru_hash     = NULL;
+    worker->n_ep_evictions  = 0;
+    worker->n_ep_reconnects = 0;
+    ucc_list_head_init(&worker->ep_lru);
+    ucc_list_head_init(&worker->ep_closing);
+    ucc_list_head_init(&worker->ep_pending);
+    worker->ep_pending_retry = 0;
+    if (!worker->ep_lru_max) {
+        return UCC_OK;
+    }
+    if (ctx->n_rinfo_segs > 0) {
+        /* remote keys of mapped memory are bound to eps */
+        tl_debug(ctx->super.super.lib,
+                 "ep cache limit is ignored with mapped memory");
+        worker->ep_lru_max = 0;
+        return UCC_OK;
+    }
+    worker->ep_lru_hash = kh_init(tl_ucp_ep_lru_hash);
+    if (!worker->ep_lru_hash) {
+        tl_error(ctx->super.super.lib, "failed to allocate ep lru hash");
+        return UCC_ERR_NO_MEMORY;
+    }
+    return UCC_OK;
+}
+
+static inline int ep_lru_entry_match(ucc_tl_ucp_worker_t *      worker,
+                                     ucc_tl_ucp_ep_lru_entry_t *entry,
+                                     ucc_rank_t                 ctx_rank,
+                                     ucc_context_addr_header_t *h)
+{
+    return worker->eps ? (entry->ctx_rank == ctx_rank)
+                       : tl_ucp_ctx_id_equal_fn(entry->ctx_id, h->ctx_id);
+}
+
+static inline ucs_status_t ep_lru_close_status(void *close_req)
+{
+    return UCS_PTR_IS_PTR(close_req) ? ucp_request_check_status(close_req)
+                                     : UCS_PTR_STATUS(close_req);
+}
+
+static void ep_lru_close_complete(ucc_tl_ucp_context_t *     ctx,
+                                  ucc_tl_ucp_ep_lru_entry_t *entry,
+                                  ucs_status_t               status)
+{
+    if (status != UCS_OK) {
+        tl_error(ctx->super.super.lib,
+                 "error during ucp ep close, ep %p, status %s",
+                 entry->ep, ucs_status_string(status));
+    }
+    if (UCS_PTR_IS_PTR(entry->close_req)) {
+        ucp_request_free(entry->close_req);
+    }
+    ucc_free(entry);
+}
+
+/* Releases evicted eps whose close has completed */
+static void ep_lru_reap_closed(ucc_tl_ucp_worker_t * worker,
+                               ucc_tl_ucp_context_t *ctx)
+{
+    ucc_tl_ucp_ep_lru_entry_t *entry, *tmp;
+    ucs_status_t               status;
+
+    ucc_list_for_each_safe(entry, tmp, &worker->ep_closing, list_elem) {
+        status = ep_lru_close_status(entry->close_req);
+        if (status != UCS_INPROGRESS) {
+            ucc_list_del(&entry->list_elem);
+            ep_lru_close_complete(ctx, entry, status);
+        }
+    }
+}
+
+/* Entry is already removed from the lru list */
+static void ep_lru_evict_entry(ucc_tl_ucp_worker_t *      worker,
+                               ucc_tl_ucp_ep_lru_entry_t *entry,
+                               uint32_t                   close_flags)
+{
+    ucp_request_param_t param;
+
+    tl_ucp_ep_lru_hash_del(worker->ep_lru_hash, entry->ep);
+    if (worker->eps) {
+        worker->eps[entry->ctx_rank] = UCC_TL_UCP_EP_EVICTED;
+    } else {
+        tl_ucp_hash_put(worker->ep_hash, entry->ctx_id, UCC_TL_UCP_EP_EVICTED);
+    }
+    param.op_attr_mask = UCP_OP_ATTR_FIELD_FLAGS;
+    param.flags        = close_flags;
+    entry->close_req   = ucp_ep_close_nbx(entry->ep, &param);
+    ucc_list_add_tail(&worker->ep_closing, &entry->list_elem);
+    worker->ep_lru_n--;
+    worker->n_ep_evictions++;
+}
+
+static void ep_lru_evict(ucc_tl_ucp_worker_t *worker)
+{
+    ucc_tl_ucp_ep_lru_entry_t *entry;
+
+    entry = ucc_list_extract_head(&worker->ep_lru, ucc_tl_ucp_ep_lru_entry_t,
+                                  list_elem);
+    ep_lru_evict_entry(worker, entry, 0); // 0 means FLUSH
+}
+
+void ucc_tl_ucp_ep_lru_add(ucc_tl_ucp_worker_t * worker,
+                           ucc_tl_ucp_context_t *ctx, ucp_ep_h ep,
+                           ucc_rank_t ctx_rank, ucc_context_addr_header_t *h)
+{
+    ucc_tl_ucp_ep_lru_entry_t *entry;
+
+    entry = ucc_malloc(sizeof(*entry), "ep_lru_entry");
+    if (ucc_unlikely(!entry)) {
+        /* ep stays connected, it is just never evicted */
+        tl_debug(ctx->super.super.lib,
+                 "failed to allocate %zd bytes, ep %p is not cached",
+                 sizeof(*entry), ep);
+        return;
+    }
+    entry->ep        = ep;
+    entry->ctx_rank  = ctx_rank;
+    entry->close_req = NULL;
+    if (h) {
+        entry->ctx_id = h->ctx_id;
+    }
+    ep_lru_reap_closed(worker, ctx);
+    while (worker->ep_lru_n >= worker->ep_lru_max) {
+        ep_lru_evict(worker);
+    }
+    tl_ucp_ep_lru_hash_put(worker->ep_lru_hash, ep, entry);
+    ucc_list_add_tail(&worker->ep_lru, &entry->list_elem);
+    worker->ep_lru_n++;
+}
+
+ucc_status_t ucc_tl_ucp_ep_lru_reconnect(ucc_tl_ucp_worker_t * worker,
+                                         ucc_tl_ucp_context_t *ctx,
+                                         ucc_rank_t                 ctx_rank,
+                                         ucc_context_addr_header_t *h)
+{
+    ucc_tl_ucp_ep_lru_entry_t *entry, *tmp;
+    ucs_status_t               status;
+
+    if (!worker->ep_pending_retry && !ucc_list_is_empty(&worker->ep_pending)) {
+        /* earlier sends are still queued, don't overtake them */
+        return UCC_INPROGRESS;
+    }
+    ucc_list_for_each_safe(entry, tmp, &worker->ep_closing, list_elem) {
+        if (!ep_lru_entry_match(worker, entry, ctx_rank, h)) {
+            continue;
+        }
+        status = ep_lru_close_status(entry->close_req);
+        if (status == UCS_INPROGRESS) {
+            return UCC_INPROGRESS;
+        }
+        ucc_list_del(&entry->list_elem);
+        ep_lru_close_complete(ctx, entry, status);
+    }
+    worker->n_ep_reconnects++;
+    return UCC_OK;
+}
+
+ucs_status_ptr_t ucc_tl_ucp_ep_pending_add(ucc_tl_ucp_team_t *team,
+                                           ucc_tl_ucp_task_t *task,
+                                           ucc_rank_t dest, void *buffer,
+                                           ucp_tag_t            tag,
+                                           ucp_request_param_t *param)
+{
+    ucc_tl_ucp_ep_pending_t *p;
+
+    p = ucc_malloc(sizeof(*p), "ep_pending");
+    if (ucc_unlikely(!p)) {
+        tl_error(UCC_TL_TEAM_LIB(team), "failed to allocate %zd bytes",
+                 sizeof(*p));
+        return UCS_STATUS_PTR(UCS_ERR_NO_MEMORY);
+    }
+    p->team   = team;
+    p->task   = task;
+    p->dest   = dest;
+    p->buffer = buffer;
+    p->tag    = tag;
+    p->param  = *param;
+    /* completion is always reported through the callback */
+    p->param.op_attr_mask |= UCP_OP_ATTR_FLAG_NO_IMM_CMPL;
+    ucc_list_add_tail(&team->worker->ep_pending, &p->list_elem);
+    return UCS_STATUS_PTR(UCS_INPROGRESS);
+}
+
+/* Posts queued sends in order, stops at the first one whose peer ep is
+   still closing */
+void ucc_tl_ucp_ep_pending_progress(ucc_tl_ucp_worker_t *worker)
+{
+    ucc_tl_ucp_ep_pending_t *p, *tmp;
+    ucs_status_ptr_t         req;
+    ucc_status_t             status;
+    ucp_ep_h                 ep;
+
+    worker->ep_pending_retry = 1;
+    ucc_list_for_each_safe(p, tmp, &worker->ep_pending, list_elem) {
+        status = ucc_tl_ucp_get_ep(p->team, p->dest, &ep);
+        if (status == UCC_INPROGRESS) {
+            break;
+        }
+        ucc_list_del(&p->list_elem);
+        if (ucc_likely(UCC_OK == status)) {
+            req = ucp_tag_send_nbx(ep, p->buffer, 1, p->tag, &p->param);
+            status = UCS_PTR_IS_ERR(req)
+                         ? ucs_status_to_ucc_status(UCS_PTR_STATUS(req))
+                         : UCC_OK;
+        }
+        if (ucc_unlikely(UCC_OK != status)) {
+            tl_error(UCC_TL_TEAM_LIB(p->team),
+                     "failed to send to %d after reconnect, %s", p->dest,
+                     ucc_status_string(status));
+            p->task->super.status = status;
+            ucc_atomic_add32(&p->task->tagged.send_completed, 1);
+        }
+        ucc_free(p);
+    }
+    worker->ep_pending_retry = 0;
+}
+
+static void ep_lru_cleanup(ucc_tl_ucp_worker_t * worker,
+                           ucc_tl_ucp_context_t *ctx)
+{
+    ucc_tl_ucp_ep_lru_entry_t *entry, *tmp;
+    ucs_status_t               status;
+
+    if (!worker->ep_lru_hash) {
+        return;
+    }
+    tl_debug(ctx->super.super.lib,
+             "ep cache: %" PRIu64 " evictions, %" PRIu64 " reconnects",
+             worker->n_ep_evictions, worker->n_ep_reconnects);
+    /* tasks that queued these sends are already destroyed */
+    ucc_list_destruct(&worker->ep_pending, ucc_tl_ucp_ep_pending_t, ucc_free,
+                      list_elem);
+    ucc_list_for_each_safe(entry, tmp, &worker->ep_closing, list_elem) {
+        while (UCS_INPROGRESS ==
+               (status = ep_lru_close_status(entry->close_req))) {
+            ucp_worker_progress(worker->ucp_worker);
+        }
+        ucc_list_del(&entry->list_elem);
+        ep_lru_close_complete(ctx, entry, status);
+    }
+    /* connected eps are closed by ucc_tl_ucp_close_eps through ep storage */
+    ucc_list_for_each_safe(entry, tmp, &worker->ep_lru, list_elem) {
+        ucc_list_del(&entry->list_elem);
+        ucc_free(entry);
+    }
+    kh_destroy(tl_ucp_ep_lru_hash, worker->ep_lru_hash);
+    worker->ep_lru_hash = NULL;
+    worker->ep_lru_n    = 0;
+}
+
+/* Finds next connected ep in the storage and returns that handle
    for closure. In case of "hash" storage it pops the item,
    in case of "array" sets it to NULL */
 static inline ucp_ep_h get_next_ep_to_close(ucc_tl_ucp_worker_t * worker,
@@ -73,13 +354,18 @@ static inline ucp_ep_h get_next_ep_to_close(ucc_tl_ucp_worker_t * worker,
 
     if (worker->eps) {
         size = (ucc_rank_t)ctx->super.super.ucc_context->params.oob.n_oob_eps;
-        while (NULL == ep && (*i) < size) {
+        while (!UCC_TL_UCP_EP_IS_CONNECTED(ep) && (*i) < size) {
             ep              = worker->eps[*i];
             worker->eps[*i] = NULL;
             (*i)++;
         }
+        if (!UCC_TL_UCP_EP_IS_CONNECTED(ep)) {
+            ep = NULL;
+        }
     } else {
-        ep = tl_ucp_hash_pop(worker->ep_hash);
+        do {
+            ep = tl_ucp_hash_pop(worker->ep_hash);
+        } while (UCC_TL_UCP_EP_EVICTED == ep);
     }
     return ep;
 }
@@ -93,6 +379,7 @@ void ucc_tl_ucp_close_eps(ucc_tl_ucp_worker_t * worker,
      ucs_status_ptr_t             close_req;
      ucp_request_param_t          param;
 
+     ep_lru_cleanup(worker, ctx);
      param.op_attr_mask = UCP_OP_ATTR_FIELD_FLAGS;
      param.flags        = 0; // 0 means FLUSH
      ep                 = get_next_ep_to_close(worker, ctx, &i);
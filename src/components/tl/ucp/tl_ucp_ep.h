@@ -35,15 +35,67 @@
         ? TL_UCP_EP_OFFSET_WORKER_INFO(TL_UCP_EP_OFFSET_WORKER_INFO(_addr))    \
         : TL_UCP_EP_OFFSET_WORKER_INFO(_addr)
 
+/* Value kept in ep storage for peers whose ep was evicted from the bounded
+   ep cache, distinguishes reconnect from the first connect */
+#define UCC_TL_UCP_EP_EVICTED ((ucp_ep_h)0x1)
+#define UCC_TL_UCP_EP_IS_CONNECTED(_ep)                                        \
+    ((uintptr_t)(_ep) > (uintptr_t)UCC_TL_UCP_EP_EVICTED)
+
 typedef struct ucc_tl_ucp_context ucc_tl_ucp_context_t;
 typedef struct ucc_tl_ucp_team    ucc_tl_ucp_team_t;
 
+/* Send deferred until the evicted ep to the peer is closed and reconnected */
+typedef struct ucc_tl_ucp_ep_pending {
+    ucc_list_link_t     list_elem;
+    ucc_tl_ucp_team_t  *team;
+    ucc_tl_ucp_task_t  *task;
+    ucc_rank_t          dest;
+    void               *buffer;
+    ucp_tag_t           tag;
+    ucp_request_param_t param;
+} ucc_tl_ucp_ep_pending_t;
+
 ucc_status_t ucc_tl_ucp_connect_team_ep(ucc_tl_ucp_team_t *team,
                                         ucc_rank_t team_rank, ucp_ep_h *ep);
 
 void ucc_tl_ucp_close_eps(ucc_tl_ucp_worker_t * worker,
                           ucc_tl_ucp_context_t *ctx);
 
+ucc_status_t ucc_tl_ucp_ep_lru_init(ucc_tl_ucp_worker_t * worker,
+                                    ucc_tl_ucp_context_t *ctx);
+
+void ucc_tl_ucp_ep_lru_add(ucc_tl_ucp_worker_t * worker,
+                           ucc_tl_ucp_context_t *ctx, ucp_ep_h ep,
+                           ucc_rank_t ctx_rank, ucc_context_addr_header_t *h);
+
+ucc_status_t ucc_tl_ucp_ep_lru_reconnect(ucc_tl_ucp_worker_t * worker,
+                                         ucc_tl_ucp_context_t *ctx,
+                                         ucc_rank_t                 ctx_rank,
+                                         ucc_context_addr_header_t *h);
+
+ucs_status_ptr_t ucc_tl_ucp_ep_pending_add(ucc_tl_ucp_team_t *team,
+                                           ucc_tl_ucp_task_t *task,
+                                           ucc_rank_t dest, void *buffer,
+                                           ucp_tag_t            tag,
+                                           ucp_request_param_t *param);
+
+void ucc_tl_ucp_ep_pending_progress(ucc_tl_ucp_worker_t *worker);
+
+/* Marks ep as most recently used */
+static inline void ucc_tl_ucp_ep_lru_touch(ucc_tl_ucp_worker_t *worker,
+                                           ucp_ep_h             ep)
+{
+    ucc_tl_ucp_ep_lru_entry_t *entry;
+
+    entry = tl_ucp_ep_lru_hash_get(worker->ep_lru_hash, ep);
+    if (ucc_unlikely(!entry)) {
+        /* lru entry allocation failed on connect */
+        return;
+    }
+    ucc_list_del(&entry->list_elem);
+    ucc_list_add_tail(&worker->ep_lru, &entry->list_elem);
+}
+
 static inline ucc_context_addr_header_t *
 ucc_tl_ucp_get_team_ep_header(ucc_tl_ucp_team_t *team, ucc_rank_t core_rank)
 
@@ -72,19 +124,36 @@ static inline ucc_status_t ucc_tl_ucp_get_ep(ucc_tl_ucp_team_t *team,
         h   = ucc_tl_ucp_get_team_ep_header(team, core_rank);
         *ep = tl_ucp_hash_get(team->worker->ep_hash, h->ctx_id);
     }
-    if (NULL == (*ep)) {
-        /* Not connected yet */
-        status = ucc_tl_ucp_connect_team_ep(team, core_rank, ep);
-        if (ucc_unlikely(UCC_OK != status)) {
-            tl_error(UCC_TL_TEAM_LIB(team), "failed to connect team ep");
-            *ep = NULL;
-            return status;
+    if (ucc_likely(UCC_TL_UCP_EP_IS_CONNECTED(*ep))) {
+        if (team->worker->ep_lru_max) {
+            ucc_tl_ucp_ep_lru_touch(team->worker, *ep);
         }
-        if (!h) {
-            team->worker->eps[ctx_rank] = *ep;
-        } else {
-            tl_ucp_hash_put(team->worker->ep_hash, h->ctx_id, *ep);
+        return UCC_OK;
+    }
+    if (UCC_TL_UCP_EP_EVICTED == (*ep)) {
+        /* UCC_INPROGRESS until the close of the evicted ep completes */
+        status = ucc_tl_ucp_ep_lru_reconnect(
+            team->worker, UCC_TL_UCP_TEAM_CTX(team), ctx_rank, h);
+        if (UCC_OK != status) {
+            return status;
         }
+        *ep = NULL;
+    }
+    /* Not connected yet */
+    status = ucc_tl_ucp_connect_team_ep(team, core_rank, ep);
+    if (ucc_unlikely(UCC_OK != status)) {
+        tl_error(UCC_TL_TEAM_LIB(team), "failed to connect team ep");
+        *ep = NULL;
+        return status;
+    }
+    if (!h) {
+        team->worker->eps[ctx_rank] = *ep;
+    } else {
+        tl_ucp_hash_put(team->worker->ep_hash, h->ctx_id, *ep);
+    }
+    if (team->worker->ep_lru_max) {
+        ucc_tl_ucp_ep_lru_add(team->worker, UCC_TL_UCP_TEAM_CTX(team), *ep,
+                              ctx_rank, h);
     }
     return UCC_OK;
 }
@@ -9,6 +9,7 @@
 #include "config.h"
 #include "core/ucc_context.h"
 #include "utils/khash.h"
+#include "utils/ucc_list.h"
 #include <stdint.h>
 
 static inline uint32_t tl_ucp_ctx_id_hash_fn_impl(uint32_t h, uint32_t k)
@@ -80,4 +81,50 @@ static inline void* tl_ucp_hash_pop(tl_ucp_ep_hash_t *h)
     }
     return ep;
 }
+
+/* Bounded ep cache: maps connected ep to its lru entry */
+KHASH_MAP_INIT_INT64(tl_ucp_ep_lru_hash, void*);
+
+#define tl_ucp_ep_lru_hash_t khash_t(tl_ucp_ep_lru_hash)
+
+typedef struct ucc_tl_ucp_ep_lru_entry {
+    ucc_list_link_t  list_elem;
+    void            *ep;
+    /* ep storage key: ctx rank for eps array, ctx id for ep hash */
+    ucc_rank_t       ctx_rank;
+    ucc_context_id_t ctx_id;
+    void            *close_req;
+} ucc_tl_ucp_ep_lru_entry_t;
+
+static inline ucc_tl_ucp_ep_lru_entry_t *
+tl_ucp_ep_lru_hash_get(tl_ucp_ep_lru_hash_t *h, void *ep)
+{
+    khiter_t k;
+
+    k = kh_get(tl_ucp_ep_lru_hash, h, (uint64_t)(uintptr_t)ep);
+    if (k == kh_end(h)) {
+        return NULL;
+    }
+    return kh_value(h, k);
+}
+
+static inline void tl_ucp_ep_lru_hash_put(tl_ucp_ep_lru_hash_t *h, void *ep,
+                                          ucc_tl_ucp_ep_lru_entry_t *entry)
+{
+    int      ret;
+    khiter_t k;
+
+    k = kh_put(tl_ucp_ep_lru_hash, h, (uint64_t)(uintptr_t)ep, &ret);
+    kh_value(h, k) = entry;
+}
+
+static inline void tl_ucp_ep_lru_hash_del(tl_ucp_ep_lru_hash_t *h, void *ep)
+{
+    khiter_t k;
+
+    k = kh_get(tl_ucp_ep_lru_hash, h, (uint64_t)(uintptr_t)ep);
+    if (k != kh_end(h)) {
+        kh_del(tl_ucp_ep_lru_hash, h, k);
+    }
+}
 #endif
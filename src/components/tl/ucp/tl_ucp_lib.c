@@ -35,6 +35,8 @@ UCC_CLASS_INIT_FUNC(ucc_tl_ucp_lib_t, const ucc_base_lib_params_t *params,
         self->cfg.reduce_kn_radix         = tl_ucp_config->kn_radix;
         self->cfg.scatter_kn_radix        = tl_ucp_config->kn_radix;
         self->cfg.gather_kn_radix         = tl_ucp_config->kn_radix;
+        self->cfg.scan_kn_radix           = tl_ucp_config->kn_radix;
+        self->cfg.allreduce_sparse_kn_radix = tl_ucp_config->kn_radix;
     }
     self->cfg.alltoallv_hybrid_radix = 2;
     self->tlcp_configs = NULL;
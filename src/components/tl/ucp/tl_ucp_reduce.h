@@ -8,5 +8,59 @@
 #define UCC_TL_UCP_REDUCE_H_
 #include "tl_ucp_coll.h"
 #include "utils/ucc_dt_reduce.h"
+#include "utils/ucc_math.h"
+
+/* Datatype used on the wire by reduction algorithms: 16 bit float if user
+   allowed reduced precision for float32 host data, original dt otherwise */
+static inline ucc_datatype_t
+ucc_tl_ucp_reduce_wire_dt(ucc_tl_ucp_team_t *team, ucc_coll_args_t *args,
+                          ucc_datatype_t dt, ucc_memory_type_t mem_type)
+{
+    if (!(args->mask & UCC_COLL_ARGS_FIELD_FLAGS) ||
+        !(args->flags & UCC_COLL_ARGS_FLAG_REDUCED_PRECISION) ||
+        dt != UCC_DT_FLOAT32 || mem_type != UCC_MEMORY_TYPE_HOST) {
+        return dt;
+    }
+    return (UCC_TL_UCP_TEAM_LIB(team)->cfg.reduce_wire_dt ==
+            UCC_TL_UCP_WIRE_DT_FP16) ? UCC_DT_FLOAT16 : UCC_DT_BFLOAT16;
+}
+
+/* float32 -> wire dt, dst may alias src */
+static inline void ucc_tl_ucp_wire_pack(void *dst, const void *src,
+                                        size_t count, ucc_datatype_t wire_dt)
+{
+    const float *s = (const float *)src;
+    uint16_t    *d = (uint16_t *)dst;
+    size_t       i;
+
+    if (wire_dt == UCC_DT_FLOAT16) {
+        for (i = 0; i < count; i++) {
+            float32tofloat16(s[i], &d[i]);
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            float32tobfloat16(s[i], &d[i]);
+        }
+    }
+}
+
+/* wire dt -> float32, dst may alias src */
+static inline void ucc_tl_ucp_wire_unpack(void *dst, const void *src,
+                                          size_t count, ucc_datatype_t wire_dt)
+{
+    const uint16_t *s = (const uint16_t *)src;
+    float          *d = (float *)dst;
+    size_t          i;
+
+    if (wire_dt == UCC_DT_FLOAT16) {
+        for (i = count; i > 0; i--) {
+            d[i - 1] = float16tofloat32(&s[i - 1]);
+        }
+    } else {
+        for (i = count; i > 0; i--) {
+            d[i - 1] = bfloat16tofloat32(&s[i - 1]);
+        }
+    }
+}
 
 #endif
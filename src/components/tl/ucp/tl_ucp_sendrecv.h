@@ -70,17 +70,12 @@ ucc_tl_ucp_send_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
                        ucc_rank_t dest_group_rank, ucc_tl_ucp_team_t *team,
                        ucc_tl_ucp_task_t *task, ucp_send_nbx_callback_t cb, void *user_data)
 {
-    ucc_coll_args_t    *args = &TASK_ARGS(task);
     ucp_request_param_t req_param;
     ucc_status_t        status;
     ucp_ep_h            ep;
     ucp_tag_t           ucp_tag;
 
-    status = ucc_tl_ucp_get_ep(team, dest_group_rank, &ep);
-    if (ucc_unlikely(UCC_OK != status)) {
-        return UCS_STATUS_PTR(UCS_ERR_NO_MESSAGE);
-    }
-    ucp_tag = UCC_TL_UCP_MAKE_SEND_TAG((args->mask & UCC_COLL_ARGS_FIELD_TAG),
+    ucp_tag = UCC_TL_UCP_MAKE_SEND_TAG(TASK_USER_TAG(task),
         task->tagged.tag, UCC_TL_TEAM_RANK(team), team->super.super.params.id,
         team->super.super.params.scope_id, team->super.super.params.scope);
     req_param.op_attr_mask =
@@ -90,6 +85,16 @@ ucc_tl_ucp_send_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
     req_param.cb.send     = cb;
     req_param.memory_type = ucc_memtype_to_ucs[mtype];
     req_param.user_data   = user_data;
+    status = ucc_tl_ucp_get_ep(team, dest_group_rank, &ep);
+    if (ucc_unlikely(UCC_OK != status)) {
+        if (UCC_INPROGRESS == status) {
+            /* evicted ep is still closing, send is posted from progress */
+            task->tagged.send_posted++;
+            return ucc_tl_ucp_ep_pending_add(team, task, dest_group_rank,
+                                             buffer, ucp_tag, &req_param);
+        }
+        return UCS_STATUS_PTR(UCS_ERR_NO_MESSAGE);
+    }
     task->tagged.send_posted++;
     return ucp_tag_send_nbx(ep, buffer, 1, ucp_tag, &req_param);
 }
@@ -134,13 +139,12 @@ ucc_tl_ucp_recv_common(void *buffer, size_t msglen, ucc_memory_type_t mtype,
                        ucc_rank_t dest_group_rank, ucc_tl_ucp_team_t *team,
                        ucc_tl_ucp_task_t *task, ucp_tag_recv_nbx_callback_t cb, void *user_data)
 {
-    ucc_coll_args_t    *args = &TASK_ARGS(task);
     ucp_request_param_t req_param;
     ucp_tag_t           ucp_tag, ucp_tag_mask;
 
     // coverity[result_independent_of_operands:FALSE]
     UCC_TL_UCP_MAKE_RECV_TAG(ucp_tag, ucp_tag_mask,
-                             (args->mask & UCC_COLL_ARGS_FIELD_TAG),
+                             TASK_USER_TAG(task),
                              task->tagged.tag, dest_group_rank,
                              team->super.super.params.id,
                              team->super.super.params.scope_id,
@@ -225,6 +225,7 @@ ucc_status_t ucc_tl_ucp_service_bcast(ucc_base_team_t *team, void *buf,
     task->super.progress = ucc_tl_ucp_bcast_knomial_progress;
     task->super.finalize = ucc_tl_ucp_coll_finalize;
     task->bcast_kn.radix = 2;
+    task->bcast_kn.root  = root;
     status = ucc_tl_ucp_bcast_knomial_start(&task->super);
     if (status != UCC_OK) {
         goto finalize_coll;
@@ -428,11 +428,9 @@ typedef struct proc_info_id {
     ucc_rank_t      id;
 } proc_info_id_t;
 
-static int ucc_compare_proc_info_id(const void *a, const void *b)
+static int ucc_compare_proc_info(const ucc_proc_info_t *d1,
+                                 const ucc_proc_info_t *d2)
 {
-    const ucc_proc_info_t *d1 = &((const proc_info_id_t *)a)->info;
-    const ucc_proc_info_t *d2 = &((const proc_info_id_t *)b)->info;
-
     if (d1->host_hash != d2->host_hash) {
         return d1->host_hash > d2->host_hash ? 1 : -1;
     } else if (d1->socket_id != d2->socket_id) {
@@ -444,10 +442,27 @@ static int ucc_compare_proc_info_id(const void *a, const void *b)
     }
 }
 
+/* Orders ranks by host, socket and numa. Ranks within the same numa keep
+ * their original order, so that the result does not depend on qsort
+ * implementation and is identical on all the ranks of the team. */
+static int ucc_compare_proc_info_id(const void *a, const void *b)
+{
+    const proc_info_id_t *d1 = (const proc_info_id_t *)a;
+    const proc_info_id_t *d2 = (const proc_info_id_t *)b;
+    int                   d;
+
+    d = ucc_compare_proc_info(&d1->info, &d2->info);
+    if (d != 0) {
+        return d;
+    }
+    return (d1->id > d2->id) - (d1->id < d2->id);
+}
+
 static ucc_status_t sbgp_create_full_ordered(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
 {
     ucc_rank_t       gsize = ucc_subset_size(&topo->set);
     ucc_proc_info_t *pinfo = topo->topo->procs;
+    ucc_proc_info_t *prev, *cur;
     ucc_host_id_t   *visited;
     proc_info_id_t  *sorted;
     ucc_rank_t       i, j, num_visited;
@@ -475,12 +490,14 @@ static ucc_status_t sbgp_create_full_ordered(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
 
     is_sorted   = 1;
     num_visited = 1;
-    visited[0] = pinfo[0].host_hash;
+    prev        = &pinfo[ucc_ep_map_eval(topo->set.map, 0)];
+    visited[0]  = prev->host_hash;
     for (i = 1; i < gsize; i++) {
-        if (pinfo[i].host_hash != pinfo[i-1].host_hash) {
+        cur = &pinfo[ucc_ep_map_eval(topo->set.map, i)];
+        if (cur->host_hash != prev->host_hash) {
             /* check if we saw that host_has before*/
             for (j = 0; j < num_visited; j++) {
-                if (visited[j] == pinfo[i].host_hash) {
+                if (visited[j] == cur->host_hash) {
                     break;
                 }
             }
@@ -490,16 +507,16 @@ static ucc_status_t sbgp_create_full_ordered(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
                 break;
             }
             /* add new host to the list of visited */
-            visited[num_visited++] = pinfo[i].host_hash;
+            visited[num_visited++] = cur->host_hash;
         } else {
-            d = ucc_compare_proc_info_id(&pinfo[i - 1].host_hash,
-                                         &pinfo[i].host_hash);
+            d = ucc_compare_proc_info(prev, cur);
 
             if (d > 0) {
                 is_sorted = 0;
                 break;
             }
         }
+        prev = cur;
     }
     ucc_free(visited);
 
@@ -520,7 +537,7 @@ static ucc_status_t sbgp_create_full_ordered(ucc_topo_t *topo, ucc_sbgp_t *sbgp)
     }
 
     for (i = 0; i < gsize; i++) {
-        sorted[i].info = topo->topo->procs[i];
+        sorted[i].info = pinfo[ucc_ep_map_eval(topo->set.map, i)];
         sorted[i].id   = i;
     }
 
@@ -0,0 +1,26 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "utils/ucc_component.h"
+
+#ifdef HAVE_BUILTIN_COMPONENTS
+#include "components/cl/basic/cl_basic.h"
+#include "components/cl/hier/cl_hier.h"
+#include "components/mc/cpu/mc_cpu.h"
+#include "components/ec/cpu/ec_cpu.h"
+
+/* Components linked into libucc with --enable-builtin-components.
+   ucc_components_load registers them without opening the modules dir */
+ucc_component_builtin_t ucc_builtin_components[] = {
+    {"cl", &ucc_cl_basic.super.super},
+    {"cl", &ucc_cl_hier.super.super},
+    {"mc", &ucc_mc_cpu.super.super},
+    {"ec", &ucc_ec_cpu.super.super},
+    {NULL, NULL}};
+#else
+ucc_component_builtin_t ucc_builtin_components[] = {{NULL, NULL}};
+#endif
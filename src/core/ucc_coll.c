@@ -14,6 +14,7 @@
 #include "utils/ucc_log.h"
 #include "utils/ucc_coll_utils.h"
 #include "utils/ucc_time.h"
+#include "utils/ucc_atomic.h"
 #include "utils/profile/ucc_profile_core.h"
 #include "schedule/ucc_schedule.h"
 #include "coll_score/ucc_coll_score.h"
@@ -46,6 +47,8 @@ static ucc_status_t ucc_check_coll_args(const ucc_coll_args_t *coll_args,
     switch (coll_args->coll_type) {
     case UCC_COLL_TYPE_ALLREDUCE:
     case UCC_COLL_TYPE_REDUCE_SCATTER:
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
         if (!UCC_IS_INPLACE(*coll_args)) {
             UCC_BUFFER_INFO_CHECK_DATATYPE(coll_args->src.info,
                                            coll_args->dst.info);
@@ -61,6 +64,8 @@ static ucc_status_t ucc_check_coll_args(const ucc_coll_args_t *coll_args,
     case UCC_COLL_TYPE_BARRIER:
     case UCC_COLL_TYPE_FANIN:
     case UCC_COLL_TYPE_FANOUT:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
         if (UCC_IS_INPLACE(*coll_args)) {
             ucc_warn("Inplace flag for %s is not defined by UCC API",
                      ucc_coll_type_str(coll_args->coll_type));
@@ -87,6 +92,8 @@ static ucc_status_t ucc_coll_args_check_mem_type(ucc_coll_args_t *coll_args,
         UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->src.info);
         return UCC_OK;
     case UCC_COLL_TYPE_ALLREDUCE:
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
         UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->dst.info);
         if (!UCC_IS_INPLACE(*coll_args)) {
             UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->src.info);
@@ -115,6 +122,14 @@ static ucc_status_t ucc_coll_args_check_mem_type(ucc_coll_args_t *coll_args,
             UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->src.info_v);
         }
         return UCC_OK;
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
+        UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->dst.info_v);
+        UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->src.info_v);
+        return UCC_OK;
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
+        UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->dst.info);
+        UCC_BUFFER_INFO_CHECK_MEM_TYPE(coll_args->src.info);
+        return UCC_OK;
     case UCC_COLL_TYPE_GATHER:
     	// TODO: Check logic for Gather once implemented
     case UCC_COLL_TYPE_REDUCE:
@@ -164,7 +179,71 @@ static ucc_status_t ucc_coll_args_check_mem_type(ucc_coll_args_t *coll_args,
      UCC_COLL_TYPE_BCAST |           \
      UCC_COLL_TYPE_GATHER |          \
      UCC_COLL_TYPE_REDUCE |          \
-     UCC_COLL_TYPE_SCATTER)
+     UCC_COLL_TYPE_SCATTER |         \
+     UCC_COLL_TYPE_SCAN |            \
+     UCC_COLL_TYPE_EXSCAN)
+
+#define UCC_COLL_TYPE_NEIGHBOR               \
+    (UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV |      \
+     UCC_COLL_TYPE_NEIGHBOR_ALLGATHER)
+
+#define UCC_COLL_TYPE_ACTIVE_SET \
+    (UCC_COLL_TYPE_ALLGATHER |   \
+     UCC_COLL_TYPE_ALLREDUCE |   \
+     UCC_COLL_TYPE_BARRIER |     \
+     UCC_COLL_TYPE_BCAST |       \
+     UCC_COLL_TYPE_GATHER |      \
+     UCC_COLL_TYPE_REDUCE)
+
+/* Returns position of team rank in the active set or -1 if it is not
+   a member of it */
+static inline int64_t ucc_active_set_pos(const ucc_coll_args_t *args,
+                                         ucc_rank_t             rank)
+{
+    int64_t dist = (int64_t)rank - (int64_t)args->active_set.start;
+
+    if (dist % args->active_set.stride) {
+        return -1;
+    }
+    dist /= args->active_set.stride;
+    return (dist >= 0 && dist < (int64_t)args->active_set.size) ? dist : -1;
+}
+
+static ucc_status_t ucc_check_active_set(const ucc_coll_args_t *args,
+                                         ucc_team_t            *team)
+{
+    const int64_t last = (int64_t)args->active_set.start +
+                         args->active_set.stride *
+                         ((int64_t)args->active_set.size - 1);
+
+    if (!(UCC_COLL_TYPE_ACTIVE_SET & args->coll_type)) {
+        ucc_warn("active sets are not supported for %s",
+                 ucc_coll_type_str(args->coll_type));
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (args->active_set.size == 0 || args->active_set.stride == 0 ||
+        args->active_set.start >= team->size || last < 0 ||
+        last >= team->size) {
+        ucc_error("invalid active set: start %" PRIu64 ", stride %" PRId64
+                  ", size %" PRIu64 " for team size %u", args->active_set.start,
+                  args->active_set.stride, args->active_set.size, team->size);
+        return UCC_ERR_INVALID_PARAM;
+    }
+    if (ucc_active_set_pos(args, team->rank) < 0) {
+        ucc_error("rank %u is not a member of the active set", team->rank);
+        return UCC_ERR_INVALID_PARAM;
+    }
+    if ((UCC_COLL_TYPE_BCAST | UCC_COLL_TYPE_GATHER | UCC_COLL_TYPE_REDUCE) &
+        args->coll_type) {
+        if (args->root >= team->size ||
+            ucc_active_set_pos(args, args->root) < 0) {
+            ucc_error("root %" PRIu64 " is not a member of the active set",
+                      args->root);
+            return UCC_ERR_INVALID_PARAM;
+        }
+    }
+    return UCC_OK;
+}
 
 UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init,
                       (coll_args, request, team), ucc_coll_args_t *coll_args,
@@ -200,14 +279,29 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init,
             UCC_COPY_PARAM_BY_FIELD(&op_args.args, coll_args,
                                     UCC_COLL_ARGS_FIELD_FLAGS, flags);
             ucc_coll_task_init(task, &op_args, NULL);
+            task->flags |= UCC_COLL_TASK_FLAG_TOP_LEVEL;
             goto print_trace;
         }
+        if (ucc_unlikely(!ucc_coll_args_is_predefined_dt(coll_args,
+                                                         team->rank))) {
+            /* don't call user pack callbacks again in score map lookup */
+            op_args.mask   |= UCC_BASE_CARGS_MSGSIZE;
+            op_args.msgsize = coll_size;
+        }
     }
 
-    if (UCC_COLL_ARGS_ACTIVE_SET(coll_args) &&
-        (UCC_COLL_TYPE_BCAST != coll_args->coll_type)) {
-        ucc_warn("Active Sets are only supported for bcast");
-        return UCC_ERR_NOT_SUPPORTED;
+    if ((UCC_COLL_TYPE_NEIGHBOR & coll_args->coll_type) &&
+        !(team->bp.params.mask & UCC_TEAM_PARAM_FIELD_NEIGHBORS)) {
+        ucc_error("%s requires team created with neighbor graph",
+                  ucc_coll_type_str(coll_args->coll_type));
+        return UCC_ERR_INVALID_PARAM;
+    }
+
+    if (UCC_COLL_ARGS_ACTIVE_SET(coll_args)) {
+        status = ucc_check_active_set(coll_args, team);
+        if (ucc_unlikely(status != UCC_OK)) {
+            return status;
+        }
     }
 
     status = ucc_coll_args_check_mem_type(coll_args, team->rank);
@@ -290,6 +384,9 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init,
     ucc_assert(task->super.status == UCC_OPERATION_INITIALIZED);
 
 print_trace:
+    if (ucc_global_config.coll_stats) {
+        ucc_coll_stats_task_init(task);
+    }
     *request = &task->super;
     if (ucc_unlikely(ucc_global_config.coll_trace.log_level >=
                      UCC_LOG_LEVEL_DIAG)) {
@@ -369,7 +466,7 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_post, (request),
     }
 
     COLL_POST_STATUS_CHECK(task);
-    if (UCC_COLL_TIMEOUT_REQUIRED(task)) {
+    if (UCC_COLL_TIMEOUT_REQUIRED(task) || ucc_global_config.coll_stats) {
         task->start_time = ucc_get_time();
     }
 
@@ -378,14 +475,35 @@ UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_post, (request),
         if (ucc_unlikely(status != UCC_OK)) {
             ucc_error("failed to start executor: %s",
                       ucc_status_string(status));
+        } else if (task->bargs.team) {
+            ucc_atomic_add32(&task->bargs.team->contexts[0]->n_executor_colls,
+                             1);
+            task->flags |= UCC_COLL_TASK_FLAG_EXECUTOR_COUNTED;
         }
     }
-    return task->post(task);
+    status = task->post(task);
+    if (ucc_unlikely(status < 0) &&
+        (task->flags & UCC_COLL_TASK_FLAG_EXECUTOR_COUNTED)) {
+        /* failed post never reaches completion, where it is uncounted */
+        ucc_collective_executor_done(task);
+    }
+    if (task->bargs.team && task->bargs.team->contexts[0]->progress_thread) {
+        ucc_progress_thread_signal(
+            task->bargs.team->contexts[0]->progress_thread);
+    }
+    return status;
+}
+
+void ucc_collective_executor_done(ucc_coll_task_t *task)
+{
+    task->flags &= ~UCC_COLL_TASK_FLAG_EXECUTOR_COUNTED;
+    ucc_atomic_sub32(&task->bargs.team->contexts[0]->n_executor_colls, 1);
 }
 
 ucc_status_t ucc_collective_triggered_post(ucc_ee_h ee, ucc_ev_t *ev)
 {
     ucc_coll_task_t *task = ucc_derived_of(ev->req, ucc_coll_task_t);
+    ucc_status_t     status;
 
     if (ucc_global_config.coll_trace.log_level >= UCC_LOG_LEVEL_DEBUG) {
         ucc_rank_t rank = task->bargs.team->rank;
@@ -405,10 +523,16 @@ ucc_status_t ucc_collective_triggered_post(ucc_ee_h ee, ucc_ev_t *ev)
     }
 
     COLL_POST_STATUS_CHECK(task);
-    if (UCC_COLL_TIMEOUT_REQUIRED(task)) {
+    if (UCC_COLL_TIMEOUT_REQUIRED(task) || ucc_global_config.coll_stats) {
         task->start_time = ucc_get_time();
     }
-    return task->triggered_post(ee, ev, task);
+    status = task->triggered_post(ee, ev, task);
+    /* zero size collectives are not bound to the team */
+    if (task->bargs.team && task->bargs.team->contexts[0]->progress_thread) {
+        ucc_progress_thread_signal(
+            task->bargs.team->contexts[0]->progress_thread);
+    }
+    return status;
 }
 
 UCC_CORE_PROFILE_FUNC(ucc_status_t, ucc_collective_init_and_post,
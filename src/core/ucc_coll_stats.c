@@ -0,0 +1,250 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_coll_stats.h"
+#include "ucc_team.h"
+#include "ucc_context.h"
+#include "ucc_global_opts.h"
+#include "schedule/ucc_schedule.h"
+#include "components/cl/ucc_cl.h"
+#include "components/tl/ucc_tl.h"
+#include "utils/ucc_coll_utils.h"
+#include "utils/ucc_time.h"
+#include <inttypes.h>
+
+/* Local message size of the collective. For vector collectives the total size
+   can not be computed w/o communication, so only local contribution is
+   accounted. */
+static size_t ucc_coll_stats_msgsize(ucc_base_coll_args_t *bargs,
+                                     ucc_rank_t rank, ucc_rank_t size)
+{
+    const ucc_coll_args_t *args    = &bargs->args;
+    size_t                 msgsize = ucc_base_coll_args_msgsize(bargs, rank,
+                                                                size);
+
+    if (msgsize != UCC_MSG_SIZE_ASYMMETRIC) {
+        return msgsize;
+    }
+
+    switch (args->coll_type) {
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
+        return ucc_dt_buffer_size(args->src.info.datatype,
+                                  args->src.info.buffer,
+                                  args->src.info.count);
+    case UCC_COLL_TYPE_ALLTOALLV:
+        return ucc_dt_buffer_size(args->src.info_v.datatype,
+                                  args->src.info_v.buffer,
+                                  ucc_coll_args_get_total_count(
+                                      args, args->src.info_v.counts, size));
+    case UCC_COLL_TYPE_GATHERV:
+        return UCC_IS_ROOT(*args, rank)
+                   ? ucc_dt_buffer_size(args->dst.info_v.datatype,
+                                        args->dst.info_v.buffer,
+                                        ucc_coll_args_get_total_count(
+                                            args, args->dst.info_v.counts,
+                                            size))
+                   : ucc_dt_buffer_size(args->src.info.datatype,
+                                        args->src.info.buffer,
+                                        args->src.info.count);
+    case UCC_COLL_TYPE_SCATTERV:
+        return UCC_IS_ROOT(*args, rank)
+                   ? ucc_dt_buffer_size(args->src.info_v.datatype,
+                                        args->src.info_v.buffer,
+                                        ucc_coll_args_get_total_count(
+                                            args, args->src.info_v.counts,
+                                            size))
+                   : ucc_dt_buffer_size(args->dst.info.datatype,
+                                        args->dst.info.buffer,
+                                        args->dst.info.count);
+    default:
+        return 0;
+    }
+}
+
+/* Name of the algorithm from alg_info of CL/TL iface, the same way
+   ucc_coll_str distinguishes CL and TL libs */
+static const char *ucc_coll_stats_alg_name(ucc_base_lib_t *lib, int ct,
+                                           int alg_id)
+{
+    ucc_base_coll_alg_info_t *info;
+
+    if (alg_id < 0) {
+        return "";
+    }
+    info = (lib->log_component.name[0] == 'C') ?
+        ucc_derived_of(lib, ucc_cl_lib_t)->iface->alg_info[ct] :
+        ucc_derived_of(lib, ucc_tl_lib_t)->iface->alg_info[ct];
+    for (; info && info->name; info++) {
+        if (info->id == alg_id) {
+            return info->name;
+        }
+    }
+    return "";
+}
+
+static inline void ucc_coll_counters_alg(ucc_coll_counters_t *c,
+                                         ucc_coll_task_t *task,
+                                         const char *name, int ct)
+{
+    ucc_coll_alg_stats_t *a;
+    uint32_t              i;
+
+    for (i = 0; i < c->stats.n_algs; i++) {
+        a = &c->stats.algs[i];
+        if (c->alg_names[i] == name && a->id == task->alg_id &&
+            a->coll_type == task->bargs.args.coll_type) {
+            a->n_colls++;
+            return;
+        }
+    }
+    if (i == UCC_COLL_STATS_MAX_ALGS) {
+        return;
+    }
+    a               = &c->stats.algs[i];
+    c->alg_names[i] = name;
+    a->id           = task->alg_id;
+    a->coll_type    = task->bargs.args.coll_type;
+    a->n_colls      = 1;
+    ucc_strncpy_safe(a->component, name, UCC_COLL_STATS_NAME_MAX);
+    ucc_strncpy_safe(a->name,
+                     ucc_coll_stats_alg_name(task->team->context->lib, ct,
+                                             task->alg_id),
+                     UCC_COLL_STATS_ALG_NAME_MAX);
+    c->stats.n_algs++;
+}
+
+static inline void ucc_coll_counters_init(ucc_coll_counters_t *c,
+                                          ucc_coll_task_t *task, int ct)
+{
+    const char *name;
+    uint32_t    i;
+
+    c->stats.colls[ct].n_init++;
+    if (!task->team) {
+        /* zero size collective, no CL or TL */
+        return;
+    }
+    name = task->team->context->lib->log_component.name;
+    ucc_coll_counters_alg(c, task, name, ct);
+    for (i = 0; i < c->stats.n_components; i++) {
+        if (c->names[i] == name) {
+            break;
+        }
+    }
+    if (i == c->stats.n_components) {
+        if (i == UCC_COLL_STATS_MAX_COMPONENTS) {
+            return;
+        }
+        c->names[i] = name;
+        ucc_strncpy_safe(c->stats.components[i].name, name,
+                         UCC_COLL_STATS_NAME_MAX);
+        c->stats.n_components++;
+    }
+    c->stats.components[i].n_colls[ct]++;
+}
+
+void ucc_coll_stats_task_init(ucc_coll_task_t *task)
+{
+    ucc_team_t *team = task->bargs.team;
+    int         ct   = ucc_ilog2(task->bargs.args.coll_type);
+
+    task->bytes = ucc_coll_stats_msgsize(&task->bargs, team->rank,
+                                         team->size);
+    ucc_coll_counters_init(&team->coll_stats, task, ct);
+    ucc_coll_counters_init(&team->contexts[0]->coll_stats, task, ct);
+}
+
+static inline void ucc_coll_counters_complete(ucc_coll_counters_t *c, int ct,
+                                              ucc_status_t status,
+                                              size_t bytes, double time)
+{
+    ucc_coll_type_stats_t *s = &c->stats.colls[ct];
+
+    if (ucc_unlikely(status != UCC_OK)) {
+        s->n_errors++;
+        return;
+    }
+    s->n_complete++;
+    s->bytes += bytes;
+    s->time  += time;
+}
+
+void ucc_coll_stats_task_complete(ucc_coll_task_t *task)
+{
+    ucc_team_t *team = task->bargs.team;
+    int         ct   = ucc_ilog2(task->bargs.args.coll_type);
+    double      time = ucc_get_time() - task->start_time;
+
+    ucc_coll_counters_complete(&team->coll_stats, ct, task->status,
+                               task->bytes, time);
+    ucc_coll_counters_complete(&team->contexts[0]->coll_stats, ct,
+                               task->status, task->bytes, time);
+}
+
+void ucc_coll_stats_add_fallback(ucc_team_t *team)
+{
+    if (!ucc_global_config.coll_stats || !team) {
+        return;
+    }
+    team->coll_stats.stats.n_fallbacks++;
+    team->contexts[0]->coll_stats.stats.n_fallbacks++;
+}
+
+void ucc_coll_stats_add_scratch(ucc_team_t *team, size_t size)
+{
+    if (!ucc_global_config.coll_stats || !team) {
+        return;
+    }
+    team->coll_stats.stats.scratch_bytes += size;
+    team->contexts[0]->coll_stats.stats.scratch_bytes += size;
+}
+
+void ucc_coll_stats_get(const ucc_coll_counters_t *counters,
+                        ucc_coll_stats_t *stats)
+{
+    memcpy(stats, &counters->stats, sizeof(*stats));
+}
+
+void ucc_coll_stats_print(const ucc_coll_stats_t *stats, FILE *stream,
+                          const char *title)
+{
+    const ucc_coll_type_stats_t *s;
+    uint32_t                     i, j;
+
+    fprintf(stream, "# %s\n", title);
+    for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+        s = &stats->colls[i];
+        if (!s->n_init) {
+            continue;
+        }
+        fprintf(stream,
+                "#   %-16s init %" PRIu64 ", complete %" PRIu64
+                ", errors %" PRIu64 ", bytes %" PRIu64 ", time %.6f s\n",
+                ucc_coll_type_str((ucc_coll_type_t)UCC_BIT(i)), s->n_init,
+                s->n_complete, s->n_errors, s->bytes, s->time);
+    }
+    for (j = 0; j < stats->n_components; j++) {
+        fprintf(stream, "#   %-16s", stats->components[j].name);
+        for (i = 0; i < UCC_COLL_TYPE_NUM; i++) {
+            if (stats->components[j].n_colls[i]) {
+                fprintf(stream, " %s %" PRIu64 ";",
+                        ucc_coll_type_str((ucc_coll_type_t)UCC_BIT(i)),
+                        stats->components[j].n_colls[i]);
+            }
+        }
+        fprintf(stream, "\n");
+    }
+    for (j = 0; j < stats->n_algs; j++) {
+        fprintf(stream, "#   %-16s %s alg %d %s: %" PRIu64 "\n",
+                stats->algs[j].component,
+                ucc_coll_type_str(stats->algs[j].coll_type),
+                stats->algs[j].id, stats->algs[j].name,
+                stats->algs[j].n_colls);
+    }
+    fprintf(stream, "#   fallbacks %" PRIu64 ", scratch bytes %" PRIu64 "\n",
+            stats->n_fallbacks, stats->scratch_bytes);
+}
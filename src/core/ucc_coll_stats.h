@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_COLL_STATS_H_
+#define UCC_COLL_STATS_H_
+
+#include "ucc/api/ucc.h"
+#include <stdio.h>
+
+struct ucc_coll_task;
+struct ucc_team;
+
+/* Collective counters of team or context. Component names are pointers to
+   the log component names of CL/TL libs, so lookup on the fast path is a
+   pointer compare. Algorithms are keyed by the same pointer, coll type and
+   algorithm id. */
+typedef struct ucc_coll_counters {
+    ucc_coll_stats_t stats;
+    const char      *names[UCC_COLL_STATS_MAX_COMPONENTS];
+    const char      *alg_names[UCC_COLL_STATS_MAX_ALGS];
+} ucc_coll_counters_t;
+
+/* Accounts the initialized top-level task: selected component, algorithm
+   and local message size of the collective */
+void ucc_coll_stats_task_init(struct ucc_coll_task *task);
+
+/* Accounts completion of the top-level task: status and time since post */
+void ucc_coll_stats_task_complete(struct ucc_coll_task *task);
+
+/* Called by ucc_coll_init when the selected algorithm doesn't support the
+   collective and the next one from the fallback list is tried */
+void ucc_coll_stats_add_fallback(struct ucc_team *team);
+
+/* Accounts scratch buffer allocated by a collective of the team, team can be
+   NULL for internal collectives not bound to a core team */
+void ucc_coll_stats_add_scratch(struct ucc_team *team, size_t size);
+
+void ucc_coll_stats_get(const ucc_coll_counters_t *counters,
+                        ucc_coll_stats_t *stats);
+
+void ucc_coll_stats_print(const ucc_coll_stats_t *stats, FILE *stream,
+                          const char *title);
+
+#endif
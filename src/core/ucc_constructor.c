@@ -13,6 +13,8 @@
 #include "utils/ucc_string.h"
 #include "utils/ucc_proc_info.h"
 #include "utils/profile/ucc_profile.h"
+#include "components/cl/ucc_cl.h"
+#include "ucc_lib.h"
 #include "ucc/api/ucc_version.h"
 #include <dlfcn.h>
 #include <pthread.h>
@@ -91,6 +93,37 @@ out:
     return status;
 }
 
+/* Components filters are derived from the parsed lib and CL configs, so
+   that both env and config file are respected. CL filter is UCC_CLS. TL
+   filter is the union of the TLs selected by the requested CLs, e.g.
+   UCC_CL_BASIC_TLS or UCC_CL_HIER_*_SBGP_TLS. Empty filter loads all,
+   TL filter is left empty if any CL may use any TL. */
+static void ucc_components_tl_filter(const ucc_config_names_array_t *cls,
+                                     ucc_config_names_array_t *tls)
+{
+    ucc_component_framework_t *cl_framework = &ucc_global_config.cl_framework;
+    ucc_cl_iface_t            *cl_iface;
+    ucc_status_t               status;
+    int                        i;
+
+    for (i = 0; i < cl_framework->n_components; i++) {
+        cl_iface = ucc_derived_of(cl_framework->components[i],
+                                  ucc_cl_iface_t);
+        if (cls->count &&
+            ucc_config_names_search(cls, cl_iface->super.name) < 0) {
+            /* builtin CL which is not requested */
+            continue;
+        }
+        status = ucc_cl_lib_config_tls(cl_iface, "UCC_", tls);
+        if (UCC_OK != status) {
+            ucc_config_names_array_free(tls);
+            tls->count = 0;
+            tls->names = NULL;
+            return;
+        }
+    }
+}
+
 UCC_CONFIG_REGISTER_TABLE(ucc_global_config_table, "UCC global", NULL,
                           ucc_global_config, &ucc_config_global_list)
 
@@ -98,10 +131,12 @@ static pthread_mutex_t ucc_constructor_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 ucc_status_t ucc_constructor(void)
 {
-    ucc_global_config_t *cfg    = &ucc_global_config;
-    ucc_status_t         status = UCC_OK;
-    Dl_info              dl_info;
-    int                  ret;
+    ucc_global_config_t     *cfg    = &ucc_global_config;
+    ucc_status_t             status = UCC_OK;
+    ucc_config_names_array_t cls    = {0};
+    ucc_config_names_array_t tls    = {0};
+    Dl_info                  dl_info;
+    int                      ret;
 
     pthread_mutex_lock(&ucc_constructor_mutex);
     if (cfg->initialized) {
@@ -128,7 +163,14 @@ ucc_status_t ucc_constructor(void)
         goto exit_unlock_mutex;
     }
 
-    status = ucc_components_load("cl", &cfg->cl_framework);
+    if (cfg->components_filter &&
+        UCC_OK != ucc_lib_config_cls("UCC_", &cls)) {
+        /* all CLs requested or invalid UCC_CLS, reported by lib init */
+        ucc_config_names_array_free(&cls);
+        cls.count = 0;
+        cls.names = NULL;
+    }
+    status = ucc_components_load_filtered("cl", &cls, &cfg->cl_framework);
     if (UCC_OK != status) {
         ucc_error("no CL components were found in the "
                   "ucc modules dir: %s", cfg->component_path);
@@ -139,7 +181,10 @@ ucc_status_t ucc_constructor(void)
         ucc_error("CLs must have distinct uniq default scores");
         goto exit_unlock_mutex;
     }
-    status = ucc_components_load("tl", &cfg->tl_framework);
+    if (cfg->components_filter) {
+        ucc_components_tl_filter(&cls, &tls);
+    }
+    status = ucc_components_load_filtered("tl", &tls, &cfg->tl_framework);
     if (UCC_OK != status) {
         /* not critical - some CLs may operate w/o use of TL */
         ucc_debug("no TL components were found in the "
@@ -192,6 +237,8 @@ ucc_status_t ucc_constructor(void)
     }
 
 exit_unlock_mutex:
+    ucc_config_names_array_free(&cls);
+    ucc_config_names_array_free(&tls);
     pthread_mutex_unlock(&ucc_constructor_mutex);
     return status;
 }
@@ -12,7 +12,11 @@
 #include "utils/ucc_log.h"
 #include "utils/ucc_list.h"
 #include "utils/ucc_string.h"
+#include "utils/ucc_time.h"
 #include "ucc_progress_queue.h"
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <errno.h>
 
 static uint32_t ucc_context_seq_num = 0;
 static ucc_config_field_t ucc_context_config_table[] = {
@@ -50,6 +54,42 @@ static ucc_config_field_t ucc_context_config_table[] = {
      ucc_offsetof(ucc_context_config_t, throttle_progress),
      UCC_CONFIG_TYPE_UINT},
 
+    {"WAIT_SPIN_TIME", "50us",
+     "Time ucc_context_wait busy polls the context before going to sleep on "
+     "the context event fd",
+     ucc_offsetof(ucc_context_config_t, wait_spin_time),
+     UCC_CONFIG_TYPE_TIME},
+
+    {"WAIT_SLEEP_TIMEOUT", "10ms",
+     "Max time ucc_context_wait sleeps on the context event fd before "
+     "progressing the context again. Bounds the latency of components that "
+     "don't provide event fds",
+     ucc_offsetof(ucc_context_config_t, wait_sleep_timeout),
+     UCC_CONFIG_TYPE_TIME},
+
+    {"PROGRESS_THREAD", "n",
+     "Progress collectives of the context by an asynchronous thread, so that "
+     "posted collectives advance while the application computes. Requires "
+     "UCC_THREAD_MULTIPLE library thread mode. The thread sleeps when there "
+     "are no outstanding collectives for WAIT_SPIN_TIME unless the lock free "
+     "progress queue is used",
+     ucc_offsetof(ucc_context_config_t, progress_thread),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"PROGRESS_THREAD_CORE", "-1",
+     "CPU core the progress thread is bound to, -1 - no binding",
+     ucc_offsetof(ucc_context_config_t, progress_thread_core),
+     UCC_CONFIG_TYPE_INT},
+
+    {"LAZY_TLS", "",
+     "Comma separated list of TLs whose contexts are not created by "
+     "ucc_context_create but on the first use by a team, and destroyed when "
+     "no team uses them anymore. Only TLs whose context creation is local "
+     "to the process can be lazy (self, cuda, nccl, rccl), others are "
+     "created by ucc_context_create as usual",
+     ucc_offsetof(ucc_context_config_t, lazy_tls),
+     UCC_CONFIG_TYPE_STRING_ARRAY},
+
     {NULL}};
 UCC_CONFIG_REGISTER_TABLE(ucc_context_config_table, "UCC context", NULL,
                           ucc_context_config_t, &ucc_config_global_list);
@@ -304,6 +344,8 @@ void ucc_context_config_release(ucc_context_config_t *config)
     }
     ucc_free(config->tl_cfgs);
     ucc_free(config->cl_cfgs);
+    ucc_config_parser_release_opts(
+        config, UCC_CONFIG_GET_TABLE(ucc_context_config_table));
     ucc_free(config);
 }
 
@@ -359,6 +401,43 @@ static inline void ucc_copy_context_params(ucc_context_params_t *dst,
     UCC_COPY_PARAM_BY_FIELD(dst, src, UCC_CONTEXT_PARAM_FIELD_MEM_PARAMS, mem_params);
 }
 
+static ucc_status_t
+ucc_tl_context_config_dup(const ucc_tl_context_config_t *src,
+                          ucc_tl_context_config_t      **dst)
+{
+    ucc_config_global_list_entry_t *entry = src->super.super.cfg_entry;
+    ucc_tl_context_config_t        *cfg;
+    ucc_status_t                    status;
+
+    cfg = ucc_malloc(entry->size, "lazy_tl_ctx_cfg");
+    if (!cfg) {
+        ucc_error("failed to allocate %zd bytes for tl context config",
+                  entry->size);
+        return UCC_ERR_NO_MEMORY;
+    }
+    status = ucc_config_clone_table(src, cfg, entry->table);
+    if (UCC_OK != status) {
+        ucc_free(cfg);
+        return status;
+    }
+    cfg->super.super.cfg_entry = entry;
+    cfg->tl_lib                = src->tl_lib;
+    *dst                       = cfg;
+    return UCC_OK;
+}
+
+static void ucc_context_lazy_tl_cfgs_release(ucc_context_t *ctx)
+{
+    int i;
+
+    for (i = 0; i < ctx->n_lazy_tl_cfgs; i++) {
+        ucc_base_config_release(&ctx->lazy_tl_cfgs[i]->super.super);
+    }
+    ucc_free(ctx->lazy_tl_cfgs);
+    ctx->lazy_tl_cfgs   = NULL;
+    ctx->n_lazy_tl_cfgs = 0;
+}
+
 static ucc_status_t ucc_create_tl_contexts(ucc_context_t *ctx,
                                            ucc_context_config_t *ctx_config,
                                            ucc_base_context_params_t b_params)
@@ -381,7 +460,16 @@ static ucc_status_t ucc_create_tl_contexts(ucc_context_t *ctx,
                   sizeof(ucc_tl_context_t *) * num_tls);
         return UCC_ERR_NO_MEMORY;
     }
-    ctx->n_tl_ctx = 0;
+    ctx->lazy_tl_cfgs = (ucc_tl_context_config_t **)ucc_malloc(
+        sizeof(ucc_tl_context_config_t *) * num_tls, "lazy_tl_cfgs");
+    if (!ctx->lazy_tl_cfgs) {
+        ucc_error("failed to allocate %zd bytes for lazy tl configs",
+                  sizeof(ucc_tl_context_config_t *) * num_tls);
+        ucc_free(ctx->tl_ctx);
+        return UCC_ERR_NO_MEMORY;
+    }
+    ctx->n_tl_ctx       = 0;
+    ctx->n_lazy_tl_cfgs = 0;
     for (i = 0; i < num_tls; i++) {
         tl_lib = ctx_config->tl_cfgs[i]->tl_lib;
         status = tl_lib->iface->lib.get_attr(&tl_lib->super, &attr);
@@ -397,6 +485,26 @@ static ucc_status_t ucc_create_tl_contexts(ucc_context_t *ctx,
                       tl_lib->iface->super.name);
             continue;
         }
+        if (ucc_config_names_search(&ctx_config->lazy_tls,
+                                    tl_lib->iface->super.name) >= 0) {
+            if (!(attr.flags & UCC_BASE_LIB_FLAG_LAZY_CONTEXT)) {
+                ucc_warn("tl/%s context can not be created lazily, "
+                         "creating it now", tl_lib->iface->super.name);
+                goto create;
+            }
+            status = ucc_tl_context_config_dup(ctx_config->tl_cfgs[i],
+                           &ctx->lazy_tl_cfgs[ctx->n_lazy_tl_cfgs]);
+            if (UCC_OK != status) {
+                ucc_error("failed to copy tl/%s context config",
+                          tl_lib->iface->super.name);
+                goto err;
+            }
+            ucc_debug("tl/%s context is created on first use",
+                      tl_lib->iface->super.name);
+            ctx->n_lazy_tl_cfgs++;
+            continue;
+        }
+create:
         // coverity[overrun-buffer-val:FALSE]
         status = tl_lib->iface->context.create(
             &b_params, &ctx_config->tl_cfgs[i]->super.super, &b_ctx);
@@ -417,18 +525,19 @@ static ucc_status_t ucc_create_tl_contexts(ucc_context_t *ctx,
         ctx->tl_ctx[ctx->n_tl_ctx] = ucc_derived_of(b_ctx, ucc_tl_context_t);
         ctx->n_tl_ctx++;
     }
-    if (ctx->n_tl_ctx == 0) {
+    if (ctx->n_tl_ctx == 0 && ctx->n_lazy_tl_cfgs == 0) {
         ucc_error("no tl contexts were created");
         status = UCC_ERR_NOT_FOUND;
         goto err;
     }
-    /* build the list of names of all available tl contexts.
-       This is a convenience data struct for CLs */
-    ctx->all_tls.count = ctx->n_tl_ctx;
-    ctx->all_tls.names = ucc_malloc(sizeof(char*) * ctx->n_tl_ctx, "all_tls");
+    /* build the list of names of all available tl contexts, including
+       the lazy ones. This is a convenience data struct for CLs */
+    ctx->all_tls.count = ctx->n_tl_ctx + ctx->n_lazy_tl_cfgs;
+    ctx->all_tls.names = ucc_malloc(sizeof(char*) * ctx->all_tls.count,
+                                    "all_tls");
     if (!ctx->all_tls.names) {
         ucc_error("failed to allocate %zd bytes for all_tls names",
-                  sizeof(char*) * ctx->n_tl_ctx);
+                  sizeof(char*) * ctx->all_tls.count);
         status = UCC_ERR_NO_MEMORY;
         goto err;
 
@@ -437,12 +546,17 @@ static ucc_status_t ucc_create_tl_contexts(ucc_context_t *ctx,
         ctx->all_tls.names[i] = (char*)ucc_derived_of(ctx->tl_ctx[i]->super.lib,
                                                ucc_tl_lib_t)->iface->super.name;
     }
+    for (i = 0; i < ctx->n_lazy_tl_cfgs; i++) {
+        ctx->all_tls.names[ctx->n_tl_ctx + i] =
+            (char*)ctx->lazy_tl_cfgs[i]->tl_lib->iface->super.name;
+    }
     return UCC_OK;
 err:
     for (i = 0; i < ctx->n_tl_ctx; i++) {
         tl_lib = ucc_derived_of(ctx->tl_ctx[i]->super.lib, ucc_tl_lib_t);
         tl_lib->iface->context.destroy(&ctx->tl_ctx[i]->super);
     }
+    ucc_context_lazy_tl_cfgs_release(ctx);
     ucc_free(ctx->tl_ctx);
     return status;
 }
@@ -591,6 +705,83 @@ static void remove_tl_ctx_from_array(ucc_tl_context_t **array, unsigned *size,
     }
 }
 
+int ucc_context_tl_is_lazy(ucc_context_t *ctx, const char *name)
+{
+    int i;
+
+    for (i = 0; i < ctx->n_lazy_tl_cfgs; i++) {
+        if (0 == strcmp(ctx->lazy_tl_cfgs[i]->tl_lib->iface->super.name,
+                        name)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+ucc_status_t ucc_context_tl_create_lazy(ucc_context_t *ctx, const char *name,
+                                        ucc_tl_context_t **tl_ctx)
+{
+    ucc_tl_context_config_t   *cfg = NULL;
+    ucc_base_context_params_t  b_params;
+    ucc_base_context_t        *b_ctx;
+    ucc_tl_lib_t              *tl_lib;
+    ucc_status_t               status;
+    int                        i;
+
+    for (i = 0; i < ctx->n_lazy_tl_cfgs; i++) {
+        if (0 == strcmp(ctx->lazy_tl_cfgs[i]->tl_lib->iface->super.name,
+                        name)) {
+            cfg = ctx->lazy_tl_cfgs[i];
+            break;
+        }
+    }
+    if (!cfg) {
+        return UCC_ERR_NOT_FOUND;
+    }
+    tl_lib = cfg->tl_lib;
+    ucc_copy_context_params(&b_params.params, &ctx->params);
+    b_params.context           = ctx;
+    b_params.estimated_num_eps = ctx->estimated_num_eps;
+    b_params.estimated_num_ppn = ctx->estimated_num_ppn;
+    b_params.prefix            = ctx->lib->full_prefix;
+    b_params.thread_mode       = ctx->lib->attr.thread_mode;
+    // coverity[overrun-buffer-val:FALSE]
+    status = tl_lib->iface->context.create(&b_params, &cfg->super.super,
+                                           &b_ctx);
+    if (UCC_OK != status) {
+        ucc_debug("failed to create lazy tl context for %s", name);
+        return status;
+    }
+    if (tl_lib->iface->context.create_epilog) {
+        status = tl_lib->iface->context.create_epilog(b_ctx);
+        if (UCC_OK != status) {
+            ucc_debug("lazy ctx create epilog for %s failed: %s", name,
+                      ucc_status_string(status));
+            goto err_destroy;
+        }
+    }
+    *tl_ctx         = ucc_derived_of(b_ctx, ucc_tl_context_t);
+    (*tl_ctx)->lazy = 1;
+    ctx->tl_ctx[ctx->n_tl_ctx++] = *tl_ctx;
+    ucc_debug("created lazy tl context %s", name);
+    return UCC_OK;
+
+err_destroy:
+    tl_lib->iface->context.destroy(b_ctx);
+    return status;
+}
+
+void ucc_context_tl_destroy_lazy(ucc_tl_context_t *tl_ctx)
+{
+    ucc_context_t *ctx    = tl_ctx->super.ucc_context;
+    ucc_tl_lib_t  *tl_lib = ucc_derived_of(tl_ctx->super.lib, ucc_tl_lib_t);
+
+    ucc_assert(tl_ctx->lazy && tl_ctx->ref_count == 0);
+    ucc_debug("destroying lazy tl context %s", tl_lib->iface->super.name);
+    remove_tl_ctx_from_array(ctx->tl_ctx, &ctx->n_tl_ctx, tl_ctx);
+    tl_lib->iface->context.destroy(&tl_ctx->super);
+}
+
 ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
                                           const ucc_context_params_t *params,
                                           const ucc_context_config_h  config,
@@ -623,7 +814,13 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
     ctx->rank              = UCC_RANK_MAX;
     ctx->lib               = lib;
     ctx->ids.pool_size     = config->team_ids_pool_size;
+    ctx->epfd              = -1;
+    ctx->n_executor_colls  = 0;
+    ctx->wait_spin_time    = config->wait_spin_time;
+    ctx->wait_sleep_timeout =
+        ucc_max((int)(config->wait_sleep_timeout * 1e3), 1);
     ucc_list_head_init(&ctx->progress_list);
+    ucc_list_head_init(&ctx->event_list);
     ucc_copy_context_params(&ctx->params, params);
     ucc_copy_context_params(&b_params.params, params);
     b_params.context           = ctx;
@@ -631,6 +828,8 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
     b_params.estimated_num_ppn = config->estimated_num_ppn;
     b_params.prefix            = lib->full_prefix;
     b_params.thread_mode       = lib->attr.thread_mode;
+    ctx->estimated_num_eps     = config->estimated_num_eps;
+    ctx->estimated_num_ppn     = config->estimated_num_ppn;
     if (params->mask & UCC_CONTEXT_PARAM_FIELD_OOB) {
         ctx->rank = params->oob.oob_ep;
     }
@@ -699,6 +898,10 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
         status = UCC_ERR_NO_MESSAGE;
         goto error_ctx;
     }
+    if (ctx->n_lazy_tl_cfgs > 0) {
+        /* lazy TLs are not known to CLs yet, their teams may need topo */
+        topo_required = 1;
+    }
 
     /* Initialize ctx thread mode:
        if context is EXCLUSIVE then thread_mode is always SINGLE,
@@ -830,12 +1033,25 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
             created_ctx_counter++;
         }
     }
-    if (0 == created_ctx_counter) {
+    if (0 == created_ctx_counter && 0 == ctx->n_lazy_tl_cfgs) {
         ucc_error("no TL context created");
         status = UCC_ERR_NO_RESOURCE;
         goto error_ctx_create_epilog;
     }
 
+    if (config->progress_thread) {
+        if (lib->attr.thread_mode != UCC_THREAD_MULTIPLE) {
+            ucc_warn("progress thread requires UCC_THREAD_MULTIPLE, "
+                     "progress thread is disabled");
+        } else {
+            status = ucc_progress_thread_start(
+                ctx, config->progress_thread_core, &ctx->progress_thread);
+            if (UCC_OK != status) {
+                goto error_ctx_create_epilog;
+            }
+        }
+    }
+
     ucc_debug("created ucc context %p for lib %s", ctx, lib->full_prefix);
     *context = ctx;
     return UCC_OK;
@@ -853,6 +1069,10 @@ error_ctx_create:
     }
     ucc_free(ctx->cl_ctx);
 error_ctx:
+    if (ctx->epfd >= 0) {
+        close(ctx->epfd);
+    }
+    ucc_context_lazy_tl_cfgs_release(ctx);
     ucc_free(ctx);
 error:
     return status;
@@ -884,6 +1104,9 @@ ucc_status_t ucc_context_destroy(ucc_context_t *context)
     int               i;
     ucc_status_t      status;
 
+    if (context->progress_thread) {
+        ucc_progress_thread_stop(context->progress_thread);
+    }
     if (context->service_team) {
         while (UCC_INPROGRESS ==
                (status = UCC_TL_CTX_IFACE(context->service_ctx)
@@ -913,9 +1136,13 @@ ucc_status_t ucc_context_destroy(ucc_context_t *context)
         }
         tl_lib->iface->context.destroy(&tl_ctx->super);
     }
+    if (context->epfd >= 0) {
+        close(context->epfd);
+    }
     ucc_context_topo_cleanup(context->topo);
     ucc_progress_queue_finalize(context->pq);
     ucc_free(context->addr_storage.storage);
+    ucc_context_lazy_tl_cfgs_release(context);
     ucc_free(context->all_tls.names);
     ucc_free(context->tl_ctx);
     ucc_free(context->ids.pool);
@@ -961,6 +1188,127 @@ ucc_status_t ucc_context_progress_deregister(ucc_context_t *ctx,
     return UCC_ERR_NOT_FOUND;
 }
 
+typedef struct ucc_context_event_entry {
+    ucc_list_link_t       list_elem;
+    int                   fd;
+    ucc_context_arm_fn_t  arm_fn;
+    void                 *arg;
+} ucc_context_event_entry_t;
+
+static inline ucc_status_t ucc_context_event_errno_status(int err)
+{
+    return (err == ENOMEM) ? UCC_ERR_NO_MEMORY : UCC_ERR_NO_RESOURCE;
+}
+
+ucc_status_t ucc_context_event_fd_register(ucc_context_t *ctx, int fd,
+                                           ucc_context_arm_fn_t arm_fn,
+                                           void *arm_arg)
+{
+    ucc_context_event_entry_t *entry;
+    struct epoll_event         ev;
+    ucc_status_t               status;
+
+    if (ctx->epfd < 0) {
+        ctx->epfd = epoll_create1(EPOLL_CLOEXEC);
+        if (ctx->epfd < 0) {
+            ucc_error("epoll_create1 failed: %m");
+            return ucc_context_event_errno_status(errno);
+        }
+    }
+    entry = ucc_malloc(sizeof(*entry), "event_entry");
+    if (!entry) {
+        ucc_error("failed to allocate %zd bytes for event entry",
+                  sizeof(*entry));
+        return UCC_ERR_NO_MEMORY;
+    }
+    ev.events  = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(ctx->epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        status = ucc_context_event_errno_status(errno);
+        ucc_error("failed to add fd %d to context epoll set: %m", fd);
+        ucc_free(entry);
+        return status;
+    }
+    entry->fd     = fd;
+    entry->arm_fn = arm_fn;
+    entry->arg    = arm_arg;
+    ucc_list_add_tail(&ctx->event_list, &entry->list_elem);
+    return UCC_OK;
+}
+
+ucc_status_t ucc_context_event_fd_deregister(ucc_context_t *ctx, int fd)
+{
+    ucc_context_event_entry_t *entry, *tmp;
+
+    ucc_list_for_each_safe(entry, tmp, &ctx->event_list, list_elem) {
+        if (entry->fd == fd) {
+            epoll_ctl(ctx->epfd, EPOLL_CTL_DEL, fd, NULL);
+            ucc_list_del(&entry->list_elem);
+            ucc_free(entry);
+            return UCC_OK;
+        }
+    }
+    return UCC_ERR_NOT_FOUND;
+}
+
+ucc_status_t ucc_context_arm(ucc_context_h context)
+{
+    ucc_context_event_entry_t *entry;
+    ucc_status_t               status;
+
+    if (context->epfd < 0) {
+        return UCC_ERR_NOT_SUPPORTED;
+    }
+    if (context->n_executor_colls) {
+        /* executor work completes without signaling any event fd */
+        return UCC_INPROGRESS;
+    }
+    ucc_list_for_each(entry, &context->event_list, list_elem) {
+        status = entry->arm_fn(entry->arg);
+        if (status != UCC_OK) {
+            return status;
+        }
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_context_wait(ucc_context_h context, ucc_coll_req_h request)
+{
+    double             deadline = ucc_get_time() + context->wait_spin_time;
+    struct epoll_event ev;
+    ucc_status_t       status;
+
+    while (UCC_INPROGRESS == (status = ucc_collective_test(request))) {
+        status = ucc_context_progress(context);
+        if (ucc_unlikely(status < 0)) {
+            return status;
+        }
+        if (ucc_get_time() < deadline) {
+            continue;
+        }
+        status = ucc_context_arm(context);
+        if (status == UCC_OK) {
+            /* re-check the request: completion could be reported by the
+               progress of the arm call */
+            if (UCC_INPROGRESS != ucc_collective_test(request)) {
+                continue;
+            }
+            if (epoll_wait(context->epfd, &ev, 1,
+                           context->wait_sleep_timeout) < 0 &&
+                errno != EINTR) {
+                status = ucc_context_event_errno_status(errno);
+                ucc_error("epoll_wait failed: %m");
+                return status;
+            }
+        } else if (ucc_unlikely(status != UCC_INPROGRESS &&
+                                status != UCC_ERR_NOT_SUPPORTED)) {
+            return status;
+        }
+        deadline = ucc_get_time() + context->wait_spin_time;
+    }
+    return status;
+}
+
 ucc_status_t ucc_context_progress(ucc_context_h context)
 {
     static int                    call_num = 0;
@@ -982,6 +1330,9 @@ ucc_status_t ucc_context_progress(ucc_context_h context)
         return UCC_OK;
     }
 
+    if (context->thread_mode != UCC_THREAD_MULTIPLE) {
+        context->progress_seq++;
+    }
     /* the fn below returns int - number of completed tasks.
        TODO : do we need to handle it ? Maybe return to user
        as int as well? */
@@ -1032,6 +1383,10 @@ static ucc_status_t ucc_context_pack_addr(ucc_context_t             *context,
     }
 
     for (i = 0; i < context->n_tl_ctx; i++) {
+        if (context->tl_ctx[i]->lazy) {
+            /* created after address exchange, has no address */
+            continue;
+        }
         tl_lib = ucc_derived_of(context->tl_ctx[i]->super.lib, ucc_tl_lib_t);
         attr.attr.ctx_addr = PTR_OFFSET(h, offset);
         status =
@@ -1104,6 +1459,21 @@ ucc_status_t ucc_context_get_attr(ucc_context_t      *context,
         context_attr->ctx_addr = context->attr.ctx_addr;
     }
 
+    if (context_attr->mask & UCC_CONTEXT_ATTR_FIELD_COLL_STATS) {
+        if (!context_attr->coll_stats) {
+            ucc_error("coll_stats storage is not provided");
+            return UCC_ERR_INVALID_PARAM;
+        }
+        ucc_coll_stats_get(&context->coll_stats, context_attr->coll_stats);
+    }
+
+    if (context_attr->mask & UCC_CONTEXT_ATTR_FIELD_EVENT_FD) {
+        if (context->epfd < 0) {
+            return UCC_ERR_NOT_SUPPORTED;
+        }
+        context_attr->event_fd = context->epfd;
+    }
+
     if (context_attr->mask & UCC_CONTEXT_ATTR_FIELD_WORK_BUFFER_SIZE) {
         uint64_t            max_buffer_size = 0;
         int                 i;
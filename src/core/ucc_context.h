@@ -12,6 +12,8 @@
 #include "utils/ucc_list.h"
 #include "utils/ucc_proc_info.h"
 #include "components/topo/ucc_topo.h"
+#include "ucc_coll_stats.h"
+#include "ucc_progress_thread.h"
 
 typedef struct ucc_lib_info          ucc_lib_info_t;
 typedef struct ucc_cl_context        ucc_cl_context_t;
@@ -22,6 +24,11 @@ typedef struct ucc_tl_team           ucc_tl_team_t;
 
 typedef unsigned (*ucc_context_progress_fn_t)(void *progress_arg);
 
+/* Arms the event fd of a component before the blocking wait. Returns UCC_OK
+   if the fd is armed and UCC_INPROGRESS if there are pending events and the
+   component must be progressed instead of sleeping. */
+typedef ucc_status_t (*ucc_context_arm_fn_t)(void *arm_arg);
+
 typedef struct ucc_team_id_pool {
     uint64_t *pool;
     uint32_t  pool_size;
@@ -78,6 +85,38 @@ typedef struct ucc_context {
     uint64_t                 cl_flags;
     ucc_tl_team_t           *service_team;
     int32_t                  throttle_progress;
+/**
+ *  number of ucc_context_progress passes over non-empty progress queue,
+ *  used by components to share progress of their resources within a pass.
+ *  Not counted with UCC_THREAD_MULTIPLE, where passes run concurrently
+ */
+    uint32_t                 progress_seq;
+    ucc_coll_counters_t      coll_stats;
+/**
+ *  epoll fd aggregating event fds registered by components, created on the
+ *  first registration, -1 if no component supports wakeup
+ */
+    int                      epfd;
+    ucc_list_link_t          event_list;
+/**
+ *  number of posted collectives using an executor, the context can't be
+ *  armed while they are in flight
+ */
+    uint32_t                 n_executor_colls;
+    double                   wait_spin_time;
+    int                      wait_sleep_timeout;
+/**
+ *  asynchronous progress thread, NULL if disabled
+ */
+    ucc_progress_thread_t   *progress_thread;
+/**
+ *  configs of the TLs whose contexts are created on the first
+ *  ucc_tl_context_get, see UCC_LAZY_TLS
+ */
+    ucc_tl_context_config_t **lazy_tl_cfgs;
+    unsigned                 n_lazy_tl_cfgs;
+    uint32_t                 estimated_num_eps;
+    uint32_t                 estimated_num_ppn;
 } ucc_context_t;
 
 typedef struct ucc_context_config {
@@ -92,6 +131,11 @@ typedef struct ucc_context_config {
     uint32_t                  lock_free_progress_q;
     uint32_t                  internal_oob;
     uint32_t                  throttle_progress;
+    double                    wait_spin_time;
+    double                    wait_sleep_timeout;
+    int                       progress_thread;
+    int                       progress_thread_core;
+    ucc_config_names_array_t  lazy_tls;
 } ucc_context_config_t;
 
 /* Internal function for context creation that takes explicit
@@ -102,6 +146,16 @@ ucc_status_t ucc_context_create_proc_info(ucc_lib_h                   lib,
                                           ucc_context_h              *context,
                                           ucc_proc_info_t            *proc_info);
 
+/* Returns 1 if the context of TL "name" is created on first use */
+int ucc_context_tl_is_lazy(ucc_context_t *ctx, const char *name);
+
+/* Creates the context of lazy TL "name", appends it to ctx->tl_ctx */
+ucc_status_t ucc_context_tl_create_lazy(ucc_context_t *ctx, const char *name,
+                                        ucc_tl_context_t **tl_ctx);
+
+/* Destroys lazily created TL context once it is not used anymore */
+void ucc_context_tl_destroy_lazy(ucc_tl_context_t *tl_ctx);
+
 /* Any internal UCC component (TL, CL, etc) may register its own
    progress callback fn (and argument for the callback) into core
    ucc context. Those callbacks will be triggered as part of
@@ -116,6 +170,15 @@ ucc_status_t ucc_context_progress_register(ucc_context_t *ctx,
 ucc_status_t ucc_context_progress_deregister(ucc_context_t *ctx,
                                              ucc_context_progress_fn_t fn,
                                              void *progress_arg);
+
+/* Components able to signal progress through a file descriptor (e.g. UCP
+   worker efd) register it into the context epoll set used by
+   ucc_context_wait. The arm fn is called before going to sleep. */
+ucc_status_t ucc_context_event_fd_register(ucc_context_t *ctx, int fd,
+                                           ucc_context_arm_fn_t arm_fn,
+                                           void *arm_arg);
+
+ucc_status_t ucc_context_event_fd_deregister(ucc_context_t *ctx, int fd);
 /* Performs address exchange between the processes group defined by OOB.
    This function can be used either at context creation time
    (if ctx is global) or at team creation time.
@@ -15,6 +15,23 @@ typedef struct ucc_dt_generic {
     ucc_generic_dt_ops_t     ops;
 } ucc_dt_generic_t;
 
+/* Value-index pairs of UCC_DT_<VALUE>_INT32 datatypes used by
+   UCC_OP_MINLOC and UCC_OP_MAXLOC */
+#define UCC_DT_DECLARE_LOC_PAIR(_name, _vtype)                                 \
+    typedef struct _name {                                                     \
+        _vtype  v;                                                             \
+        int32_t i;                                                             \
+    } _name##_t
+
+UCC_DT_DECLARE_LOC_PAIR(ucc_float32_int32, float);
+UCC_DT_DECLARE_LOC_PAIR(ucc_float64_int32, double);
+UCC_DT_DECLARE_LOC_PAIR(ucc_int64_int32, int64_t);
+UCC_DT_DECLARE_LOC_PAIR(ucc_int32_int32, int32_t);
+
+#define UCC_DT_IS_LOC_PAIR(_dt)                                                \
+    ((_dt) == UCC_DT_FLOAT32_INT32 || (_dt) == UCC_DT_FLOAT64_INT32 ||         \
+     (_dt) == UCC_DT_INT64_INT32 || (_dt) == UCC_DT_INT32_INT32)
+
 #define UCC_DT_PREDEFINED_ID(_dt) ((_dt) >> UCC_DATATYPE_SHIFT)
 
 #define UCC_DT_IS_GENERIC(_dt)                                    \
@@ -32,6 +49,11 @@ typedef struct ucc_dt_generic {
 #define UCC_DT_IS_CONTIG(_dt) (UCC_DT_IS_GENERIC(_dt) && \
                                UCC_DT_GENERIC_IS_CONTIG(ucc_dt_to_generic(_dt)))
 
+/* Generic datatype that is packed and unpacked through its ops */
+#define UCC_DT_IS_NONCONTIG(_dt)                                               \
+    (UCC_DT_IS_GENERIC(_dt) &&                                                 \
+     !UCC_DT_GENERIC_IS_CONTIG(ucc_dt_to_generic(_dt)))
+
 #define UCC_DT_HAS_REDUCE(_dt) (UCC_DT_IS_GENERIC(_dt) && \
                                 UCC_DT_GENERIC_HAS_REDUCE(ucc_dt_to_generic(_dt)))
 
@@ -67,4 +89,26 @@ static inline size_t ucc_dt_size(ucc_datatype_t dt)
     ucc_assert(0);
     return SIZE_MAX;
 }
+
+/* Size of "count" elements at "buffer" in packed form. Generic
+   non-contiguous datatypes are queried through their pack ops. */
+static inline size_t ucc_dt_buffer_size(ucc_datatype_t dt, const void *buffer,
+                                        size_t count)
+{
+    ucc_dt_generic_t *dt_gen;
+    void             *state;
+    size_t            size;
+
+    if (count == 0) {
+        return 0;
+    }
+    if (ucc_likely(UCC_DT_IS_PREDEFINED(dt) || UCC_DT_IS_CONTIG(dt))) {
+        return count * ucc_dt_size(dt);
+    }
+    dt_gen = ucc_dt_to_generic(dt);
+    state  = dt_gen->ops.start_pack(dt_gen->context, buffer, count);
+    size   = dt_gen->ops.packed_size(state);
+    dt_gen->ops.finish(state);
+    return size;
+}
 #endif
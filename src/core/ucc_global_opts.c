@@ -14,6 +14,8 @@ UCC_LIST_HEAD(ucc_config_global_list);
 ucc_global_config_t ucc_global_config = {
     .log_component    = {UCC_LOG_LEVEL_WARN, "UCC"},
     .coll_trace       = {UCC_LOG_LEVEL_WARN, "UCC_COLL"},
+    .coll_stats       = 1,
+    .coll_stats_dump  = 0,
     .component_path   = NULL,
     .install_path     = NULL,
     .initialized      = 0,
@@ -40,6 +42,17 @@ ucc_config_field_t ucc_global_config_table[] = {
      UCC_CONFIG_TYPE_LOG_COMP
     },
 
+    {"COLL_STATS", "y",
+     "Collect per team and per context collective counters: number of "
+     "collectives of each type, selected CL/TL, bytes, post-to-complete time, "
+     "algorithm fallbacks and scratch memory. Counters are available via "
+     "ucc_team_get_attr and ucc_context_get_attr.",
+     ucc_offsetof(ucc_global_config_t, coll_stats), UCC_CONFIG_TYPE_BOOL},
+
+    {"COLL_STATS_DUMP", "n",
+     "Print collective counters of the team to stdout on team destroy",
+     ucc_offsetof(ucc_global_config_t, coll_stats_dump), UCC_CONFIG_TYPE_BOOL},
+
     {"PROFILE_MODE", "",
      "Profile collection modes. If none is specified, profiling is disabled.\n"
      " - log   - Record all timestamps.\n"
@@ -65,4 +78,24 @@ ucc_config_field_t ucc_global_config_table[] = {
      "empty string \"\" - disable use of config file",
      ucc_offsetof(ucc_global_config_t, cfg_filename), UCC_CONFIG_TYPE_STRING},
 
+    {"COMPONENTS_FILTER", "n",
+     "Open only the CL components requested by UCC_CLS and the TL components "
+     "selected by their TLS options (e.g. UCC_CL_BASIC_TLS, UCC_TLS or "
+     "UCC_CL_HIER_NODE_SBGP_TLS) instead of scanning the modules directory "
+     "and opening every component found there. Options are taken from env "
+     "and config file with \"UCC_\" prefix. Reduces filesystem metadata "
+     "load at startup. If any TLS option is \"all\" or a negated list "
+     "(\"^...\") all TLs are opened. Components built into libucc are "
+     "always available",
+     ucc_offsetof(ucc_global_config_t, components_filter),
+     UCC_CONFIG_TYPE_BOOL},
+
+    {"MEMTYPE_CACHE", "y",
+     "Cache memory types of buffers passed with UCC_MEMORY_TYPE_UNKNOWN at "
+     "page granularity, so that non host MC components are not queried on "
+     "every collective init. Cached entries are invalidated on munmap and "
+     "accelerator memory free reported by UCM. The cache is disabled if UCM "
+     "memory events are not available",
+     ucc_offsetof(ucc_global_config_t, memtype_cache), UCC_CONFIG_TYPE_BOOL},
+
     {NULL}};
@@ -18,6 +18,10 @@ typedef struct ucc_global_config {
     ucc_log_component_config_t log_component;
     /* Print collective info for each initialized collective */
     ucc_log_component_config_t coll_trace;
+    /* Collect per team and per context collective counters */
+    int                        coll_stats;
+    /* Print collective counters on team destroy */
+    int                        coll_stats_dump;
     ucc_component_framework_t  cl_framework;
     ucc_component_framework_t  tl_framework;
     ucc_component_framework_t  mc_framework;
@@ -27,6 +31,10 @@ typedef struct ucc_global_config {
     char *component_path;
     char *install_path;
     int   initialized;
+    /* Load only CLs/TLs selected by lib and CL configs */
+    int   components_filter;
+    /* Cache memory types of user buffers passed as UCC_MEMORY_TYPE_UNKNOWN */
+    int   memtype_cache;
     /* Profiling mode */
     uint64_t                   profile_mode;
 
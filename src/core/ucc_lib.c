@@ -434,6 +434,38 @@ err:
     return status;
 }
 
+ucc_status_t ucc_lib_config_cls(const char *full_prefix,
+                                ucc_config_names_array_t *cls)
+{
+    ucc_config_names_array_t requested;
+    ucc_lib_config_t         config;
+    ucc_status_t             status;
+    const char              *name;
+    unsigned                 i;
+
+    status = ucc_config_parser_fill_opts(
+        &config, UCC_CONFIG_GET_TABLE(ucc_lib_config_table), full_prefix, 0);
+    if (status != UCC_OK) {
+        return status;
+    }
+    for (i = 0; i < config.cls.count; i++) {
+        if (config.cls.types[i] == UCC_CL_ALL) {
+            status = UCC_ERR_NOT_FOUND;
+            goto out;
+        }
+        name            = ucc_cl_names[config.cls.types[i]];
+        requested.names = (char **)&name;
+        requested.count = 1;
+        status          = ucc_config_names_array_merge_trim(cls, &requested);
+        if (status != UCC_OK) {
+            goto out;
+        }
+    }
+out:
+    ucc_config_parser_release_opts(&config, ucc_lib_config_table);
+    return status;
+}
+
 void ucc_lib_config_release(ucc_lib_config_t *config)
 {
     ucc_config_parser_release_opts(config, ucc_lib_config_table);
@@ -40,4 +40,10 @@ typedef struct ucc_lib_info {
 
 int ucc_tl_is_required(ucc_lib_info_t *lib, ucc_tl_iface_t *tl_iface,
                        int forced);
+
+/* Returns in "cls" the names of CLs requested by UCC_CLS lib config option
+   read with full_prefix (env and config file). Returns UCC_ERR_NOT_FOUND
+   if "all" is requested. */
+ucc_status_t ucc_lib_config_cls(const char *full_prefix,
+                                ucc_config_names_array_t *cls);
 #endif
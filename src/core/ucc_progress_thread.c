@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_progress_thread.h"
+#include "ucc_context.h"
+#include "utils/ucc_malloc.h"
+#include "utils/ucc_log.h"
+#include "utils/ucc_time.h"
+#include <sched.h>
+#include <time.h>
+#include <string.h>
+
+static void ucc_progress_thread_sleep(ucc_progress_thread_t *pt)
+{
+    ucc_context_t  *ctx = pt->ctx;
+    struct timespec ts;
+    long            nsec;
+
+    pthread_mutex_lock(&pt->lock);
+    pt->sleeping = 1;
+    __sync_synchronize();
+    if (!pt->stop && ucc_progress_queue_is_empty(ctx->pq)) {
+        /* timed wait: registered progress fns (e.g. service workers) still
+           need to be called periodically */
+        clock_gettime(CLOCK_REALTIME, &ts);
+        nsec        = ts.tv_nsec + (long)ctx->wait_sleep_timeout * 1000000L;
+        ts.tv_sec  += nsec / 1000000000L;
+        ts.tv_nsec  = nsec % 1000000000L;
+        pthread_cond_timedwait(&pt->cond, &pt->lock, &ts);
+    }
+    pt->sleeping = 0;
+    pthread_mutex_unlock(&pt->lock);
+}
+
+static void *ucc_progress_thread_func(void *arg)
+{
+    ucc_progress_thread_t *pt         = arg;
+    ucc_context_t         *ctx        = pt->ctx;
+    double                 idle_start = -1;
+    ucc_status_t           status;
+
+    while (!pt->stop) {
+        if (!ucc_progress_queue_is_empty(ctx->pq)) {
+            idle_start = -1;
+        } else if (idle_start < 0) {
+            idle_start = ucc_get_time();
+        } else if (ucc_get_time() - idle_start > ctx->wait_spin_time) {
+            ucc_progress_thread_sleep(pt);
+            idle_start = -1;
+            continue;
+        }
+        status = ucc_context_progress(ctx);
+        if (ucc_unlikely(status < 0)) {
+            /* error is reported to the user through the task status */
+            ucc_debug("progress thread of ctx %p: %s", ctx,
+                      ucc_status_string(status));
+        }
+    }
+    return NULL;
+}
+
+ucc_status_t ucc_progress_thread_start(ucc_context_t *ctx, int core,
+                                       ucc_progress_thread_t **progress_thread)
+{
+    ucc_progress_thread_t *pt;
+    cpu_set_t              cpuset;
+    int                    ret;
+
+    pt = ucc_calloc(1, sizeof(*pt), "progress_thread");
+    if (!pt) {
+        ucc_error("failed to allocate %zd bytes for progress thread",
+                  sizeof(*pt));
+        return UCC_ERR_NO_MEMORY;
+    }
+    pt->ctx  = ctx;
+    pt->core = core;
+    pthread_mutex_init(&pt->lock, NULL);
+    pthread_cond_init(&pt->cond, NULL);
+
+    ret = pthread_create(&pt->thread, NULL, ucc_progress_thread_func, pt);
+    if (ret) {
+        ucc_error("failed to create progress thread: %s", strerror(ret));
+        pthread_cond_destroy(&pt->cond);
+        pthread_mutex_destroy(&pt->lock);
+        ucc_free(pt);
+        return UCC_ERR_NO_RESOURCE;
+    }
+    if (core >= 0) {
+        CPU_ZERO(&cpuset);
+        CPU_SET(core, &cpuset);
+        ret = pthread_setaffinity_np(pt->thread, sizeof(cpuset), &cpuset);
+        if (ret) {
+            ucc_warn("failed to bind progress thread to core %d: %s", core,
+                     strerror(ret));
+        }
+    }
+    ucc_debug("started progress thread for ctx %p, core %d", ctx, core);
+    *progress_thread = pt;
+    return UCC_OK;
+}
+
+void ucc_progress_thread_stop(ucc_progress_thread_t *pt)
+{
+    pthread_mutex_lock(&pt->lock);
+    pt->stop = 1;
+    pthread_cond_signal(&pt->cond);
+    pthread_mutex_unlock(&pt->lock);
+    pthread_join(pt->thread, NULL);
+    pthread_cond_destroy(&pt->cond);
+    pthread_mutex_destroy(&pt->lock);
+    ucc_free(pt);
+}
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_PROGRESS_THREAD_H_
+#define UCC_PROGRESS_THREAD_H_
+
+#include "ucc/api/ucc.h"
+#include <pthread.h>
+
+struct ucc_context;
+
+/* Asynchronous progress thread of ucc context. The thread drives the
+   context progress queue and registered progress fns. When the queue stays
+   empty for the context wait spin time the thread sleeps on the condition
+   variable until a new collective is posted or the sleep timeout expires. */
+typedef struct ucc_progress_thread {
+    pthread_t           thread;
+    pthread_mutex_t     lock;
+    pthread_cond_t      cond;
+    volatile int        stop;
+    volatile int        sleeping;
+    int                 core;
+    struct ucc_context *ctx;
+} ucc_progress_thread_t;
+
+/* Starts the thread, core < 0 means no pinning */
+ucc_status_t ucc_progress_thread_start(struct ucc_context     *ctx, int core,
+                                       ucc_progress_thread_t **pt);
+
+void ucc_progress_thread_stop(ucc_progress_thread_t *pt);
+
+/* Called after a new task is added to the progress queue. The fence pairs
+   with the one in the thread loop (store-load ordering is required, so it
+   is a full barrier): either the thread sees the new task
+   before going to sleep or the poster sees the sleeping flag. */
+static inline void ucc_progress_thread_signal(ucc_progress_thread_t *pt)
+{
+    __sync_synchronize();
+    if (pt->sleeping) {
+        pthread_mutex_lock(&pt->lock);
+        pthread_cond_signal(&pt->cond);
+        pthread_mutex_unlock(&pt->lock);
+    }
+}
+
+#endif
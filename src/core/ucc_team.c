@@ -33,12 +33,62 @@ void ucc_copy_team_params(ucc_team_params_t *dst, const ucc_team_params_t *src)
     UCC_COPY_PARAM_BY_FIELD(dst, src, UCC_TEAM_PARAM_FIELD_MEM_PARAMS,
                             mem_params);
     UCC_COPY_PARAM_BY_FIELD(dst, src, UCC_TEAM_PARAM_FIELD_EP_MAP, ep_map);
+    UCC_COPY_PARAM_BY_FIELD(dst, src, UCC_TEAM_PARAM_FIELD_NEIGHBORS,
+                            neighbors);
+}
+
+/* Neighbor lists provided by the user are copied to a single array owned by
+   the team, team params point to the copy */
+static ucc_status_t ucc_team_neighbors_init(ucc_team_t *team,
+                                            const ucc_team_neighbors_t *nb)
+{
+    ucc_team_neighbors_t *tnb = &team->bp.params.neighbors;
+    uint64_t              n   = nb->n_sources + nb->n_destinations;
+    uint64_t              i;
+
+    for (i = 0; i < nb->n_sources; i++) {
+        if (nb->sources[i] >= team->size) {
+            ucc_error("invalid neighbor source %llu, team size %u",
+                      (unsigned long long)nb->sources[i], team->size);
+            return UCC_ERR_INVALID_PARAM;
+        }
+    }
+    for (i = 0; i < nb->n_destinations; i++) {
+        if (nb->destinations[i] >= team->size) {
+            ucc_error("invalid neighbor destination %llu, team size %u",
+                      (unsigned long long)nb->destinations[i], team->size);
+            return UCC_ERR_INVALID_PARAM;
+        }
+    }
+    team->neighbors = NULL;
+    if (n > 0) {
+        team->neighbors = ucc_malloc(n * sizeof(uint64_t), "team_neighbors");
+        if (!team->neighbors) {
+            ucc_error("failed to allocate %zd bytes for team neighbors",
+                      n * sizeof(uint64_t));
+            return UCC_ERR_NO_MEMORY;
+        }
+        if (nb->n_sources) {
+            memcpy(team->neighbors, nb->sources,
+                   nb->n_sources * sizeof(uint64_t));
+        }
+        if (nb->n_destinations) {
+            memcpy(team->neighbors + nb->n_sources, nb->destinations,
+                   nb->n_destinations * sizeof(uint64_t));
+        }
+    }
+    tnb->n_sources      = nb->n_sources;
+    tnb->sources        = team->neighbors;
+    tnb->n_destinations = nb->n_destinations;
+    tnb->destinations   = team->neighbors + nb->n_sources;
+    return UCC_OK;
 }
 
 ucc_status_t ucc_team_get_attr(ucc_team_h team, ucc_team_attr_t *team_attr)
 {
-    uint64_t supported_fields =
-        UCC_TEAM_ATTR_FIELD_SIZE | UCC_TEAM_ATTR_FIELD_EP;
+    uint64_t supported_fields = UCC_TEAM_ATTR_FIELD_SIZE |
+                                UCC_TEAM_ATTR_FIELD_EP |
+                                UCC_TEAM_ATTR_FIELD_COLL_STATS;
 
     if (team_attr->mask & ~supported_fields) {
         ucc_error("ucc_team_get_attr() is not implemented for specified field");
@@ -53,6 +103,14 @@ ucc_status_t ucc_team_get_attr(ucc_team_h team, ucc_team_attr_t *team_attr)
         team_attr->ep = team->rank;
     }
 
+    if (team_attr->mask & UCC_TEAM_ATTR_FIELD_COLL_STATS) {
+        if (!team_attr->coll_stats) {
+            ucc_error("coll_stats storage is not provided");
+            return UCC_ERR_INVALID_PARAM;
+        }
+        ucc_coll_stats_get(&team->coll_stats, team_attr->coll_stats);
+    }
+
     return UCC_OK;
 }
 
@@ -198,6 +256,12 @@ ucc_status_t ucc_team_create_post(ucc_context_h *contexts, uint32_t num_contexts
 
     memcpy(team->contexts, contexts, sizeof(ucc_context_t *) * num_contexts);
     ucc_copy_team_params(&team->bp.params, params);
+    if (params->mask & UCC_TEAM_PARAM_FIELD_NEIGHBORS) {
+        status = ucc_team_neighbors_init(team, &params->neighbors);
+        if (status != UCC_OK) {
+            goto err_neighbors;
+        }
+    }
     /* check if user provides team id and if it is not too large */
     if ((params->mask & UCC_TEAM_PARAM_FIELD_ID) &&
         (params->id <= UCC_TEAM_ID_MAX)) {
@@ -207,6 +271,8 @@ ucc_status_t ucc_team_create_post(ucc_context_h *contexts, uint32_t num_contexts
     *new_team = team;
     return status;
 
+err_neighbors:
+    ucc_free(team->contexts);
 err_ctx_alloc:
     *new_team = NULL;
     ucc_free(team);
@@ -528,12 +594,22 @@ static ucc_status_t ucc_team_destroy_single(ucc_team_h team)
         ucc_info("team destroyed, team_id %d", team->id);
     }
 
+    if (ucc_global_config.coll_stats && ucc_global_config.coll_stats_dump) {
+        char title[64];
+
+        ucc_snprintf_safe(title, sizeof(title),
+                          "UCC coll stats: team_id %d, rank %u, size %u",
+                          team->id, team->rank, team->size);
+        ucc_coll_stats_print(&team->coll_stats.stats, stdout, title);
+    }
+
     ucc_coll_score_free_map(team->score_map);
     ucc_free(team->addr_storage.storage);
     ucc_free(team->ctx_ranks);
     ucc_team_release_id(team);
     ucc_free(team->cl_teams);
     ucc_free(team->contexts);
+    ucc_free(team->neighbors);
     ucc_free(team);
     return UCC_OK;
 }
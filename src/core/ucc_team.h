@@ -16,6 +16,7 @@
 #include "components/cl/ucc_cl.h"
 #include "components/tl/ucc_tl.h"
 #include "coll_score/ucc_coll_score.h"
+#include "ucc_coll_stats.h"
 
 typedef struct ucc_service_coll_req ucc_service_coll_req_t;
 typedef enum {
@@ -48,6 +49,8 @@ typedef struct ucc_team {
     ucc_topo_t             *topo;
     ucc_score_map_t        *score_map; /*< score map of CLs */
     uint32_t                seq_num;
+    ucc_coll_counters_t     coll_stats;
+    uint64_t               *neighbors; /*< storage of the neighbor graph */
 } ucc_team_t;
 
 /* If the bit is set then team_id is provided by the user */
@@ -113,6 +113,7 @@ ucc_status_t ucc_coll_task_init(ucc_coll_task_t *task,
     task->bargs.args.mask      = 0;
     task->schedule             = NULL;
     task->executor             = NULL;
+    task->alg_id               = -1;
     task->super.status         = UCC_OPERATION_INITIALIZED;
     task->triggered_post_setup = NULL;
     task->triggered_post       = ucc_triggered_post;
@@ -125,6 +126,9 @@ ucc_status_t ucc_coll_task_init(ucc_coll_task_t *task,
 
     if (bargs) {
         memcpy(&task->bargs, bargs, sizeof(*bargs));
+        if (UCC_COLL_ARGS_TIMEOUT(bargs->args)) {
+            task->flags |= UCC_COLL_TASK_FLAG_TIMEOUT;
+        }
     }
     ucc_lf_queue_init_elem(&task->lf_elem);
     return ucc_event_manager_init(task);
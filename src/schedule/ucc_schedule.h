@@ -15,6 +15,7 @@
 #include "components/base/ucc_base_iface.h"
 #include "components/ec/ucc_ec.h"
 #include "components/mc/ucc_mc.h"
+#include "core/ucc_coll_stats.h"
 
 #define MAX_LISTENERS 4
 
@@ -75,10 +76,16 @@ enum {
     UCC_COLL_TASK_FLAG_IS_SCHEDULE           = UCC_BIT(5),
     /* if set task can be casted to scheulde */
     UCC_COLL_TASK_FLAG_IS_PIPELINED_SCHEDULE = UCC_BIT(6),
-
+    /* copy of UCC_COLL_ARGS_FLAG_TIMEOUT, lets progress queue check timeout
+       without touching bargs */
+    UCC_COLL_TASK_FLAG_TIMEOUT               = UCC_BIT(7),
+    /* task is counted in context n_executor_colls */
+    UCC_COLL_TASK_FLAG_EXECUTOR_COUNTED      = UCC_BIT(8),
 };
 
 typedef struct ucc_coll_task {
+    /* Hot part: fields read by progress queue and task completion on every
+       progress call, keep them within the first cache line */
     ucc_coll_req_t                     super;
     /**
      *  Task internal status, TLs and CLs should use it to track collective
@@ -86,33 +93,42 @@ typedef struct ucc_coll_task {
      *  by core level to avoid potential races
      */
     ucc_status_t                       status;
-    ucc_list_link_t                    em_list;
-    ucc_base_coll_args_t               bargs;
-    ucc_base_team_t                   *team; /* CL/TL team pointer */
-    ucc_schedule_t                    *schedule;
-    uint32_t                           flags;
-    ucc_coll_post_fn_t                 post;
-    ucc_coll_triggered_post_setup_fn_t triggered_post_setup;
-    ucc_coll_triggered_post_fn_t       triggered_post;
-    ucc_coll_progress_fn_t             progress;
-    ucc_coll_finalize_fn_t             finalize;
-    ucc_coll_callback_t                cb;
-    ucc_ee_h                           ee;
-    ucc_ev_t                          *ev;
-    ucc_coll_task_t                   *triggered_task;
-    ucc_ee_executor_t                 *executor;
     union {
         /* used for st & locked mt progress queue */
         ucc_list_link_t                list_elem;
         /* used for lf mt progress queue */
         ucc_lf_queue_elem_t            lf_elem;
     };
-    uint32_t                           n_deps;
+    ucc_coll_progress_fn_t             progress;
+    uint32_t                           flags;
     uint32_t                           n_deps_satisfied;
-    uint32_t                           n_deps_base;
+    ucc_schedule_t                    *schedule;
     /* timestamp of the start time: either post or triggered_post */
     double                             start_time;
+    /* Warm part: completion, dependencies and event handling */
+    ucc_coll_callback_t                cb;
+    ucc_base_team_t                   *team; /* CL/TL team pointer */
+    uint32_t                           n_deps;
+    uint32_t                           n_deps_base;
+    ucc_list_link_t                    em_list;
+    ucc_coll_post_fn_t                 post;
+    ucc_coll_finalize_fn_t             finalize;
+    ucc_ee_executor_t                 *executor;
+    /* Cold part: triggered post and stats, used once per collective */
+    ucc_coll_triggered_post_setup_fn_t triggered_post_setup;
+    ucc_coll_triggered_post_fn_t       triggered_post;
+    ucc_ee_h                           ee;
+    ucc_ev_t                          *ev;
+    ucc_coll_task_t                   *triggered_task;
     uint32_t                           seq_num;
+    /* algorithm id of the score map entry that created the task, -1 if
+       not known, used for coll stats */
+    int                                alg_id;
+    /* local message size of top-level task, used for coll stats */
+    size_t                             bytes;
+    /* full copy of coll args, accessed by algorithms at init/post time.
+       Keep it last so that it does not split the hot fields */
+    ucc_base_coll_args_t               bargs;
 } ucc_coll_task_t;
 
 extern struct ucc_mpool_ops ucc_coll_task_mpool_ops;
@@ -166,6 +182,8 @@ ucc_status_t ucc_dependency_handler(ucc_coll_task_t *parent,
 ucc_status_t ucc_triggered_post(ucc_ee_h ee, ucc_ev_t *ev,
                                 ucc_coll_task_t *task);
 
+void ucc_collective_executor_done(ucc_coll_task_t *task);
+
 static inline ucc_status_t ucc_task_complete(ucc_coll_task_t *task)
 {
     ucc_status_t        status    = task->status;
@@ -228,6 +246,15 @@ static inline ucc_status_t ucc_task_complete(ucc_coll_task_t *task)
         task->executor = NULL;
     }
 
+    if ((task->flags & UCC_COLL_TASK_FLAG_TOP_LEVEL) &&
+        ucc_global_config.coll_stats) {
+        ucc_coll_stats_task_complete(task);
+    }
+
+    if (task->flags & UCC_COLL_TASK_FLAG_EXECUTOR_COUNTED) {
+        ucc_collective_executor_done(task);
+    }
+
     task->super.status = status;
     if (has_cb) {
         cb.cb(cb.data, status);
@@ -161,6 +161,20 @@ typedef enum {
     UCC_COLL_TYPE_REDUCE_SCATTERV    = UCC_BIT(13),
     UCC_COLL_TYPE_SCATTER            = UCC_BIT(14),
     UCC_COLL_TYPE_SCATTERV           = UCC_BIT(15),
+    /* Inclusive prefix reduction: dst on rank r holds the reduction of src
+       of ranks 0..r. Buffers are described by src.info and dst.info as for
+       allreduce, UCC_COLL_ARGS_FLAG_IN_PLACE is supported */
+    UCC_COLL_TYPE_SCAN               = UCC_BIT(16),
+    /* Exclusive prefix reduction: dst on rank r holds the reduction of src
+       of ranks 0..r-1, dst of rank 0 is not modified */
+    UCC_COLL_TYPE_EXSCAN             = UCC_BIT(17),
+    /* Neighborhood collectives over the graph attached to the team with
+       @ref UCC_TEAM_PARAM_FIELD_NEIGHBORS. Alltoallv: src.info_v has one
+       count/displacement per destination, dst.info_v one per source.
+       Allgather: src.info is sent to every destination, dst.info holds
+       n_sources blocks in the order of sources. In-place is not supported */
+    UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV = UCC_BIT(18),
+    UCC_COLL_TYPE_NEIGHBOR_ALLGATHER = UCC_BIT(19),
     UCC_COLL_TYPE_LAST
 } ucc_coll_type_t;
 
@@ -218,7 +232,14 @@ typedef uint64_t ucc_datatype_t;
 #define UCC_DT_FLOAT32_COMPLEX  UCC_PREDEFINED_DT(15)
 #define UCC_DT_FLOAT64_COMPLEX  UCC_PREDEFINED_DT(16)
 #define UCC_DT_FLOAT128_COMPLEX UCC_PREDEFINED_DT(17)
-#define UCC_DT_PREDEFINED_LAST  18
+/* Value-index pairs for @ref UCC_OP_MINLOC and @ref UCC_OP_MAXLOC. Layout of
+   an element is the C struct of the value followed by int32_t index,
+   i.e. struct {double v; int32_t i;} for UCC_DT_FLOAT64_INT32. */
+#define UCC_DT_FLOAT32_INT32    UCC_PREDEFINED_DT(18)
+#define UCC_DT_FLOAT64_INT32    UCC_PREDEFINED_DT(19)
+#define UCC_DT_INT64_INT32      UCC_PREDEFINED_DT(20)
+#define UCC_DT_INT32_INT32      UCC_PREDEFINED_DT(21)
+#define UCC_DT_PREDEFINED_LAST  22
 
 /**
  * @ingroup UCC_DATATYPE
@@ -868,9 +889,140 @@ enum ucc_context_attr_field {
     UCC_CONTEXT_ATTR_FIELD_SYNC_TYPE          = UCC_BIT(1),
     UCC_CONTEXT_ATTR_FIELD_CTX_ADDR           = UCC_BIT(2),
     UCC_CONTEXT_ATTR_FIELD_CTX_ADDR_LEN       = UCC_BIT(3),
-    UCC_CONTEXT_ATTR_FIELD_WORK_BUFFER_SIZE   = UCC_BIT(4)
+    UCC_CONTEXT_ATTR_FIELD_WORK_BUFFER_SIZE   = UCC_BIT(4),
+    UCC_CONTEXT_ATTR_FIELD_COLL_STATS         = UCC_BIT(5),
+    UCC_CONTEXT_ATTR_FIELD_EVENT_FD           = UCC_BIT(6)
 };
 
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Max number of collective types tracked by @ref ucc_coll_stats_t.
+ *  Counters of collective type @b ct are stored at index log2(ct).
+ */
+#define UCC_COLL_STATS_MAX_COLL_TYPES  32
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Max number of CL/TL components tracked by @ref ucc_coll_stats_t
+ */
+#define UCC_COLL_STATS_MAX_COMPONENTS  8
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Max length of component name in @ref ucc_coll_component_stats_t
+ */
+#define UCC_COLL_STATS_NAME_MAX        16
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Max number of algorithms tracked by @ref ucc_coll_stats_t
+ */
+#define UCC_COLL_STATS_MAX_ALGS        32
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Max length of algorithm name in @ref ucc_coll_alg_stats_t
+ */
+#define UCC_COLL_STATS_ALG_NAME_MAX    32
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Counters of a single collective type
+ */
+typedef struct ucc_coll_type_stats {
+    uint64_t n_init;     /*!< Number of initialized collectives */
+    uint64_t n_complete; /*!< Number of completed collectives, persistent
+                              collectives are counted on every completion */
+    uint64_t n_errors;   /*!< Number of collectives completed with error */
+    uint64_t bytes;      /*!< Total local message size of completed
+                              collectives, in bytes */
+    double   time;       /*!< Total post-to-complete time of completed
+                              collectives, in seconds */
+} ucc_coll_type_stats_t;
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Number of collectives served by a CL/TL component
+ *
+ *  @parblock
+ *
+ *  Description
+ *
+ *  The component is the one selected by the score map of the team: either a
+ *  hierarchical CL or, if the collective is dispatched directly by CL/BASIC,
+ *  the TL implementing it.
+ *
+ *  @endparblock
+ */
+typedef struct ucc_coll_component_stats {
+    char     name[UCC_COLL_STATS_NAME_MAX];
+    uint64_t n_colls[UCC_COLL_STATS_MAX_COLL_TYPES];
+} ucc_coll_component_stats_t;
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Number of collectives served by an algorithm of a CL/TL component
+ *
+ *  @parblock
+ *
+ *  Description
+ *
+ *  The algorithm is the one chosen by the selected score map entry at
+ *  collective init. Collectives whose algorithm is selected inside the
+ *  component init, w/o explicit algorithm id in the score map, are
+ *  accounted with id -1 and empty name.
+ *
+ *  @endparblock
+ */
+typedef struct ucc_coll_alg_stats {
+    char            component[UCC_COLL_STATS_NAME_MAX];
+    char            name[UCC_COLL_STATS_ALG_NAME_MAX];
+    int             id;
+    ucc_coll_type_t coll_type;
+    uint64_t        n_colls;
+} ucc_coll_alg_stats_t;
+
+/**
+ *  @ingroup UCC_CONTEXT_DT
+ *
+ *  @brief Collective counters of a team or a context
+ *
+ *  @parblock
+ *
+ *  Description
+ *
+ *  @ref ucc_coll_stats_t is filled by @ref ucc_team_get_attr and
+ *  @ref ucc_context_get_attr when UCC_TEAM_ATTR_FIELD_COLL_STATS or
+ *  UCC_CONTEXT_ATTR_FIELD_COLL_STATS is set. Context counters aggregate
+ *  counters of all the teams created on the context. Counters are collected
+ *  unless disabled with UCC_COLL_STATS=n. With UCC_THREAD_MULTIPLE counters
+ *  are updated without synchronization and should be treated as estimates.
+ *
+ *  @endparblock
+ */
+typedef struct ucc_coll_stats {
+    ucc_coll_type_stats_t      colls[UCC_COLL_STATS_MAX_COLL_TYPES];
+    ucc_coll_component_stats_t components[UCC_COLL_STATS_MAX_COMPONENTS];
+    uint32_t                   n_components;
+    uint64_t                   n_fallbacks;   /*!< Number of times the selected
+                                                   algorithm did not support
+                                                   the collective and the next
+                                                   one was tried */
+    uint64_t                   scratch_bytes; /*!< Total size of scratch
+                                                   buffers allocated by
+                                                   collectives, in bytes */
+    ucc_coll_alg_stats_t       algs[UCC_COLL_STATS_MAX_ALGS];
+    uint32_t                   n_algs;
+} ucc_coll_stats_t;
+
 /**
  * @ingroup UCC_CONTEXT_DT
  *
@@ -972,6 +1124,12 @@ typedef struct ucc_context_attr {
     ucc_context_addr_h      ctx_addr;
     ucc_context_addr_len_t  ctx_addr_len;
     uint64_t                global_work_buffer_size;
+    ucc_coll_stats_t       *coll_stats; /*!< User allocated storage the
+                                             counters are copied to */
+    int                     event_fd;   /*!< File descriptor that becomes
+                                             readable when the context needs
+                                             progress, see
+                                             @ref ucc_context_arm */
 } ucc_context_attr_t;
 
 /**
@@ -1138,6 +1296,63 @@ ucc_status_t ucc_context_create(ucc_lib_h lib_handle,
 
 ucc_status_t ucc_context_progress(ucc_context_h context);
 
+/**
+ *  @ingroup UCC_CONTEXT
+ *
+ *  @brief The @ref ucc_context_arm routine prepares the context event fd to
+ *  signal the next communication event.
+ *
+ *  @param [in]  context  Communication context handle
+ *
+ *  @parblock
+ *
+ *  @b Description
+ *
+ *  The event fd of the context is obtained with @ref ucc_context_get_attr
+ *  using UCC_CONTEXT_ATTR_FIELD_EVENT_FD. Before waiting on the fd the user
+ *  must arm the context. If UCC_INPROGRESS is returned there are pending
+ *  events, or posted collectives whose completion is not signaled through
+ *  the fd, and the context must be progressed with
+ *  @ref ucc_context_progress instead of waiting. The fd is only a hint:
+ *  components that don't support wakeup may still require progress, so the
+ *  wait should be bounded.
+ *
+ *  @endparblock
+ *
+ *  @return UCC_OK if armed, UCC_INPROGRESS if progress is required,
+ *          UCC_ERR_NOT_SUPPORTED if the context has no event fd
+ */
+
+ucc_status_t ucc_context_arm(ucc_context_h context);
+
+/**
+ *  @ingroup UCC_CONTEXT
+ *
+ *  @brief The @ref ucc_context_wait routine blocks until the collective
+ *  operation completes.
+ *
+ *  @param [in]  context  Communication context handle the request was
+ *                        created on
+ *  @param [in]  request  Request handle of the posted collective operation
+ *
+ *  @parblock
+ *
+ *  @b Description
+ *
+ *  The @ref ucc_context_wait routine progresses the context until the
+ *  request completes. After busy polling for UCC_WAIT_SPIN_TIME the routine
+ *  arms the context and sleeps on its event fd for at most
+ *  UCC_WAIT_SLEEP_TIMEOUT, releasing the CPU while waiting for the
+ *  communication. If the context has no event fd the routine busy polls.
+ *
+ *  @endparblock
+ *
+ *  @return Status of the completed collective or error code as defined by
+ *          @ref ucc_status_t
+ */
+
+ucc_status_t ucc_context_wait(ucc_context_h context, ucc_coll_req_h request);
+
 /**
  *  @ingroup UCC_CONTEXT
  *
@@ -1207,7 +1422,8 @@ enum ucc_team_params_field {
     UCC_TEAM_PARAM_FIELD_MEM_PARAMS             = UCC_BIT(9),
     UCC_TEAM_PARAM_FIELD_EP_MAP                 = UCC_BIT(10),
     UCC_TEAM_PARAM_FIELD_ID                     = UCC_BIT(11),
-    UCC_TEAM_PARAM_FIELD_FLAGS                  = UCC_BIT(12)
+    UCC_TEAM_PARAM_FIELD_FLAGS                  = UCC_BIT(12),
+    UCC_TEAM_PARAM_FIELD_NEIGHBORS              = UCC_BIT(13)
 };
 
 /**
@@ -1222,7 +1438,8 @@ enum ucc_team_attr_field {
     UCC_TEAM_ATTR_FIELD_SYNC_TYPE              = UCC_BIT(4),
     UCC_TEAM_ATTR_FIELD_MEM_PARAMS             = UCC_BIT(5),
     UCC_TEAM_ATTR_FIELD_SIZE                   = UCC_BIT(6),
-    UCC_TEAM_ATTR_FIELD_EPS                    = UCC_BIT(7)
+    UCC_TEAM_ATTR_FIELD_EPS                    = UCC_BIT(7),
+    UCC_TEAM_ATTR_FIELD_COLL_STATS             = UCC_BIT(8)
 };
 
 /**
@@ -1356,6 +1573,31 @@ typedef struct ucc_ep_map_t {
     };
 } ucc_ep_map_t;
 
+/**
+ *
+ *  @ingroup UCC_TEAM_DT
+ *
+ *  @brief Structure representing the neighbor graph of a team participant
+ *
+ *  @parblock
+ *
+ *  Description
+ *
+ *  @ref ucc_team_neighbors_t lists the team ranks the process receives data
+ *  from and sends data to in neighborhood collectives. The graph must be
+ *  consistent across the team: rank "a" has "b" in destinations as many times
+ *  as "b" has "a" in sources. Order of the lists defines the order of blocks
+ *  in the collective buffers.
+ *
+ *  @endparblock
+ */
+typedef struct ucc_team_neighbors {
+    uint64_t  n_sources;
+    uint64_t *sources;
+    uint64_t  n_destinations;
+    uint64_t *destinations;
+} ucc_team_neighbors_t;
+
 /**
  *
  *  @ingroup UCC_TEAM_DT
@@ -1481,6 +1723,13 @@ typedef struct ucc_team_params {
       * programming model, this can be inherited from the MPI communicator id.
       */
     uint64_t                id;
+
+    /** @ref ucc_team_params.neighbors
+      * Static neighbor graph of the calling process used by neighborhood
+      * collectives, see @ref ucc_team_neighbors_t. The library keeps its own
+      * copy of the graph.
+      */
+    ucc_team_neighbors_t    neighbors;
 } ucc_team_params_t;
 
 /**
@@ -1512,6 +1761,8 @@ typedef struct ucc_team_attr {
     ucc_mem_map_params_t   mem_params;
     uint32_t               size;
     uint64_t              *eps;
+    ucc_coll_stats_t      *coll_stats; /*!< User allocated storage the
+                                            counters are copied to */
 } ucc_team_attr_t;
 
 
@@ -1710,12 +1961,23 @@ typedef enum {
                                                             Note, the status is not guaranteed
                                                             to be global on all the processes
                                                             participating in the collective.*/
-    UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS   = UCC_BIT(7)  /*!< If set, both src
+    UCC_COLL_ARGS_FLAG_MEM_MAPPED_BUFFERS   = UCC_BIT(7), /*!< If set, both src
                                                             and dst buffers
                                                             reside in a memory
                                                             mapped region.
                                                             Useful for one-sided
                                                             collectives. */
+    UCC_COLL_ARGS_FLAG_REDUCED_PRECISION    = UCC_BIT(8)  /*!< If set, float32
+                                                            data of reduction
+                                                            collectives may be
+                                                            transferred in a 16
+                                                            bit floating point
+                                                            format. Local
+                                                            accumulation stays
+                                                            float32, the result
+                                                            may lose precision.
+                                                            Ignored if not
+                                                            supported. */
 } ucc_coll_args_flags_t;
 
 /**
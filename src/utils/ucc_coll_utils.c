@@ -36,6 +36,10 @@ ucc_coll_type_t ucc_coll_type_from_str(const char *str)
     STR_COLL_TYPE_CHECK(str, REDUCE_SCATTERV);
     STR_COLL_TYPE_CHECK(str, SCATTER);
     STR_COLL_TYPE_CHECK(str, SCATTERV);
+    STR_COLL_TYPE_CHECK(str, SCAN);
+    STR_COLL_TYPE_CHECK(str, EXSCAN);
+    STR_COLL_TYPE_CHECK(str, NEIGHBOR_ALLTOALLV);
+    STR_COLL_TYPE_CHECK(str, NEIGHBOR_ALLGATHER);
     return UCC_COLL_TYPE_LAST;
 }
 
@@ -71,11 +75,15 @@ ucc_coll_args_is_mem_symmetric(const ucc_coll_args_t *args,
     case UCC_COLL_TYPE_ALLREDUCE:
     case UCC_COLL_TYPE_ALLGATHER:
     case UCC_COLL_TYPE_REDUCE_SCATTER:
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
         return args->dst.info.mem_type == args->src.info.mem_type;
     case UCC_COLL_TYPE_ALLGATHERV:
     case UCC_COLL_TYPE_REDUCE_SCATTERV:
         return args->dst.info_v.mem_type == args->src.info.mem_type;
     case UCC_COLL_TYPE_ALLTOALLV:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
         return args->dst.info_v.mem_type == args->src.info_v.mem_type;
     case UCC_COLL_TYPE_REDUCE:
     case UCC_COLL_TYPE_GATHER:
@@ -104,6 +112,7 @@ ucc_coll_args_init_asymmetric_buffer(ucc_coll_args_t *args,
                                      ucc_buffer_info_asymmetric_memtype_t *save_info)
 {
     ucc_status_t status = UCC_OK;
+    size_t       size;
 
     if (UCC_IS_INPLACE(*args)) {
         return UCC_ERR_INVALID_PARAM;
@@ -118,15 +127,14 @@ ucc_coll_args_init_asymmetric_buffer(ucc_coll_args_t *args,
         }
         memcpy(&save_info->old_asymmetric_buffer.info,
                &args->dst.info, sizeof(ucc_coll_buffer_info_t));
-        status = ucc_mc_alloc(&save_info->scratch,
-                              ucc_dt_size(args->dst.info.datatype) *
-                                          args->dst.info.count,
-                                          mem_type);
+        size   = ucc_dt_size(args->dst.info.datatype) * args->dst.info.count;
+        status = ucc_mc_alloc(&save_info->scratch, size, mem_type);
         if (ucc_unlikely(UCC_OK != status)) {
             ucc_error("failed to allocate replacement "
                       "memory for asymmetric buffer");
             return status;
         }
+        ucc_coll_stats_add_scratch(team, size);
         args->dst.info.buffer = save_info->scratch->addr;
         args->dst.info.mem_type = mem_type;
         return UCC_OK;
@@ -135,17 +143,17 @@ ucc_coll_args_init_asymmetric_buffer(ucc_coll_args_t *args,
     {
         memcpy(&save_info->old_asymmetric_buffer.info_v,
                &args->dst.info_v, sizeof(ucc_coll_buffer_info_v_t));
-        status = ucc_mc_alloc(&save_info->scratch,
-                                ucc_coll_args_get_v_buffer_size(args,
-                                args->dst.info_v.counts,
-                                args->dst.info_v.displacements,
-                                team->size),
-                                args->src.info.mem_type);
+        size   = ucc_coll_args_get_v_buffer_size(args, args->dst.info_v.counts,
+                                                 args->dst.info_v.displacements,
+                                                 team->size);
+        status = ucc_mc_alloc(&save_info->scratch, size,
+                              args->src.info.mem_type);
         if (ucc_unlikely(UCC_OK != status)) {
             ucc_error("failed to allocate replacement "
                       "memory for asymmetric buffer");
             return status;
         }
+        ucc_coll_stats_add_scratch(team, size);
         args->dst.info_v.buffer   = save_info->scratch->addr;
         args->dst.info_v.mem_type = args->src.info.mem_type;
         return UCC_OK;
@@ -155,14 +163,14 @@ ucc_coll_args_init_asymmetric_buffer(ucc_coll_args_t *args,
         ucc_memory_type_t mem_type = args->dst.info.mem_type;
         memcpy(&save_info->old_asymmetric_buffer.info,
                &args->src.info, sizeof(ucc_coll_buffer_info_t));
-        status = ucc_mc_alloc(&save_info->scratch,
-                              ucc_dt_size(args->src.info.datatype) * args->src.info.count,
-                              mem_type);
+        size   = ucc_dt_size(args->src.info.datatype) * args->src.info.count;
+        status = ucc_mc_alloc(&save_info->scratch, size, mem_type);
         if (ucc_unlikely(UCC_OK != status)) {
             ucc_error("failed to allocate replacement "
                       "memory for asymmetric buffer");
             return status;
         }
+        ucc_coll_stats_add_scratch(team, size);
         args->src.info.buffer   = save_info->scratch->addr;
         args->src.info.mem_type = mem_type;
         return UCC_OK;
@@ -172,17 +180,16 @@ ucc_coll_args_init_asymmetric_buffer(ucc_coll_args_t *args,
         ucc_memory_type_t mem_type = args->dst.info.mem_type;
         memcpy(&save_info->old_asymmetric_buffer.info_v,
                &args->src.info_v, sizeof(ucc_coll_buffer_info_v_t));
-        status = ucc_mc_alloc(&save_info->scratch,
-                              ucc_coll_args_get_v_buffer_size(args,
-                                args->src.info_v.counts,
-                                args->src.info_v.displacements,
-                                team->size),
-                              mem_type);
+        size   = ucc_coll_args_get_v_buffer_size(args, args->src.info_v.counts,
+                                                 args->src.info_v.displacements,
+                                                 team->size);
+        status = ucc_mc_alloc(&save_info->scratch, size, mem_type);
         if (ucc_unlikely(UCC_OK != status)) {
             ucc_error("failed to allocate replacement "
                       "memory for asymmetric buffer");
             return status;
         }
+        ucc_coll_stats_add_scratch(team, size);
         args->src.info_v.buffer   = save_info->scratch->addr;
         args->src.info_v.mem_type = mem_type;
         return UCC_OK;
@@ -279,6 +286,9 @@ int ucc_coll_args_is_predefined_dt(const ucc_coll_args_t *args, ucc_rank_t rank)
     case UCC_COLL_TYPE_REDUCE_SCATTER:
     case UCC_COLL_TYPE_ALLGATHER:
     case UCC_COLL_TYPE_ALLTOALL:
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
         return UCC_DT_IS_PREDEFINED(args->dst.info.datatype) &&
                (UCC_IS_INPLACE(*args) ||
                 UCC_DT_IS_PREDEFINED(args->src.info.datatype));
@@ -288,6 +298,7 @@ int ucc_coll_args_is_predefined_dt(const ucc_coll_args_t *args, ucc_rank_t rank)
                (UCC_IS_INPLACE(*args) ||
                 UCC_DT_IS_PREDEFINED(args->src.info.datatype));
     case UCC_COLL_TYPE_ALLTOALLV:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
         return UCC_DT_IS_PREDEFINED(args->dst.info_v.datatype) &&
                (UCC_IS_INPLACE(*args) ||
                 UCC_DT_IS_PREDEFINED(args->src.info_v.datatype));
@@ -348,10 +359,14 @@ ucc_memory_type_t ucc_coll_args_mem_type(const ucc_coll_args_t *args,
     case UCC_COLL_TYPE_ALLREDUCE:
     case UCC_COLL_TYPE_ALLGATHER:
     case UCC_COLL_TYPE_REDUCE_SCATTER:
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
         return args->dst.info.mem_type;
     case UCC_COLL_TYPE_ALLGATHERV:
     case UCC_COLL_TYPE_REDUCE_SCATTERV:
     case UCC_COLL_TYPE_ALLTOALLV:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
         return args->dst.info_v.mem_type;
     case UCC_COLL_TYPE_REDUCE:
     case UCC_COLL_TYPE_GATHER:
@@ -372,6 +387,9 @@ ucc_memory_type_t ucc_coll_args_mem_type(const ucc_coll_args_t *args,
     return UCC_MEMORY_TYPE_UNKNOWN;
 }
 
+#define UCC_BUFFER_INFO_SIZE(_info)                                            \
+    ucc_dt_buffer_size((_info).datatype, (_info).buffer, (_info).count)
+
 size_t ucc_coll_args_msgsize(const ucc_coll_args_t *args, ucc_rank_t rank,
                              ucc_rank_t size)
 {
@@ -383,20 +401,25 @@ size_t ucc_coll_args_msgsize(const ucc_coll_args_t *args, ucc_rank_t rank,
     case UCC_COLL_TYPE_FANOUT:
         return 0;
     case UCC_COLL_TYPE_BCAST:
-        return args->src.info.count * ucc_dt_size(args->src.info.datatype);
+        return UCC_BUFFER_INFO_SIZE(args->src.info);
     case UCC_COLL_TYPE_ALLREDUCE:
     case UCC_COLL_TYPE_ALLTOALL:
     case UCC_COLL_TYPE_ALLGATHER:
     case UCC_COLL_TYPE_REDUCE_SCATTER:
-        return args->dst.info.count * ucc_dt_size(args->dst.info.datatype);
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
+        return UCC_BUFFER_INFO_SIZE(args->dst.info);
     case UCC_COLL_TYPE_ALLGATHERV:
     case UCC_COLL_TYPE_REDUCE_SCATTERV:
-        return ucc_coll_args_get_total_count(args, args->dst.info_v.counts,
-                                             size) *
-               ucc_dt_size(args->dst.info_v.datatype);
+        return ucc_dt_buffer_size(args->dst.info_v.datatype,
+                                  args->dst.info_v.buffer,
+                                  ucc_coll_args_get_total_count(
+                                      args, args->dst.info_v.counts, size));
     case UCC_COLL_TYPE_ALLTOALLV:
     case UCC_COLL_TYPE_GATHERV:
     case UCC_COLL_TYPE_SCATTERV:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
         /* This means all team members can not know the msg size estimate w/o communication.
            Local args information is not enough.
            This prohibits algorithm selection based on msg size thresholds w/o additinoal exchange.
@@ -404,19 +427,16 @@ size_t ucc_coll_args_msgsize(const ucc_coll_args_t *args, ucc_rank_t rank,
         return UCC_MSG_SIZE_ASYMMETRIC;
     case UCC_COLL_TYPE_REDUCE:
         return (root == rank)
-                   ? args->dst.info.count * ucc_dt_size(args->dst.info.datatype)
-                   : args->src.info.count *
-                         ucc_dt_size(args->src.info.datatype);
+                   ? UCC_BUFFER_INFO_SIZE(args->dst.info)
+                   : UCC_BUFFER_INFO_SIZE(args->src.info);
     case UCC_COLL_TYPE_GATHER:
         return (root == rank)
-                 ? args->dst.info.count * ucc_dt_size(args->dst.info.datatype)
-                 : args->src.info.count * ucc_dt_size(args->src.info.datatype) *
-                   size;
+                 ? UCC_BUFFER_INFO_SIZE(args->dst.info)
+                 : UCC_BUFFER_INFO_SIZE(args->src.info) * size;
     case UCC_COLL_TYPE_SCATTER:
         return (root == rank)
-                 ? args->src.info.count * ucc_dt_size(args->src.info.datatype)
-                 : args->dst.info.count * ucc_dt_size(args->dst.info.datatype) *
-                   size;
+                 ? UCC_BUFFER_INFO_SIZE(args->src.info)
+                 : UCC_BUFFER_INFO_SIZE(args->dst.info) * size;
     default:
         ucc_assert(args->coll_type == UCC_COLL_TYPE_LAST);
     }
@@ -550,6 +570,8 @@ void ucc_coll_args_str(const ucc_coll_args_t *args, ucc_rank_t trank,
     case UCC_COLL_TYPE_ALLREDUCE:
     case UCC_COLL_TYPE_ALLTOALL:
     case UCC_COLL_TYPE_REDUCE_SCATTER:
+    case UCC_COLL_TYPE_SCAN:
+    case UCC_COLL_TYPE_EXSCAN:
         dst_info = args->dst.info;
         has_dst = 1;
         if (!UCC_IS_INPLACE(*args)) {
@@ -588,9 +610,18 @@ void ucc_coll_args_str(const ucc_coll_args_t *args, ucc_rank_t trank,
             src_info.mem_type = args->src.info_v.mem_type;
             has_src = 1;
         }
+        break;
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
+        src_info = args->src.info;
+        dst_info = args->dst.info;
+        has_src  = 1;
+        has_dst  = 1;
+        break;
     case UCC_COLL_TYPE_BARRIER:
     case UCC_COLL_TYPE_FANIN:
     case UCC_COLL_TYPE_FANOUT:
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
+        /* counts depend on the team neighbor graph */
         break;
     case UCC_COLL_TYPE_BCAST:
         src_info = args->src.info;
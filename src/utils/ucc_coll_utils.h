@@ -38,14 +38,20 @@
 
 #define UCC_IS_ROOT(_args, _myrank) ((_args).root == (_myrank))
 
+#define UCC_COLL_ARGS_TIMEOUT(_args)                                           \
+    (((_args).mask & UCC_COLL_ARGS_FIELD_FLAGS) &&                             \
+     ((_args).flags & UCC_COLL_ARGS_FLAG_TIMEOUT))
+
+/* Uses task flag cached from bargs by ucc_coll_task_init, called from
+   progress queue on every pass */
 #define UCC_COLL_TIMEOUT_REQUIRED(_task)                                       \
-    (((_task)->bargs.args.mask & UCC_COLL_ARGS_FIELD_FLAGS) &&                 \
-     ((_task)->bargs.args.flags & UCC_COLL_ARGS_FLAG_TIMEOUT))
+    ((_task)->flags & UCC_COLL_TASK_FLAG_TIMEOUT)
 
 #define UCC_COLL_SET_TIMEOUT(_task, _timeout) do {                             \
         (_task)->bargs.args.mask   |= UCC_COLL_ARGS_FIELD_FLAGS;               \
         (_task)->bargs.args.flags  |= UCC_COLL_ARGS_FLAG_TIMEOUT;              \
         (_task)->bargs.args.timeout = _timeout;                                \
+        (_task)->flags             |= UCC_COLL_TASK_FLAG_TIMEOUT;              \
         (_task)->start_time   = ucc_get_time();                                \
     } while(0)
 
@@ -81,7 +87,8 @@ static inline int ucc_coll_args_is_reduction(ucc_coll_type_t ct)
 {
     if (ct == UCC_COLL_TYPE_ALLREDUCE || ct == UCC_COLL_TYPE_REDUCE ||
         ct == UCC_COLL_TYPE_REDUCE_SCATTER ||
-        ct == UCC_COLL_TYPE_REDUCE_SCATTERV) {
+        ct == UCC_COLL_TYPE_REDUCE_SCATTERV || ct == UCC_COLL_TYPE_SCAN ||
+        ct == UCC_COLL_TYPE_EXSCAN) {
         return 1;
     }
     return 0;
@@ -110,51 +110,72 @@ ucc_component_check_ids_uniq(ucc_component_framework_t *framework)
     return UCC_OK;
 }
 
-ucc_status_t ucc_components_load(const char *framework_name,
-                                 ucc_component_framework_t *framework)
+/* Returns 1 if so_path is the module of a component that is built into
+   libucc: it must not be opened, the builtin iface is used instead */
+static int ucc_component_is_builtin(const char *so_path,
+                                    const char *framework_name)
 {
-    glob_t globbuf;
-    int    i, n_loaded;
-    char  *full_pattern;
-    ucc_status_t            status;
-    size_t                  pattern_size;
-    ucc_component_iface_t **ifaces = NULL;
+    char                     so_name[IFACE_NAME_LEN_MAX];
+    const char              *basename;
+    ucc_component_builtin_t *b;
 
-    framework->n_components = 0;
-    framework->components   = NULL;
-
-    if (strlen(framework_name) == 0 ||
-        strlen(framework_name) > UCC_MAX_FRAMEWORK_NAME_LEN) {
-        ucc_error("unsupported framework_name length: %s, len %zd",
-                  framework_name, strlen(framework_name));
-        return UCC_ERR_INVALID_PARAM;
+    basename = strrchr(so_path, '/');
+    basename = basename ? basename + 1 : so_path;
+    for (b = ucc_builtin_components; b->iface; b++) {
+        if (0 != strcmp(b->framework_name, framework_name)) {
+            continue;
+        }
+        ucc_snprintf_safe(so_name, sizeof(so_name), "libucc_%s_%s.so",
+                          framework_name, b->iface->name);
+        if (0 == strcmp(basename, so_name)) {
+            return 1;
+        }
     }
+    return 0;
+}
 
-    pattern_size =
-        strlen(ucc_global_config.component_path) + strlen(framework_name) + 16;
-    full_pattern = (char *)ucc_malloc(pattern_size, "full_pattern");
-    if (!full_pattern) {
-        ucc_error("failed to allocate %zd bytes for full_pattern",
-                  pattern_size);
-        return UCC_ERR_NO_MEMORY;
-    }
-    ucc_snprintf_safe(full_pattern, pattern_size, "%s/libucc_%s_*.so",
-                      ucc_global_config.component_path, framework_name);
-    glob(full_pattern, 0, NULL, &globbuf);
-    ucc_free(full_pattern);
-    n_loaded          = 0;
+static ucc_status_t
+ucc_components_load_paths(const char *framework_name, char **paths,
+                          size_t n_paths, ucc_component_framework_t *framework)
+{
+    int                      i, n_loaded;
+    size_t                   n_ifaces;
+    ucc_status_t             status;
+    ucc_component_builtin_t *b;
+    ucc_component_iface_t  **ifaces;
 
-    dlerror(); /* Clear any existing error */
+    n_ifaces = n_paths;
+    for (b = ucc_builtin_components; b->iface; b++) {
+        n_ifaces++;
+    }
+    if (!n_ifaces) {
+        return UCC_ERR_NOT_FOUND;
+    }
     ifaces = (ucc_component_iface_t **)ucc_malloc(
-        globbuf.gl_pathc * sizeof(ucc_component_iface_t *), "ifaces");
+        n_ifaces * sizeof(ucc_component_iface_t *), "ifaces");
     if (!ifaces) {
         ucc_error("failed to allocate %zd bytes for ifaces",
-                  globbuf.gl_pathc * sizeof(ucc_component_iface_t *));
+                  n_ifaces * sizeof(ucc_component_iface_t *));
         return UCC_ERR_NO_MEMORY;
     }
 
-    for (i = 0; i < globbuf.gl_pathc; i++) {
-        status = ucc_component_load_one(globbuf.gl_pathv[i], framework_name,
+    n_loaded = 0;
+    for (b = ucc_builtin_components; b->iface; b++) {
+        if (0 == strcmp(b->framework_name, framework_name)) {
+            b->iface->dl_handle = NULL;
+            b->iface->id        = ucc_str_hash_djb2(b->iface->name);
+            ifaces[n_loaded++]  = b->iface;
+        }
+    }
+
+    dlerror(); /* Clear any existing error */
+    for (i = 0; i < n_paths; i++) {
+        if (ucc_component_is_builtin(paths[i], framework_name)) {
+            ucc_debug("skipping %s: component is built into libucc",
+                      paths[i]);
+            continue;
+        }
+        status = ucc_component_load_one(paths[i], framework_name,
                                         &ifaces[n_loaded]);
         if (status != UCC_OK) {
             continue;
@@ -162,14 +183,9 @@ ucc_status_t ucc_components_load(const char *framework_name,
         n_loaded++;
     }
 
-    assert(n_loaded <= globbuf.gl_pathc);
-    if (globbuf.gl_pathc > 0) {
-        globfree(&globbuf);
-    }
+    assert(n_loaded <= n_ifaces);
     if (!n_loaded) {
-        if (ifaces) {
-            ucc_free(ifaces);
-        }
+        ucc_free(ifaces);
         return UCC_ERR_NOT_FOUND;
     }
 
@@ -206,6 +222,109 @@ err:
     return status;
 }
 
+static ucc_status_t ucc_framework_name_check(const char *framework_name)
+{
+    if (strlen(framework_name) == 0 ||
+        strlen(framework_name) > UCC_MAX_FRAMEWORK_NAME_LEN) {
+        ucc_error("unsupported framework_name length: %s, len %zd",
+                  framework_name, strlen(framework_name));
+        return UCC_ERR_INVALID_PARAM;
+    }
+    return UCC_OK;
+}
+
+ucc_status_t ucc_components_load(const char *framework_name,
+                                 ucc_component_framework_t *framework)
+{
+    glob_t       globbuf;
+    char        *full_pattern;
+    ucc_status_t status;
+    size_t       pattern_size;
+
+    framework->n_components = 0;
+    framework->components   = NULL;
+
+    status = ucc_framework_name_check(framework_name);
+    if (UCC_OK != status) {
+        return status;
+    }
+
+    pattern_size =
+        strlen(ucc_global_config.component_path) + strlen(framework_name) + 16;
+    full_pattern = (char *)ucc_malloc(pattern_size, "full_pattern");
+    if (!full_pattern) {
+        ucc_error("failed to allocate %zd bytes for full_pattern",
+                  pattern_size);
+        return UCC_ERR_NO_MEMORY;
+    }
+    ucc_snprintf_safe(full_pattern, pattern_size, "%s/libucc_%s_*.so",
+                      ucc_global_config.component_path, framework_name);
+    memset(&globbuf, 0, sizeof(globbuf));
+    glob(full_pattern, 0, NULL, &globbuf);
+    ucc_free(full_pattern);
+
+    status = ucc_components_load_paths(framework_name, globbuf.gl_pathv,
+                                       globbuf.gl_pathc, framework);
+    if (globbuf.gl_pathc > 0) {
+        globfree(&globbuf);
+    }
+    return status;
+}
+
+ucc_status_t
+ucc_components_load_filtered(const char *framework_name,
+                             const ucc_config_names_array_t *filter,
+                             ucc_component_framework_t *framework)
+{
+    char       **paths;
+    unsigned     i;
+    size_t       path_size;
+    ucc_status_t status;
+
+    if (!filter || filter->count == 0 ||
+        ucc_config_names_search(filter, "all") >= 0) {
+        return ucc_components_load(framework_name, framework);
+    }
+
+    framework->n_components = 0;
+    framework->components   = NULL;
+
+    status = ucc_framework_name_check(framework_name);
+    if (UCC_OK != status) {
+        return status;
+    }
+
+    paths = (char **)ucc_calloc(filter->count, sizeof(char *),
+                                "component_paths");
+    if (!paths) {
+        ucc_error("failed to allocate %zd bytes for component paths",
+                  filter->count * sizeof(char *));
+        return UCC_ERR_NO_MEMORY;
+    }
+    for (i = 0; i < filter->count; i++) {
+        path_size = strlen(ucc_global_config.component_path) +
+                    strlen(framework_name) + strlen(filter->names[i]) + 16;
+        paths[i]  = (char *)ucc_malloc(path_size, "component_path");
+        if (!paths[i]) {
+            ucc_error("failed to allocate %zd bytes for component path",
+                      path_size);
+            status = UCC_ERR_NO_MEMORY;
+            goto out;
+        }
+        ucc_snprintf_safe(paths[i], path_size, "%s/libucc_%s_%s.so",
+                          ucc_global_config.component_path, framework_name,
+                          filter->names[i]);
+    }
+    status = ucc_components_load_paths(framework_name, paths, filter->count,
+                                       framework);
+out:
+    for (i = 0; i < filter->count; i++) {
+        ucc_free(paths[i]);
+    }
+    ucc_free(paths);
+    return status;
+}
+
 ucc_component_iface_t* ucc_get_component(ucc_component_framework_t *framework,
                                          const char *component_name)
 {
@@ -21,6 +21,15 @@ typedef struct ucc_component_iface {
     ucc_score_t    score;
 } ucc_component_iface_t;
 
+/* Entry of the table of components linked into libucc, see
+   --enable-builtin-components. The table is terminated by NULL iface */
+typedef struct ucc_component_builtin {
+    const char            *framework_name;
+    ucc_component_iface_t *iface;
+} ucc_component_builtin_t;
+
+extern ucc_component_builtin_t ucc_builtin_components[];
+
 typedef struct ucc_component_framework {
     char                    *framework_name;
     int                      n_components;
@@ -28,7 +37,8 @@ typedef struct ucc_component_framework {
     ucc_config_names_array_t names;
 } ucc_component_framework_t;
 
-/* ucc_components_load searches for all available dynamic components
+/* ucc_components_load registers the components of the framework that are
+   built into libucc and searches for all available dynamic components
    with the name matching the pattern: libucc_<framework_name>_*.so.
    The search is performed in the ucc_global_config.component_path.
    Each dynamic component must have a component interface structure defined.
@@ -38,6 +48,14 @@ typedef struct ucc_component_framework {
 ucc_status_t ucc_components_load(const char *framework_name,
                                  ucc_component_framework_t *framework);
 
+/* Same as ucc_components_load but only the components named in "filter"
+   are opened, the components dir is not scanned. NULL or empty filter, or
+   the one containing "all", falls back to ucc_components_load. */
+ucc_status_t
+ucc_components_load_filtered(const char *framework_name,
+                             const ucc_config_names_array_t *filter,
+                             ucc_component_framework_t *framework);
+
 /* get the component_iface_t from the initialized framework
    using the iface name. Returns NULL if the iface with the given
    name is not found in the framework. */
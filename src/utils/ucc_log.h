@@ -123,6 +123,14 @@ static inline const char* ucc_coll_type_str(ucc_coll_type_t ct)
         return "Reduce_scatter";
     case UCC_COLL_TYPE_REDUCE_SCATTERV:
         return "Reduce_scatterv";
+    case UCC_COLL_TYPE_SCAN:
+        return "Scan";
+    case UCC_COLL_TYPE_EXSCAN:
+        return "Exscan";
+    case UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV:
+        return "Neighbor_alltoallv";
+    case UCC_COLL_TYPE_NEIGHBOR_ALLGATHER:
+        return "Neighbor_allgather";
     default:
         break;
     }
@@ -168,6 +176,14 @@ static inline const char* ucc_datatype_str(ucc_datatype_t dt)
         return "float64_complex";
     case UCC_DT_FLOAT128_COMPLEX:
         return "float128_complex";
+    case UCC_DT_FLOAT32_INT32:
+        return "float32_int32";
+    case UCC_DT_FLOAT64_INT32:
+        return "float64_int32";
+    case UCC_DT_INT64_INT32:
+        return "int64_int32";
+    case UCC_DT_INT32_INT32:
+        return "int32_int32";
     default:
         return "userdefined";
     }
@@ -102,6 +102,80 @@ static inline void float32tobfloat16(float float_val, void *bfloat16_ptr)
 #endif
 }
 
+/* IEEE 754 half precision, round to nearest even */
+static inline float float16tofloat32(const void *float16_ptr)
+{
+    uint16_t h    = *((const uint16_t *)float16_ptr);
+    uint32_t sign = ((uint32_t)h & 0x8000) << 16;
+    uint32_t exp  = (h >> 10) & 0x1f;
+    uint32_t man  = h & 0x3ff;
+    uint32_t bits;
+    union {
+        uint32_t u;
+        float    f;
+    } res;
+
+    if (exp == 0x1f) {
+        bits = sign | 0x7f800000 | (man << 13);
+    } else if (exp != 0) {
+        bits = sign | ((exp + 112) << 23) | (man << 13);
+    } else if (man == 0) {
+        bits = sign;
+    } else {
+        /* subnormal half is a normal float */
+        exp = 113;
+        while (!(man & 0x400)) {
+            man <<= 1;
+            exp--;
+        }
+        bits = sign | (exp << 23) | ((man & 0x3ff) << 13);
+    }
+    res.u = bits;
+    return res.f;
+}
+
+static inline void float32tofloat16(float float_val, void *float16_ptr)
+{
+    uint32_t bits, man, shift;
+    int32_t  exp;
+    uint16_t sign, h;
+    union {
+        float    f;
+        uint32_t u;
+    } v;
+
+    v.f  = float_val;
+    bits = v.u;
+    sign = (bits >> 16) & 0x8000;
+    exp  = (int32_t)((bits >> 23) & 0xff) - 112;
+    man  = bits & 0x7fffff;
+    if (((bits >> 23) & 0xff) == 0xff) {
+        /* inf or nan, keep nan quiet */
+        h = sign | 0x7c00 | (man ? 0x200 : 0);
+    } else if (exp >= 0x1f) {
+        h = sign | 0x7c00;
+    } else if (exp <= 0) {
+        if (exp < -10) {
+            h = sign;
+        } else {
+            man  |= 0x800000;
+            shift = (uint32_t)(14 - exp);
+            h     = sign | (uint16_t)(man >> shift);
+            if ((man >> (shift - 1)) & 1 &&
+                ((man & ((1u << (shift - 1)) - 1)) || (h & 1))) {
+                h++;
+            }
+        }
+    } else {
+        h = sign | (uint16_t)(exp << 10) | (uint16_t)(man >> 13);
+        /* carry into the exponent gives the correct rounding to inf */
+        if ((man & 0x1000) && ((man & 0xfff) || (h & 1))) {
+            h++;
+        }
+    }
+    *((uint16_t *)float16_ptr) = h;
+}
+
 #define ucc_padding(_n, _alignment)                                            \
     ( ((_alignment) - (_n) % (_alignment)) % (_alignment) )
 
@@ -11,6 +11,7 @@
 #include "ini.h"
 #include "schedule/ucc_schedule.h"
 #include "schedule/ucc_schedule_pipelined.h"
+#include <ctype.h>
 
 #define UCC_ADD_KEY_VALUE_TO_HASH(_type, _h, _name, _val)                \
     do {                                                                 \
@@ -260,6 +261,49 @@ err:
     return UCC_ERR_NO_MEMORY;
 }
 
+ucc_status_t
+ucc_config_names_array_merge_trim(ucc_config_names_array_t       *dst,
+                                  const ucc_config_names_array_t *src)
+{
+    const char *name;
+    char      **names;
+    char       *n;
+    size_t      len;
+    int         i;
+
+    for (i = 0; i < src->count; i++) {
+        name = src->names[i];
+        while (isspace(*name)) {
+            name++;
+        }
+        len = strlen(name);
+        while (len > 0 && isspace(name[len - 1])) {
+            len--;
+        }
+        if (len == 0) {
+            continue;
+        }
+        n = strndup(name, len);
+        if (!n) {
+            ucc_error("failed to dup config_names_array entry");
+            return UCC_ERR_NO_MEMORY;
+        }
+        if (ucc_config_names_search(dst, n) >= 0) {
+            free(n);
+            continue;
+        }
+        names = ucc_realloc(dst->names, (dst->count + 1) * sizeof(char *),
+                            "ucc_config_names_array");
+        if (ucc_unlikely(!names)) {
+            free(n);
+            return UCC_ERR_NO_MEMORY;
+        }
+        dst->names               = names;
+        dst->names[dst->count++] = n;
+    }
+    return UCC_OK;
+}
+
 void ucc_config_names_array_free(ucc_config_names_array_t *array)
 {
     int i;
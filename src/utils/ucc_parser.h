@@ -70,6 +70,7 @@ typedef struct ucc_file_config ucc_file_config_t;
 #define UCC_CONFIG_TYPE_BITMAP          UCS_CONFIG_TYPE_BITMAP
 #define UCC_CONFIG_TYPE_MEMUNITS        UCS_CONFIG_TYPE_MEMUNITS
 #define UCC_CONFIG_TYPE_BOOL            UCS_CONFIG_TYPE_BOOL
+#define UCC_CONFIG_TYPE_TIME            UCS_CONFIG_TYPE_TIME
 #define UCC_CONFIG_ALLOW_LIST_NEGATE    UCS_CONFIG_ALLOW_LIST_NEGATE
 #define UCC_CONFIG_ALLOW_LIST_ALLOW_ALL UCS_CONFIG_ALLOW_LIST_ALLOW_ALL
 #define UCC_CONFIG_ALLOW_LIST_ALLOW     UCS_CONFIG_ALLOW_LIST_ALLOW
@@ -225,6 +226,12 @@ ucc_status_t ucc_config_names_array_dup(ucc_config_names_array_t *dst,
 ucc_status_t ucc_config_names_array_merge(ucc_config_names_array_t *dst,
                                           const ucc_config_names_array_t *src);
 
+/* Appends the names of src which are not in dst yet. Leading and trailing
+   whitespaces are removed, empty names are skipped */
+ucc_status_t
+ucc_config_names_array_merge_trim(ucc_config_names_array_t       *dst,
+                                  const ucc_config_names_array_t *src);
+
 void ucc_config_names_array_free(ucc_config_names_array_t *array);
 
 int ucc_config_names_search(const ucc_config_names_array_t *config_names,
@@ -236,6 +243,11 @@ int ucc_config_names_array_is_all(const ucc_config_names_array_t *array)
     return (array->count == 1) && (0 == strcmp(array->names[0], "all"));
 }
 
+static inline int ucc_config_field_is_allow_list(const ucc_config_field_t *f)
+{
+    return f->parser.read == ucs_config_sscanf_allow_list;
+}
+
 ucc_status_t ucc_config_allow_list_process(const ucc_config_allow_list_t * list,
                                            const ucc_config_names_array_t *all,
                                            ucc_config_names_list_t *       out);
@@ -0,0 +1,306 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_bench.h"
+#include <getopt.h>
+#include <sched.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+BEGIN_C_DECLS
+#include "core/ucc_global_opts.h"
+#include "components/mc/ucc_mc.h"
+#include "components/ec/ucc_ec.h"
+END_C_DECLS
+
+typedef enum {
+    UCC_BENCH_OUTPUT_FORMAT_TABLE,
+    UCC_BENCH_OUTPUT_FORMAT_CSV,
+    UCC_BENCH_OUTPUT_FORMAT_JSON,
+} ucc_bench_output_format_t;
+
+static const std::map<std::string, ucc_bench_output_format_t>
+    ucc_bench_output_format_map = {
+        {"table", UCC_BENCH_OUTPUT_FORMAT_TABLE},
+        {"csv", UCC_BENCH_OUTPUT_FORMAT_CSV},
+        {"json", UCC_BENCH_OUTPUT_FORMAT_JSON},
+};
+
+struct ucc_bench_config {
+    size_t                    n_iters;
+    size_t                    n_warmup;
+    int                       n_reps;
+    int                       cpu;
+    bool                      list_only;
+    std::string               filter;
+    ucc_bench_output_format_t out_fmt;
+};
+
+/* Statistics of per-operation time in ns over repetitions */
+struct ucc_bench_stats {
+    double min;
+    double p50;
+    double avg;
+    double max;
+    double stddev;
+};
+
+static void print_help()
+{
+    std::cout << "Usage: ucc_bench [options]" << std::endl
+              << "  -n <num>: number of iterations per repetition"
+              << std::endl
+              << "  -w <num>: number of warmup iterations" << std::endl
+              << "  -r <num>: number of measured repetitions" << std::endl
+              << "  -f <str>: run only cases whose name contains str"
+              << std::endl
+              << "  -c <cpu>: bind to cpu before running" << std::endl
+              << "  -F <fmt>: output format: table, csv or json" << std::endl
+              << "  -l: list cases and exit" << std::endl
+              << "  -h: show this help message" << std::endl;
+}
+
+static ucc_status_t process_args(int argc, char *argv[],
+                                 ucc_bench_config &cfg)
+{
+    int c;
+
+    while ((c = getopt(argc, argv, "n:w:r:f:c:F:lh")) != -1) {
+        switch (c) {
+        case 'n':
+            std::stringstream(optarg) >> cfg.n_iters;
+            break;
+        case 'w':
+            std::stringstream(optarg) >> cfg.n_warmup;
+            break;
+        case 'r':
+            std::stringstream(optarg) >> cfg.n_reps;
+            break;
+        case 'f':
+            cfg.filter = optarg;
+            break;
+        case 'c':
+            std::stringstream(optarg) >> cfg.cpu;
+            break;
+        case 'F':
+            if (ucc_bench_output_format_map.count(optarg) == 0) {
+                std::cerr << "invalid output format: " << optarg
+                          << std::endl;
+                return UCC_ERR_INVALID_PARAM;
+            }
+            cfg.out_fmt = ucc_bench_output_format_map.at(optarg);
+            break;
+        case 'l':
+            cfg.list_only = true;
+            break;
+        case 'h':
+        default:
+            print_help();
+            std::exit(0);
+        }
+    }
+    if (cfg.n_iters == 0 || cfg.n_reps <= 0) {
+        std::cerr << "number of iterations and repetitions must be positive"
+                  << std::endl;
+        return UCC_ERR_INVALID_PARAM;
+    }
+    return UCC_OK;
+}
+
+static ucc_status_t run_case(ucc_bench_case *bc, const ucc_bench_config &cfg,
+                             ucc_bench_stats &stats)
+{
+    std::vector<double> t(cfg.n_reps);
+    double              sum, var;
+    ucc_status_t        st;
+    int                 i;
+
+    st = bc->run(cfg.n_warmup);
+    if (st != UCC_OK) {
+        return st;
+    }
+    for (i = 0; i < cfg.n_reps; i++) {
+        auto start = std::chrono::steady_clock::now();
+        st = bc->run(cfg.n_iters);
+        auto end   = std::chrono::steady_clock::now();
+        if (st != UCC_OK) {
+            return st;
+        }
+        t[i] = std::chrono::duration<double, std::nano>(end - start).count() /
+               cfg.n_iters;
+    }
+    std::sort(t.begin(), t.end());
+    sum = var = 0;
+    for (auto v : t) {
+        sum += v;
+    }
+    stats.avg = sum / cfg.n_reps;
+    for (auto v : t) {
+        var += (v - stats.avg) * (v - stats.avg);
+    }
+    stats.min    = t.front();
+    stats.max    = t.back();
+    stats.p50    = t[cfg.n_reps / 2];
+    stats.stddev = std::sqrt(var / cfg.n_reps);
+    return UCC_OK;
+}
+
+static std::string fmt_value(double v)
+{
+    std::ostringstream os;
+
+    os << std::setprecision(2) << std::fixed << v;
+    return os.str();
+}
+
+static void print_header(const ucc_bench_config &cfg)
+{
+    switch (cfg.out_fmt) {
+    case UCC_BENCH_OUTPUT_FORMAT_CSV:
+        std::cout << "name,params,iters,reps,"
+                  << "time_min,time_p50,time_avg,time_max,stddev"
+                  << std::endl;
+        break;
+    case UCC_BENCH_OUTPUT_FORMAT_JSON:
+        std::cout << "{" << std::endl
+                  << "  \"iters\": " << cfg.n_iters << "," << std::endl
+                  << "  \"warmup\": " << cfg.n_warmup << "," << std::endl
+                  << "  \"reps\": " << cfg.n_reps << "," << std::endl
+                  << "  \"time_unit\": \"ns\"," << std::endl
+                  << "  \"results\": [";
+        break;
+    default:
+        std::cout << "iterations: " << cfg.n_iters << ", warmup: "
+                  << cfg.n_warmup << ", repetitions: " << cfg.n_reps
+                  << ", time per operation in ns" << std::endl
+                  << std::left << std::setw(16) << "name"
+                  << std::setw(48) << "params" << std::right
+                  << std::setw(12) << "min" << std::setw(12) << "p50"
+                  << std::setw(12) << "avg" << std::setw(12) << "max"
+                  << std::setw(12) << "stddev" << std::endl;
+        break;
+    }
+}
+
+static void print_footer(const ucc_bench_config &cfg)
+{
+    if (cfg.out_fmt == UCC_BENCH_OUTPUT_FORMAT_JSON) {
+        std::cout << std::endl << "  ]" << std::endl << "}" << std::endl;
+    }
+}
+
+static void print_result(const ucc_bench_config &cfg, ucc_bench_case *bc,
+                         const ucc_bench_stats &s, int n_results)
+{
+    switch (cfg.out_fmt) {
+    case UCC_BENCH_OUTPUT_FORMAT_CSV:
+        std::cout << bc->name << ",\"" << bc->params << "\","
+                  << cfg.n_iters << "," << cfg.n_reps << ","
+                  << fmt_value(s.min) << "," << fmt_value(s.p50) << ","
+                  << fmt_value(s.avg) << "," << fmt_value(s.max) << ","
+                  << fmt_value(s.stddev) << std::endl;
+        break;
+    case UCC_BENCH_OUTPUT_FORMAT_JSON:
+        std::cout << (n_results ? "," : "") << std::endl
+                  << "    {\"name\": \"" << bc->name << "\""
+                  << ", \"params\": \"" << bc->params << "\""
+                  << ", \"time_min\": " << fmt_value(s.min)
+                  << ", \"time_p50\": " << fmt_value(s.p50)
+                  << ", \"time_avg\": " << fmt_value(s.avg)
+                  << ", \"time_max\": " << fmt_value(s.max)
+                  << ", \"stddev\": " << fmt_value(s.stddev) << "}";
+        break;
+    default:
+        std::cout << std::left << std::setw(16) << bc->name
+                  << std::setw(48) << bc->params << std::right
+                  << std::setw(12) << fmt_value(s.min)
+                  << std::setw(12) << fmt_value(s.p50)
+                  << std::setw(12) << fmt_value(s.avg)
+                  << std::setw(12) << fmt_value(s.max)
+                  << std::setw(12) << fmt_value(s.stddev) << std::endl;
+        break;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    ucc_bench_config  cfg       = {10000, 1000, 15, -1, false, "",
+                                   UCC_BENCH_OUTPUT_FORMAT_TABLE};
+    ucc_mc_params_t   mc_params = {.thread_mode = UCC_THREAD_MULTIPLE};
+    ucc_ec_params_t   ec_params = {.thread_mode = UCC_THREAD_MULTIPLE};
+    int               n_results = 0;
+    int               ret       = 0;
+    ucc_bench_suite_t suite;
+    ucc_bench_stats   stats;
+    cpu_set_t         cpuset;
+    ucc_status_t      st;
+
+    if (process_args(argc, argv, cfg) != UCC_OK) {
+        return 1;
+    }
+    if (cfg.cpu >= 0) {
+        CPU_ZERO(&cpuset);
+        CPU_SET(cfg.cpu, &cpuset);
+        if (sched_setaffinity(0, sizeof(cpuset), &cpuset) != 0) {
+            std::cerr << "failed to bind to cpu " << cfg.cpu << std::endl;
+            return 1;
+        }
+    }
+
+    ucc_bench_add_ec_reduce(suite);
+    ucc_bench_add_score_map(suite);
+    ucc_bench_add_mpool(suite);
+    ucc_bench_add_pq(suite);
+    ucc_bench_add_ep_map(suite);
+    ucc_bench_add_coll(suite);
+
+    if (cfg.list_only) {
+        for (auto &bc : suite) {
+            std::cout << bc->name << " " << bc->params << std::endl;
+        }
+        return 0;
+    }
+
+    if (ucc_constructor() != UCC_OK || ucc_mc_init(&mc_params) != UCC_OK ||
+        ucc_ec_init(&ec_params) != UCC_OK) {
+        std::cerr << "failed to initialize ucc components" << std::endl;
+        return 1;
+    }
+
+    print_header(cfg);
+    for (auto &bc : suite) {
+        if (bc->name.find(cfg.filter) == std::string::npos) {
+            continue;
+        }
+        st = bc->setup();
+        if (st == UCC_ERR_NOT_SUPPORTED) {
+            continue;
+        }
+        if (st == UCC_OK) {
+            st = run_case(bc.get(), cfg, stats);
+            bc->cleanup();
+        }
+        if (st != UCC_OK) {
+            std::cerr << "failed to run " << bc->name << " " << bc->params
+                      << ": " << ucc_status_string(st) << std::endl;
+            ret = 1;
+            continue;
+        }
+        print_result(cfg, bc.get(), stats, n_results++);
+    }
+    print_footer(cfg);
+
+    ucc_ec_finalize();
+    ucc_mc_finalize();
+    return ret;
+}
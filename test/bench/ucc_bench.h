@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_BENCH_H
+#define UCC_BENCH_H
+
+#include <ucc/api/ucc.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Single microbenchmark case. Runner calls setup once, then run() for
+ * warmup and for every measured repetition, then cleanup. Time reported
+ * for the case is the time of run() divided by the number of iterations */
+class ucc_bench_case {
+public:
+    std::string name;
+    std::string params;
+
+    ucc_bench_case(const std::string &n, const std::string &p) :
+        name(n), params(p) {}
+    virtual ucc_status_t setup() { return UCC_OK; }
+    /* runs the measured operation n_iters times */
+    virtual ucc_status_t run(size_t n_iters) = 0;
+    virtual void cleanup() {}
+    virtual ~ucc_bench_case() {}
+};
+
+typedef std::vector<std::unique_ptr<ucc_bench_case>> ucc_bench_suite_t;
+
+/* Keeps compiler from optimizing out results of measured operations */
+template <typename T> static inline void ucc_bench_keep(T const &v)
+{
+    asm volatile("" : : "g"(v) : "memory");
+}
+
+void ucc_bench_add_ec_reduce(ucc_bench_suite_t &suite);
+void ucc_bench_add_score_map(ucc_bench_suite_t &suite);
+void ucc_bench_add_mpool(ucc_bench_suite_t &suite);
+void ucc_bench_add_pq(ucc_bench_suite_t &suite);
+void ucc_bench_add_ep_map(ucc_bench_suite_t &suite);
+void ucc_bench_add_coll(ucc_bench_suite_t &suite);
+
+#endif
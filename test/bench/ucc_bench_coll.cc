@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_bench.h"
+#include <cstdlib>
+#include <cstring>
+BEGIN_C_DECLS
+#include "utils/ucc_log.h"
+END_C_DECLS
+
+#define UCC_BENCH_COLL_COUNT 1024
+
+/* Out of band allgather of a single process team */
+static ucc_status_t ucc_bench_oob_allgather(void *sbuf, void *rbuf,
+                                            size_t msglen,
+                                            void *coll_info, //NOLINT
+                                            void **req)
+{
+    memcpy(rbuf, sbuf, msglen);
+    *req = NULL;
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_bench_oob_req_test(void *req) //NOLINT: unused
+{
+    return UCC_OK;
+}
+
+static ucc_status_t ucc_bench_oob_req_free(void *req) //NOLINT: unused
+{
+    return UCC_OK;
+}
+
+/* ucc_collective_init + ucc_collective_finalize on a single process team.
+ * CL/BASIC is restricted to TL/SELF unless UCC_CL_BASIC_TLS is set by user,
+ * so the measured time is core and CL overhead plus TL/SELF task init */
+class ucc_bench_coll : public ucc_bench_case {
+    ucc_coll_type_t  coll_type;
+    ucc_lib_h        lib;
+    ucc_context_h    ctx;
+    ucc_team_h       team;
+    float           *sbuf;
+    float           *rbuf;
+    ucc_coll_args_t  args;
+
+public:
+    ucc_bench_coll(ucc_coll_type_t ct) :
+        ucc_bench_case("coll_init",
+                       std::string("coll=") + ucc_coll_type_str(ct) +
+                       ",tl=self,count=" +
+                       std::to_string(UCC_BENCH_COLL_COUNT)),
+        coll_type(ct), lib(nullptr), ctx(nullptr), team(nullptr),
+        sbuf(nullptr), rbuf(nullptr) {}
+
+    ucc_status_t setup() override
+    {
+        ucc_lib_config_h     lib_config;
+        ucc_context_config_h ctx_config;
+        ucc_lib_params_t     lib_params;
+        ucc_context_params_t ctx_params;
+        ucc_team_params_t    team_params;
+        ucc_oob_coll_t       oob;
+        ucc_status_t         st;
+
+        setenv("UCC_CL_BASIC_TLS", "self", 0);
+        lib_params.mask        = UCC_LIB_PARAM_FIELD_THREAD_MODE;
+        lib_params.thread_mode = UCC_THREAD_SINGLE;
+        st = ucc_lib_config_read(NULL, NULL, &lib_config);
+        if (st != UCC_OK) {
+            return st;
+        }
+        st = ucc_init(&lib_params, lib_config, &lib);
+        ucc_lib_config_release(lib_config);
+        if (st != UCC_OK) {
+            lib = nullptr;
+            return st;
+        }
+
+        oob.allgather = ucc_bench_oob_allgather;
+        oob.req_test  = ucc_bench_oob_req_test;
+        oob.req_free  = ucc_bench_oob_req_free;
+        oob.coll_info = NULL;
+        oob.n_oob_eps = 1;
+        oob.oob_ep    = 0;
+
+        ctx_params.mask = UCC_CONTEXT_PARAM_FIELD_OOB;
+        ctx_params.oob  = oob;
+        st = ucc_context_config_read(lib, NULL, &ctx_config);
+        if (st != UCC_OK) {
+            goto err;
+        }
+        st = ucc_context_create(lib, &ctx_params, ctx_config, &ctx);
+        ucc_context_config_release(ctx_config);
+        if (st != UCC_OK) {
+            ctx = nullptr;
+            goto err;
+        }
+
+        team_params.mask     = UCC_TEAM_PARAM_FIELD_EP |
+                               UCC_TEAM_PARAM_FIELD_EP_RANGE |
+                               UCC_TEAM_PARAM_FIELD_OOB;
+        team_params.oob      = oob;
+        team_params.ep       = 0;
+        team_params.ep_range = UCC_COLLECTIVE_EP_RANGE_CONTIG;
+        st = ucc_team_create_post(&ctx, 1, &team_params, &team);
+        if (st != UCC_OK) {
+            team = nullptr;
+            goto err;
+        }
+        while (UCC_INPROGRESS == (st = ucc_team_create_test(team))) {
+            ucc_context_progress(ctx);
+        }
+        if (st != UCC_OK) {
+            goto err;
+        }
+
+        sbuf = (float *)calloc(UCC_BENCH_COLL_COUNT, sizeof(float));
+        rbuf = (float *)calloc(UCC_BENCH_COLL_COUNT, sizeof(float));
+        if (!sbuf || !rbuf) {
+            st = UCC_ERR_NO_MEMORY;
+            goto err;
+        }
+        memset(&args, 0, sizeof(args));
+        args.coll_type = coll_type;
+        switch (coll_type) {
+        case UCC_COLL_TYPE_BARRIER:
+            break;
+        case UCC_COLL_TYPE_BCAST:
+            args.root              = 0;
+            args.src.info.buffer   = sbuf;
+            args.src.info.count    = UCC_BENCH_COLL_COUNT;
+            args.src.info.datatype = UCC_DT_FLOAT32;
+            args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            break;
+        default:
+            args.op                = UCC_OP_SUM;
+            args.src.info.buffer   = sbuf;
+            args.src.info.count    = UCC_BENCH_COLL_COUNT;
+            args.src.info.datatype = UCC_DT_FLOAT32;
+            args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            args.dst.info          = args.src.info;
+            args.dst.info.buffer   = rbuf;
+            break;
+        }
+        return UCC_OK;
+    err:
+        cleanup();
+        return st;
+    }
+
+    ucc_status_t run(size_t n_iters) override
+    {
+        ucc_coll_req_h req;
+        ucc_status_t   st;
+        size_t         it;
+
+        for (it = 0; it < n_iters; it++) {
+            st = ucc_collective_init(&args, &req, team);
+            if (st != UCC_OK) {
+                return st;
+            }
+            st = ucc_collective_finalize(req);
+            if (st != UCC_OK) {
+                return st;
+            }
+        }
+        return UCC_OK;
+    }
+
+    void cleanup() override
+    {
+        if (team) {
+            while (UCC_INPROGRESS == ucc_team_destroy(team)) {
+                ucc_context_progress(ctx);
+            }
+            team = nullptr;
+        }
+        if (ctx) {
+            ucc_context_destroy(ctx);
+            ctx = nullptr;
+        }
+        if (lib) {
+            ucc_finalize(lib);
+            lib = nullptr;
+        }
+        free(sbuf);
+        free(rbuf);
+        sbuf = rbuf = nullptr;
+    }
+};
+
+void ucc_bench_add_coll(ucc_bench_suite_t &suite)
+{
+    const ucc_coll_type_t colls[] = {UCC_COLL_TYPE_BARRIER,
+                                     UCC_COLL_TYPE_BCAST,
+                                     UCC_COLL_TYPE_ALLREDUCE,
+                                     UCC_COLL_TYPE_ALLGATHER,
+                                     UCC_COLL_TYPE_ALLTOALL};
+
+    for (auto ct : colls) {
+        suite.emplace_back(new ucc_bench_coll(ct));
+    }
+}
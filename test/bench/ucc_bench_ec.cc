@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_bench.h"
+#include <cstring>
+BEGIN_C_DECLS
+#include "components/mc/ucc_mc.h"
+#include "components/ec/ucc_ec.h"
+#include "core/ucc_dt.h"
+#include "utils/ucc_log.h"
+END_C_DECLS
+
+#define UCC_BENCH_EC_REDUCE_COUNT 4096
+
+/* Reduction of n_srcs host buffers by CPU executor. The executor posts
+ * reduction inline into ucc_ec_cpu_reduce, so the measured time is that of
+ * the reduction kernel plus executor task post/test/finalize */
+class ucc_bench_ec_reduce : public ucc_bench_case {
+    ucc_datatype_t          dt;
+    ucc_reduction_op_t      op;
+    int                     n_srcs;
+    size_t                  count;
+    ucc_ee_executor_t      *exec;
+    ucc_mc_buffer_header_t *dst;
+    ucc_mc_buffer_header_t *srcs[UCC_EE_EXECUTOR_NUM_BUFS];
+
+public:
+    ucc_bench_ec_reduce(ucc_datatype_t d, ucc_reduction_op_t o, int n,
+                        size_t c) :
+        ucc_bench_case("ec_reduce",
+                       std::string("dt=") + ucc_datatype_str(d) +
+                       ",op=" + ucc_reduction_op_str(o) +
+                       ",n_srcs=" + std::to_string(n) +
+                       ",count=" + std::to_string(c)),
+        dt(d), op(o), n_srcs(n), count(c), exec(nullptr), dst(nullptr)
+    {
+        memset(srcs, 0, sizeof(srcs));
+    }
+
+    ucc_status_t setup() override
+    {
+        size_t                   size = count * ucc_dt_size(dt);
+        ucc_ee_executor_params_t params;
+        ucc_status_t             st;
+        int                      i;
+
+        params.mask    = UCC_EE_EXECUTOR_PARAM_FIELD_TYPE;
+        params.ee_type = UCC_EE_CPU_THREAD;
+        st             = ucc_ee_executor_init(&params, &exec);
+        if (st != UCC_OK) {
+            return st;
+        }
+        st = ucc_ee_executor_start(exec, nullptr);
+        if (st != UCC_OK) {
+            goto err;
+        }
+        st = ucc_mc_alloc(&dst, size, UCC_MEMORY_TYPE_HOST);
+        if (st != UCC_OK) {
+            goto err;
+        }
+        memset(dst->addr, 0, size);
+        for (i = 0; i < n_srcs; i++) {
+            st = ucc_mc_alloc(&srcs[i], size, UCC_MEMORY_TYPE_HOST);
+            if (st != UCC_OK) {
+                goto err;
+            }
+            memset(srcs[i]->addr, 1, size);
+        }
+        return UCC_OK;
+    err:
+        cleanup();
+        return st;
+    }
+
+    ucc_status_t run(size_t n_iters) override
+    {
+        ucc_ee_executor_task_args_t args;
+        ucc_ee_executor_task_t     *task;
+        ucc_status_t                st;
+        size_t                      it;
+        int                         i;
+
+        args.task_type     = UCC_EE_EXECUTOR_TASK_REDUCE;
+        args.flags         = 0;
+        args.reduce.dst    = dst->addr;
+        args.reduce.count  = count;
+        args.reduce.dt     = dt;
+        args.reduce.op     = op;
+        args.reduce.n_srcs = n_srcs;
+        for (i = 0; i < n_srcs; i++) {
+            args.reduce.srcs[i] = srcs[i]->addr;
+        }
+        for (it = 0; it < n_iters; it++) {
+            st = ucc_ee_executor_task_post(exec, &args, &task);
+            if (st != UCC_OK) {
+                return st;
+            }
+            do {
+                st = ucc_ee_executor_task_test(task);
+            } while (st == UCC_INPROGRESS);
+            ucc_ee_executor_task_finalize(task);
+            if (st != UCC_OK) {
+                return st;
+            }
+        }
+        return UCC_OK;
+    }
+
+    void cleanup() override
+    {
+        int i;
+
+        for (i = 0; i < n_srcs; i++) {
+            if (srcs[i]) {
+                ucc_mc_free(srcs[i]);
+                srcs[i] = nullptr;
+            }
+        }
+        if (dst) {
+            ucc_mc_free(dst);
+            dst = nullptr;
+        }
+        if (exec) {
+            ucc_ee_executor_stop(exec);
+            ucc_ee_executor_finalize(exec);
+            exec = nullptr;
+        }
+    }
+};
+
+void ucc_bench_add_ec_reduce(ucc_bench_suite_t &suite)
+{
+    const ucc_datatype_t     dts[]    = {UCC_DT_INT32, UCC_DT_INT64,
+                                         UCC_DT_FLOAT32, UCC_DT_FLOAT64};
+    const ucc_reduction_op_t ops[]    = {UCC_OP_SUM, UCC_OP_PROD, UCC_OP_MAX};
+    const int                n_srcs[] = {2, 4, 8};
+
+    for (auto dt : dts) {
+        for (auto op : ops) {
+            for (auto n : n_srcs) {
+                suite.emplace_back(new ucc_bench_ec_reduce(
+                    dt, op, n, UCC_BENCH_EC_REDUCE_COUNT));
+            }
+        }
+    }
+}
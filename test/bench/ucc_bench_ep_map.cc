@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_bench.h"
+#include <vector>
+BEGIN_C_DECLS
+#include "utils/ucc_coll_utils.h"
+END_C_DECLS
+
+/* power of 2, so that rank wraps around with a mask */
+#define UCC_BENCH_EP_MAP_SIZE 64
+
+static const char *ucc_bench_ep_map_names[] = {"", "full", "strided",
+                                               "array", "cb"};
+
+static uint64_t ucc_bench_ep_map_cb(uint64_t ep, void *cb_ctx)
+{
+    return ((ucc_rank_t *)cb_ctx)[ep];
+}
+
+/* ucc_ep_map_eval of a single rank, ranks go over the whole map */
+class ucc_bench_ep_map : public ucc_bench_case {
+    ucc_ep_map_type_t       type;
+    ucc_ep_map_t            map;
+    std::vector<ucc_rank_t> ranks;
+
+public:
+    ucc_bench_ep_map(ucc_ep_map_type_t t) :
+        ucc_bench_case("ep_map",
+                       std::string("type=") + ucc_bench_ep_map_names[t] +
+                       ",size=" + std::to_string(UCC_BENCH_EP_MAP_SIZE)),
+        type(t) {}
+
+    ucc_status_t setup() override
+    {
+        ucc_rank_t i;
+
+        /* 37 is coprime with map size, gives a non strided permutation */
+        ranks.resize(UCC_BENCH_EP_MAP_SIZE);
+        for (i = 0; i < UCC_BENCH_EP_MAP_SIZE; i++) {
+            ranks[i] = (i * 37) % UCC_BENCH_EP_MAP_SIZE;
+        }
+        map.type   = type;
+        map.ep_num = UCC_BENCH_EP_MAP_SIZE;
+        switch (type) {
+        case UCC_EP_MAP_FULL:
+            break;
+        case UCC_EP_MAP_STRIDED:
+            map.strided.start  = UCC_BENCH_EP_MAP_SIZE - 1;
+            map.strided.stride = -1;
+            break;
+        case UCC_EP_MAP_ARRAY:
+            map.array.map       = ranks.data();
+            map.array.elem_size = sizeof(ucc_rank_t);
+            break;
+        case UCC_EP_MAP_CB:
+            map.cb.cb     = ucc_bench_ep_map_cb;
+            map.cb.cb_ctx = ranks.data();
+            break;
+        default:
+            return UCC_ERR_NOT_SUPPORTED;
+        }
+        return UCC_OK;
+    }
+
+    ucc_status_t run(size_t n_iters) override
+    {
+        ucc_rank_t sum = 0;
+        size_t     it;
+
+        for (it = 0; it < n_iters; it++) {
+            sum += ucc_ep_map_eval(map, it & (UCC_BENCH_EP_MAP_SIZE - 1));
+        }
+        ucc_bench_keep(sum);
+        return UCC_OK;
+    }
+};
+
+void ucc_bench_add_ep_map(ucc_bench_suite_t &suite)
+{
+    const ucc_ep_map_type_t types[] = {UCC_EP_MAP_FULL, UCC_EP_MAP_STRIDED,
+                                       UCC_EP_MAP_ARRAY, UCC_EP_MAP_CB};
+
+    for (auto t : types) {
+        suite.emplace_back(new ucc_bench_ep_map(t));
+    }
+}
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_bench.h"
+#include <pthread.h>
+#include <climits>
+BEGIN_C_DECLS
+#include "utils/ucc_mpool.h"
+#include "utils/arch/cpu.h"
+END_C_DECLS
+
+#define UCC_BENCH_MPOOL_ELEM_SIZE 512
+
+/* ucc_mpool_get/put pair. In MT mode the pool is protected by spinlock and
+ * n_threads threads, including the calling one, run get/put concurrently.
+ * Reported time is per get/put pair of a single thread */
+class ucc_bench_mpool : public ucc_bench_case {
+    ucc_thread_mode_t  tm;
+    int                n_threads;
+    ucc_mpool_t        mp;
+    bool               mp_inited;
+    pthread_t         *threads;
+    pthread_barrier_t  barrier;
+    size_t             n_iters;
+    bool               stop;
+    ucc_status_t       status;
+
+    static void *worker(void *arg)
+    {
+        ucc_bench_mpool *b = (ucc_bench_mpool *)arg;
+
+        while (1) {
+            pthread_barrier_wait(&b->barrier);
+            if (b->stop) {
+                break;
+            }
+            b->get_put(b->n_iters);
+            pthread_barrier_wait(&b->barrier);
+        }
+        return NULL;
+    }
+
+    void get_put(size_t n)
+    {
+        size_t it;
+        void  *obj;
+
+        for (it = 0; it < n; it++) {
+            obj = ucc_mpool_get(&mp);
+            if (!obj) {
+                status = UCC_ERR_NO_MEMORY;
+                return;
+            }
+            ucc_bench_keep(obj);
+            ucc_mpool_put(obj);
+        }
+    }
+
+public:
+    ucc_bench_mpool(ucc_thread_mode_t t, int n) :
+        ucc_bench_case("mpool", std::string("tm=") +
+                       (t == UCC_THREAD_SINGLE ? "st" : "mt") +
+                       ",threads=" + std::to_string(n)),
+        tm(t), n_threads(n), mp_inited(false), threads(nullptr),
+        n_iters(0), stop(false), status(UCC_OK) {}
+
+    ucc_status_t setup() override
+    {
+        ucc_status_t st;
+        int          i;
+
+        st = ucc_mpool_init(&mp, 0, UCC_BENCH_MPOOL_ELEM_SIZE, 0,
+                            UCC_CACHE_LINE_SIZE, 16, UINT_MAX, NULL, tm,
+                            "bench_mp");
+        if (st != UCC_OK) {
+            return st;
+        }
+        mp_inited = true;
+        if (n_threads == 1) {
+            return UCC_OK;
+        }
+        stop    = false;
+        threads = new pthread_t[n_threads - 1];
+        pthread_barrier_init(&barrier, NULL, n_threads);
+        for (i = 0; i < n_threads - 1; i++) {
+            pthread_create(&threads[i], NULL, &worker, this);
+        }
+        return UCC_OK;
+    }
+
+    ucc_status_t run(size_t n) override
+    {
+        status = UCC_OK;
+        if (n_threads == 1) {
+            get_put(n);
+            return status;
+        }
+        n_iters = n;
+        pthread_barrier_wait(&barrier);
+        get_put(n);
+        pthread_barrier_wait(&barrier);
+        return status;
+    }
+
+    void cleanup() override
+    {
+        int i;
+
+        if (threads) {
+            stop = true;
+            pthread_barrier_wait(&barrier);
+            for (i = 0; i < n_threads - 1; i++) {
+                pthread_join(threads[i], NULL);
+            }
+            pthread_barrier_destroy(&barrier);
+            delete[] threads;
+            threads = nullptr;
+        }
+        if (mp_inited) {
+            ucc_mpool_cleanup(&mp, 1);
+            mp_inited = false;
+        }
+    }
+};
+
+void ucc_bench_add_mpool(ucc_bench_suite_t &suite)
+{
+    suite.emplace_back(new ucc_bench_mpool(UCC_THREAD_SINGLE, 1));
+    suite.emplace_back(new ucc_bench_mpool(UCC_THREAD_MULTIPLE, 1));
+    suite.emplace_back(new ucc_bench_mpool(UCC_THREAD_MULTIPLE, 2));
+    suite.emplace_back(new ucc_bench_mpool(UCC_THREAD_MULTIPLE, 4));
+}
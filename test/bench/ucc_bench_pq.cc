@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_bench.h"
+#include <vector>
+BEGIN_C_DECLS
+#include "core/ucc_progress_queue.h"
+END_C_DECLS
+
+typedef enum {
+    UCC_BENCH_PQ_ST,
+    UCC_BENCH_PQ_MT_LOCKED,
+    UCC_BENCH_PQ_MT_LF,
+} ucc_bench_pq_type_t;
+
+static const char *ucc_bench_pq_names[] = {"st", "mt_locked", "mt_lf"};
+
+static void ucc_bench_pq_progress_done(ucc_coll_task_t *task)
+{
+    task->status = UCC_OK;
+}
+
+static void ucc_bench_pq_progress_busy(ucc_coll_task_t *task) //NOLINT: unused
+{
+}
+
+/* Enqueue of a task into progress queue and progress of the queue until
+ * the task is completed and removed. depth - 1 tasks which never complete
+ * stay in the queue, so that progress has to go over them as it would do
+ * for outstanding collectives */
+class ucc_bench_pq : public ucc_bench_case {
+    ucc_bench_pq_type_t           type;
+    int                           depth;
+    ucc_progress_queue_t         *pq;
+    std::vector<ucc_coll_task_t>  tasks;
+
+    static void task_reset(ucc_coll_task_t *task, ucc_coll_progress_fn_t fn)
+    {
+        ucc_coll_task_construct(task);
+        ucc_coll_task_init(task, NULL, NULL);
+        task->progress     = fn;
+        task->status       = UCC_INPROGRESS;
+        task->super.status = UCC_INPROGRESS;
+    }
+
+public:
+    ucc_bench_pq(ucc_bench_pq_type_t t, int d) :
+        ucc_bench_case("progress_queue",
+                       std::string("type=") + ucc_bench_pq_names[t] +
+                       ",depth=" + std::to_string(d)),
+        type(t), depth(d), pq(nullptr) {}
+
+    ucc_status_t setup() override
+    {
+        ucc_thread_mode_t tm = (type == UCC_BENCH_PQ_ST) ? UCC_THREAD_SINGLE :
+                                                           UCC_THREAD_MULTIPLE;
+        ucc_status_t      st;
+        int               i;
+
+        st = ucc_progress_queue_init(&pq, tm, type == UCC_BENCH_PQ_MT_LF);
+        if (st != UCC_OK) {
+            return st;
+        }
+        tasks.resize(depth);
+        task_reset(&tasks[0], ucc_bench_pq_progress_done);
+        for (i = 1; i < depth; i++) {
+            task_reset(&tasks[i], ucc_bench_pq_progress_busy);
+            ucc_progress_enqueue(pq, &tasks[i]);
+        }
+        return UCC_OK;
+    }
+
+    ucc_status_t run(size_t n_iters) override
+    {
+        ucc_coll_task_t *task = &tasks[0];
+        size_t           it;
+        int              ret;
+
+        for (it = 0; it < n_iters; it++) {
+            task->status       = UCC_INPROGRESS;
+            task->super.status = UCC_INPROGRESS;
+            ucc_lf_queue_init_elem(&task->lf_elem);
+            ucc_progress_enqueue(pq, task);
+            do {
+                ret = ucc_progress_queue(pq);
+                if (ret < 0) {
+                    return (ucc_status_t)ret;
+                }
+            } while (task->status != UCC_OK);
+        }
+        return UCC_OK;
+    }
+
+    void cleanup() override
+    {
+        int i, n_done;
+
+        for (i = 1; i < depth; i++) {
+            tasks[i].progress = ucc_bench_pq_progress_done;
+        }
+        do {
+            ucc_progress_queue(pq);
+            for (i = 1, n_done = 1; i < depth; i++) {
+                n_done += (tasks[i].status == UCC_OK);
+            }
+        } while (n_done < depth);
+        for (auto &t : tasks) {
+            ucc_coll_task_destruct(&t);
+        }
+        tasks.clear();
+        ucc_progress_queue_finalize(pq);
+        pq = nullptr;
+    }
+};
+
+void ucc_bench_add_pq(ucc_bench_suite_t &suite)
+{
+    const ucc_bench_pq_type_t types[]  = {UCC_BENCH_PQ_ST,
+                                          UCC_BENCH_PQ_MT_LOCKED,
+                                          UCC_BENCH_PQ_MT_LF};
+    const int                 depths[] = {1, 16};
+
+    for (auto t : types) {
+        for (auto d : depths) {
+            suite.emplace_back(new ucc_bench_pq(t, d));
+        }
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "config.h"
+#include "ucc_bench.h"
+#include <cstring>
+BEGIN_C_DECLS
+#include "coll_score/ucc_coll_score.h"
+#include "schedule/ucc_schedule.h"
+END_C_DECLS
+
+#define UCC_BENCH_SCORE_RANGE_SIZE 4096
+
+static ucc_coll_task_t ucc_bench_score_task;
+
+static ucc_status_t
+ucc_bench_score_init(ucc_base_coll_args_t *coll_args, //NOLINT: unused
+                     ucc_base_team_t *team, ucc_coll_task_t **task) //NOLINT
+{
+    *task = &ucc_bench_score_task;
+    return UCC_OK;
+}
+
+/* Allreduce selection by ucc_coll_init over a score map with n_ranges
+ * msg ranges of host memory. Init function is a stub, so the measured time
+ * is that of ucc_coll_score_map_lookup. Message falls either into the first
+ * or into the last range of the list */
+class ucc_bench_score_map : public ucc_bench_case {
+    int                  n_ranges;
+    bool                 last;
+    ucc_base_team_t      team;
+    ucc_score_map_t     *map;
+    ucc_base_coll_args_t bargs;
+
+public:
+    ucc_bench_score_map(int n, bool l) :
+        ucc_bench_case("score_map",
+                       "coll=allreduce,n_ranges=" + std::to_string(n) +
+                       ",range=" + (l ? "last" : "first")),
+        n_ranges(n), last(l), map(nullptr)
+    {
+        memset(&team, 0, sizeof(team));
+        memset(&bargs, 0, sizeof(bargs));
+    }
+
+    ucc_status_t setup() override
+    {
+        ucc_coll_score_t *score;
+        ucc_status_t      st;
+        size_t            start, end, msgsize;
+        int               i;
+
+        team.params.size = 8;
+        team.params.rank = 0;
+        st = ucc_coll_score_alloc(&score);
+        if (st != UCC_OK) {
+            return st;
+        }
+        for (i = 0; i < n_ranges; i++) {
+            start = (size_t)i * UCC_BENCH_SCORE_RANGE_SIZE;
+            end   = (i == n_ranges - 1) ? UCC_MSG_MAX :
+                    start + UCC_BENCH_SCORE_RANGE_SIZE - 1;
+            st    = ucc_coll_score_add_range(score, UCC_COLL_TYPE_ALLREDUCE,
+                                             UCC_MEMORY_TYPE_HOST, start, end,
+                                             10 + i, ucc_bench_score_init,
+                                             &team);
+            if (st != UCC_OK) {
+                ucc_coll_score_free(score);
+                return st;
+            }
+        }
+        st = ucc_coll_score_build_map(score, &map);
+        if (st != UCC_OK) {
+            ucc_coll_score_free(score);
+            return st;
+        }
+
+        msgsize = last ? (size_t)(n_ranges - 1) * UCC_BENCH_SCORE_RANGE_SIZE +
+                         sizeof(float) : sizeof(float);
+        bargs.args.coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+        bargs.args.op                = UCC_OP_SUM;
+        bargs.args.src.info.count    = msgsize / sizeof(float);
+        bargs.args.src.info.datatype = UCC_DT_FLOAT32;
+        bargs.args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        bargs.args.dst.info          = bargs.args.src.info;
+        return UCC_OK;
+    }
+
+    ucc_status_t run(size_t n_iters) override
+    {
+        ucc_coll_task_t *task;
+        ucc_status_t     st;
+        size_t           it;
+
+        for (it = 0; it < n_iters; it++) {
+            st = ucc_coll_init(map, &bargs, &task);
+            if (st != UCC_OK) {
+                return st;
+            }
+            ucc_bench_keep(task);
+        }
+        return UCC_OK;
+    }
+
+    void cleanup() override
+    {
+        if (map) {
+            ucc_coll_score_free_map(map);
+            map = nullptr;
+        }
+    }
+};
+
+void ucc_bench_add_score_map(ucc_bench_suite_t &suite)
+{
+    const int n_ranges[] = {1, 4, 16};
+
+    for (auto n : n_ranges) {
+        suite.emplace_back(new ucc_bench_score_map(n, false));
+        if (n > 1) {
+            suite.emplace_back(new ucc_bench_score_map(n, true));
+        }
+    }
+}
@@ -5,6 +5,7 @@
 
 #include "common/test_ucc.h"
 #include <unordered_set>
+#include <cmath>
 
 typedef std::tuple<uint64_t, uint64_t, int64_t, uint64_t, size_t,
                    ucc_memory_type_t> op_t;
@@ -238,3 +239,186 @@ INSTANTIATE_TEST_CASE_P
             ::testing::Values(16) // n_procs
         )
 );
+
+/* root, start, stride, size */
+typedef std::tuple<uint64_t, uint64_t, int64_t, uint64_t> aset_t;
+using Param_coll = std::tuple<ucc_coll_type_t, aset_t>;
+
+class test_active_set_coll : public ucc::test,
+                             public ::testing::WithParamInterface<Param_coll>
+{
+public:
+    static const size_t count = 5;
+    UccCollCtxVec       ctxs;
+
+    void data_init(ucc_coll_type_t coll_type, aset_t aset, UccTeam_h team,
+                   ucc_reduction_op_t op = UCC_OP_SUM)
+    {
+        ucc_rank_t tsize  = team->procs.size();
+        uint64_t   root   = std::get<0>(aset);
+        uint64_t   start  = std::get<1>(aset);
+        int64_t    stride = std::get<2>(aset);
+        uint64_t   size   = std::get<3>(aset);
+        size_t     dsize  = count;
+
+        if (coll_type == UCC_COLL_TYPE_ALLGATHER ||
+            coll_type == UCC_COLL_TYPE_GATHER) {
+            dsize *= size;
+        }
+        ctxs.assign(tsize, NULL);
+        for (uint64_t p = 0; p < size; p++) {
+            int              r    = (int)(start + stride * (int64_t)p);
+            ucc_coll_args_t *coll = (ucc_coll_args_t *)
+                calloc(1, sizeof(ucc_coll_args_t));
+
+            ctxs[r] = (gtest_ucc_coll_ctx_t *)
+                calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args     = coll;
+            coll->mask        = UCC_COLL_ARGS_FIELD_ACTIVE_SET;
+            coll->coll_type   = coll_type;
+            coll->root        = root;
+            coll->op          = op;
+            coll->active_set.size   = size;
+            coll->active_set.start  = start;
+            coll->active_set.stride = stride;
+            if (coll_type == UCC_COLL_TYPE_BARRIER) {
+                continue;
+            }
+            UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header,
+                                   count * sizeof(int32_t),
+                                   UCC_MEMORY_TYPE_HOST));
+            for (size_t k = 0; k < count; k++) {
+                if (op == UCC_OP_AVG) {
+                    ((float *)ctxs[r]->src_mc_header->addr)[k] = (float)p + 1;
+                } else {
+                    ((int32_t *)ctxs[r]->src_mc_header->addr)[k] =
+                        (int32_t)p + 1;
+                }
+            }
+            coll->src.info.buffer   = ctxs[r]->src_mc_header->addr;
+            coll->src.info.count    = count;
+            coll->src.info.datatype = (op == UCC_OP_AVG) ? UCC_DT_FLOAT32 :
+                                                           UCC_DT_INT32;
+            coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            if ((coll_type == UCC_COLL_TYPE_REDUCE ||
+                 coll_type == UCC_COLL_TYPE_GATHER) && r != (int)root) {
+                continue;
+            }
+            ctxs[r]->rbuf_size = dsize * sizeof(int32_t);
+            UCC_CHECK(ucc_mc_alloc(&ctxs[r]->dst_mc_header,
+                                   ctxs[r]->rbuf_size, UCC_MEMORY_TYPE_HOST));
+            coll->dst.info.buffer   = ctxs[r]->dst_mc_header->addr;
+            coll->dst.info.count    = dsize;
+            coll->dst.info.datatype = coll->src.info.datatype;
+            coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+        }
+    }
+
+    void data_fini()
+    {
+        for (auto ctx : ctxs) {
+            if (!ctx) {
+                continue;
+            }
+            if (ctx->src_mc_header) {
+                UCC_CHECK(ucc_mc_free(ctx->src_mc_header));
+            }
+            if (ctx->dst_mc_header) {
+                UCC_CHECK(ucc_mc_free(ctx->dst_mc_header));
+            }
+            free(ctx->args);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
+
+    bool data_validate(ucc_coll_type_t coll_type, uint64_t size,
+                       ucc_reduction_op_t op = UCC_OP_SUM)
+    {
+        int32_t sum = (int32_t)(size * (size + 1) / 2);
+
+        for (auto ctx : ctxs) {
+            if (!ctx || !ctx->dst_mc_header) {
+                continue;
+            }
+            if (op == UCC_OP_AVG) {
+                /* average over active set members, not over the team */
+                float *dst = (float *)ctx->dst_mc_header->addr;
+                for (size_t k = 0; k < ctx->args->dst.info.count; k++) {
+                    if (fabsf(dst[k] - (float)sum / size) > 1e-5f) {
+                        return false;
+                    }
+                }
+                continue;
+            }
+            int32_t *dst = (int32_t *)ctx->dst_mc_header->addr;
+            for (size_t k = 0; k < ctx->args->dst.info.count; k++) {
+                int32_t expected = (coll_type == UCC_COLL_TYPE_ALLREDUCE ||
+                                    coll_type == UCC_COLL_TYPE_REDUCE)
+                                       ? sum
+                                       : (int32_t)(k / count) + 1;
+                if (dst[k] != expected) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+UCC_TEST_P(test_active_set_coll, single)
+{
+    const ucc_coll_type_t coll_type = std::get<0>(GetParam());
+    const aset_t          aset      = std::get<1>(GetParam());
+    const int             n_procs   = 8;
+    ucc_job_env_t         env       = {{"UCC_CLS", "basic"}};
+    UccJob                job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h             team      = job.create_team(n_procs);
+
+    data_init(coll_type, aset, team);
+    UccReq req(team, ctxs);
+    req.start();
+    req.wait();
+    EXPECT_EQ(true, data_validate(coll_type, std::get<3>(aset)));
+    data_fini();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_active_set_coll,
+    ::testing::Combine(
+        ::testing::Values(UCC_COLL_TYPE_ALLREDUCE, UCC_COLL_TYPE_REDUCE,
+                          UCC_COLL_TYPE_ALLGATHER, UCC_COLL_TYPE_BARRIER,
+                          UCC_COLL_TYPE_GATHER),
+        ::testing::Values(aset_t(0, 0, 1, 8),   // subset == full set
+                          aset_t(2, 0, 2, 4),   // even ranks
+                          aset_t(5, 7, -2, 3),  // reverse stride
+                          aset_t(6, 1, 5, 2),   // pt2pt
+                          aset_t(4, 1, 3, 3))));
+
+class test_active_set_avg : public test_active_set_coll {};
+
+UCC_TEST_P(test_active_set_avg, single)
+{
+    const ucc_coll_type_t coll_type = std::get<0>(GetParam());
+    const aset_t          aset      = std::get<1>(GetParam());
+    const int             n_procs   = 8;
+    ucc_job_env_t         env       = {{"UCC_CLS", "basic"}};
+    UccJob                job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h             team      = job.create_team(n_procs);
+
+    data_init(coll_type, aset, team, UCC_OP_AVG);
+    UccReq req(team, ctxs);
+    CHECK_REQ_NOT_SUPPORTED_SKIP(req, data_fini());
+    req.start();
+    req.wait();
+    EXPECT_EQ(true, data_validate(coll_type, std::get<3>(aset), UCC_OP_AVG));
+    data_fini();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_active_set_avg,
+    ::testing::Combine(
+        ::testing::Values(UCC_COLL_TYPE_ALLREDUCE, UCC_COLL_TYPE_REDUCE),
+        ::testing::Values(aset_t(2, 0, 2, 4),   // even ranks
+                          aset_t(5, 7, -2, 3),  // reverse stride
+                          aset_t(4, 1, 3, 3))));
@@ -288,7 +288,28 @@ TYPED_TEST(test_allreduce_cuda, multiple_inplace_managed) {
 
 template<typename T>
 class test_allreduce_alg : public test_allreduce<T>
-{};
+{
+  public:
+    /* keeps every stride-th element of host data, the rest is zero */
+    void sparsify(UccCollCtxVec &ctxs, int stride)
+    {
+        for (int r = 0; r < ctxs.size(); r++) {
+            ucc_coll_args_t  *coll  = ctxs[r]->args;
+            size_t            count = coll->dst.info.count;
+            typename T::type *init  = (typename T::type *)ctxs[r]->init_buf;
+            void             *buf   = UCC_IS_INPLACE(*coll) ?
+                                      coll->dst.info.buffer :
+                                      coll->src.info.buffer;
+
+            for (size_t i = 0; i < count; i++) {
+                if ((i + r) % stride) {
+                    init[i] = 0;
+                }
+            }
+            memcpy(buf, init, count * sizeof(typename T::type));
+        }
+    }
+};
 
 using test_allreduce_alg_type = ::testing::Types<TypeOpPair<UCC_DT_INT32, sum>>;
 TYPED_TEST_CASE(test_allreduce_alg, test_allreduce_alg_type);
@@ -368,6 +389,83 @@ TYPED_TEST(test_allreduce_alg, dbt) {
     }
 }
 
+TYPED_TEST(test_allreduce_alg, sparse) {
+    int           n_procs = 15;
+    ucc_job_env_t env     = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", "allreduce:@sparse:inf"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team   = job.create_team(n_procs);
+    int           repeat = 3;
+    UccCollCtxVec ctxs;
+
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    /* stride 1 keeps the data dense, 64 starts sparse and gets denser */
+    for (auto stride : {1, 64, 4096}) {
+        for (auto count : {65536, 123567}) {
+            for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+                this->set_inplace(inplace);
+                this->data_init(n_procs, TypeParam::dt, count, ctxs, true);
+                this->sparsify(ctxs, stride);
+                UccReq req(team, ctxs);
+
+                for (auto i = 0; i < repeat; i++) {
+                    req.start();
+                    req.wait();
+                    EXPECT_EQ(true, this->data_validate(ctxs));
+                    this->reset(ctxs);
+                }
+                this->data_fini(ctxs);
+            }
+        }
+    }
+}
+
+template<typename T>
+class test_allreduce_reduced_precision : public test_allreduce<T> {};
+
+using test_allreduce_reduced_precision_type =
+    ::testing::Types<TypeOpPair<UCC_DT_FLOAT32, sum>>;
+TYPED_TEST_CASE(test_allreduce_reduced_precision,
+                test_allreduce_reduced_precision_type);
+
+/* init values are small integers, partial sums are exact in 16 bit floats */
+TYPED_TEST(test_allreduce_reduced_precision, sra_knomial) {
+    int           n_procs = 15;
+    int           repeat  = 3;
+    UccCollCtxVec ctxs;
+
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    for (auto wire_dt : {"bf16", "fp16"}) {
+        ucc_job_env_t env = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", "allreduce:@sra_knomial:inf"},
+                             {"UCC_TL_UCP_ALLREDUCE_SRA_KN_PIPELINE",
+                              "thresh=1024:nfrags=11"},
+                             {"UCC_TL_UCP_REDUCE_WIRE_DT", wire_dt}};
+        UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+        UccTeam_h     team = job.create_team(n_procs);
+
+        for (auto count : {65536, 123567}) {
+            for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+                this->set_inplace(inplace);
+                this->data_init(n_procs, TypeParam::dt, count, ctxs, true);
+                for (auto &c : ctxs) {
+                    c->args->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+                    c->args->flags |= UCC_COLL_ARGS_FLAG_REDUCED_PRECISION;
+                }
+                UccReq req(team, ctxs);
+
+                for (auto i = 0; i < repeat; i++) {
+                    req.start();
+                    req.wait();
+                    EXPECT_EQ(true, this->data_validate(ctxs));
+                    this->reset(ctxs);
+                }
+                this->data_fini(ctxs);
+            }
+        }
+    }
+}
+
 TYPED_TEST(test_allreduce_alg, rab) {
     int           n_procs = 15;
     ucc_job_env_t env     = {{"UCC_CL_HIER_TUNE", "allreduce:@rab:0-inf:inf"},
@@ -437,6 +535,37 @@ TYPED_TEST(test_allreduce_alg, rab_pipelined) {
     }
 }
 
+TYPED_TEST(test_allreduce_alg, rab_intra_node_level) {
+    int           n_procs = 15;
+    int           repeat  = 3;
+    UccCollCtxVec ctxs;
+
+    for (auto level : {"socket", "numa"}) {
+        ucc_job_env_t env  = {{"UCC_CL_HIER_TUNE", "allreduce:@rab:0-inf:inf"},
+                              {"UCC_CL_HIER_INTRA_NODE_LEVEL", level},
+                              {"UCC_CLS", "all"}};
+        UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+        UccTeam_h     team = job.create_team(n_procs);
+
+        for (auto count : {8, 65536}) {
+            for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+                SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+                this->set_inplace(inplace);
+                this->data_init(n_procs, TypeParam::dt, count, ctxs, true);
+                UccReq req(team, ctxs);
+
+                for (auto i = 0; i < repeat; i++) {
+                    req.start();
+                    req.wait();
+                    EXPECT_EQ(true, this->data_validate(ctxs));
+                    this->reset(ctxs);
+                }
+                this->data_fini(ctxs);
+            }
+        }
+    }
+}
+
 #ifdef HAVE_UCX
 TYPED_TEST(test_allreduce_alg, sliding_window)
 {
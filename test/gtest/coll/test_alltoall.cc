@@ -5,6 +5,12 @@
 
 #include "common/test_ucc.h"
 #include "utils/ucc_math.h"
+#ifdef HAVE_UCX
+extern "C" {
+#include "core/ucc_context.h"
+#include "components/tl/ucp/tl_ucp.h"
+}
+#endif
 
 using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, gtest_ucc_inplace_t, int>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, gtest_ucc_inplace_t, int>;
@@ -273,6 +279,106 @@ UCC_TEST_P(test_alltoall_0, single_persistent)
     data_fini(ctxs);
 }
 
+/* endpoint cache smaller than the team: every call evicts and reconnects */
+UCC_TEST_F(test_alltoall, max_eps)
+{
+    const int       size    = 8;
+    const int       n_calls = 3;
+    ucc_job_env_t   env     = {{"UCC_TL_UCP_MAX_EPS", "2"},
+                               {"UCC_CL_BASIC_TUNE", "inf"},
+                               {"UCC_TL_UCP_TUNE", "alltoall:@pairwise:inf"}};
+    UccJob          job(size, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h       team    = job.create_team(size);
+    UccCollCtxVec   ctxs;
+
+    this->set_inplace(TEST_NO_INPLACE);
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+
+    data_init(size, UCC_DT_INT32, 1024, ctxs, true);
+    UccReq req(team, ctxs);
+
+    for (auto i = 0; i < n_calls; i++) {
+        req.start();
+        req.wait();
+        EXPECT_EQ(true, data_validate(ctxs));
+        reset(ctxs);
+    }
+    data_fini(ctxs);
+#ifdef HAVE_UCX
+    for (auto &p : job.procs) {
+        ucc_tl_ucp_context_t *tl_ctx = NULL;
+        ucc_tl_lib_t         *tl_lib;
+
+        for (unsigned i = 0; i < p->ctx_h->n_tl_ctx; i++) {
+            tl_lib = ucc_derived_of(p->ctx_h->tl_ctx[i]->super.lib,
+                                    ucc_tl_lib_t);
+            if (0 == strcmp(tl_lib->iface->super.name, "ucp")) {
+                tl_ctx = ucc_derived_of(p->ctx_h->tl_ctx[i],
+                                        ucc_tl_ucp_context_t);
+            }
+        }
+        ASSERT_NE(nullptr, tl_ctx);
+        EXPECT_LT(0u, tl_ctx->worker.n_ep_evictions);
+        EXPECT_LT(0u, tl_ctx->worker.n_ep_reconnects);
+    }
+#endif
+}
+
+UCC_TEST_F(test_alltoall, bruck_radix)
+{
+    const int size = 13;
+
+    this->set_inplace(TEST_NO_INPLACE);
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+
+    for (auto radix : {"3", "4", "0-64:16,5"}) {
+        ucc_job_env_t env  = {{"UCC_TL_UCP_ALLTOALL_BRUCK_RADIX", radix},
+                              {"UCC_CL_BASIC_TUNE", "inf"},
+                              {"UCC_TL_UCP_TUNE", "alltoall:@bruck:inf"}};
+        UccJob        job(size, UccJob::UCC_JOB_CTX_GLOBAL, env);
+        UccTeam_h     team = job.create_team(size);
+        UccCollCtxVec ctxs;
+
+        for (auto count : {1, 5}) {
+            data_init(size, UCC_DT_INT32, count, ctxs, true);
+            UccReq req(team, ctxs);
+
+            req.start();
+            req.wait();
+            EXPECT_EQ(true, data_validate(ctxs));
+            data_fini(ctxs);
+        }
+    }
+}
+
+UCC_TEST_F(test_alltoall, node_aggr)
+{
+    const int       size    = 16;
+    const int       n_calls = 3;
+    ucc_job_env_t   env     = {{"UCC_CL_HIER_TUNE",
+                                "alltoall:@node_aggr:0-inf:inf"},
+                               {"UCC_CLS", "all"}};
+    UccJob          job(size, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h       team    = job.create_team(size);
+    UccCollCtxVec   ctxs;
+
+    this->set_inplace(TEST_NO_INPLACE);
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+
+    for (auto count : {1, 7, 256}) {
+        data_init(size, UCC_DT_INT32, count, ctxs, true);
+        UccReq req(team, ctxs);
+
+        for (auto i = 0; i < n_calls; i++) {
+            req.start();
+            req.wait();
+            EXPECT_EQ(true, data_validate(ctxs));
+            reset(ctxs);
+        }
+        data_fini(ctxs);
+    }
+}
+
 INSTANTIATE_TEST_CASE_P(
     , test_alltoall_0,
     ::testing::Combine(
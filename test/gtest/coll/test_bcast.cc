@@ -276,6 +276,13 @@ ucc_job_env_t two_step_env = {{"UCC_CL_HIER_TUNE", "bcast:@2step:0-inf:inf"},
                               {"UCC_CLS", "all"}};
 ucc_job_env_t dbt_env      = {{"UCC_TL_UCP_TUNE", "bcast:@dbt:0-inf:inf"},
                               {"UCC_CLS", "basic"}};
+ucc_job_env_t socket_env   = {{"UCC_CL_HIER_TUNE", "bcast:@2step:0-inf:inf"},
+                              {"UCC_CL_HIER_INTRA_NODE_LEVEL", "socket"},
+                              {"UCC_CLS", "all"}};
+/* every root goes through conversion into the reordered rank space */
+ucc_job_env_t reorder_env  = {{"UCC_TL_UCP_TUNE", "bcast:@knomial:0-inf:inf"},
+                              {"UCC_TL_UCP_RANKS_REORDERING", "y"},
+                              {"UCC_CLS", "basic"}};
 INSTANTIATE_TEST_CASE_P(
     , test_bcast_alg,
     ::testing::Combine(
@@ -285,6 +292,7 @@ INSTANTIATE_TEST_CASE_P(
 #else
         ::testing::Values(UCC_MEMORY_TYPE_HOST),
 #endif
-        ::testing::Values(two_step_env, dbt_env), //env
+        ::testing::Values(two_step_env, dbt_env, socket_env,
+                          reorder_env), //env
         ::testing::Values(8, 65536), // count
         ::testing::Values(15,16))); // n_procs
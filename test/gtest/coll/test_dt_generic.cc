@@ -0,0 +1,340 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * See file LICENSE for terms.
+ */
+
+#include "common/test_ucc.h"
+#include <algorithm>
+
+/* Non contiguous generic datatype: int32 value followed by 4 bytes hole.
+   Packed stream is the sequence of the values. */
+#define DTG_EXTENT 8
+#define DTG_PACKED 4
+#define DTG_HOLE   ((int32_t)-1)
+
+typedef struct dtg_state {
+    uint8_t *buffer;
+    size_t   count;
+} dtg_state_t;
+
+static void *dtg_start(void *context, const void *buffer, //NOLINT
+                       size_t count)
+{
+    dtg_state_t *s = new dtg_state_t;
+
+    s->buffer = (uint8_t *)buffer;
+    s->count  = count;
+    return s;
+}
+
+static void *dtg_start_pack(void *context, const void *buffer, size_t count)
+{
+    return dtg_start(context, buffer, count);
+}
+
+static void *dtg_start_unpack(void *context, void *buffer, size_t count)
+{
+    return dtg_start(context, buffer, count);
+}
+
+static size_t dtg_packed_size(void *state)
+{
+    return ((dtg_state_t *)state)->count * DTG_PACKED;
+}
+
+/* offset and length are not required to be aligned to the packed element */
+static inline uint8_t *dtg_byte(dtg_state_t *s, size_t offset)
+{
+    return s->buffer + (offset / DTG_PACKED) * DTG_EXTENT +
+           offset % DTG_PACKED;
+}
+
+static size_t dtg_pack(void *state, size_t offset, void *dest,
+                       size_t max_length)
+{
+    dtg_state_t *s   = (dtg_state_t *)state;
+    size_t       len = std::min(max_length, dtg_packed_size(s) - offset);
+
+    for (size_t i = 0; i < len; i++) {
+        ((uint8_t *)dest)[i] = *dtg_byte(s, offset + i);
+    }
+    return len;
+}
+
+static ucc_status_t dtg_unpack(void *state, size_t offset, const void *src,
+                               size_t length)
+{
+    dtg_state_t *s = (dtg_state_t *)state;
+
+    if (offset + length > dtg_packed_size(s)) {
+        return UCC_ERR_MESSAGE_TRUNCATED;
+    }
+    for (size_t i = 0; i < length; i++) {
+        *dtg_byte(s, offset + i) = ((const uint8_t *)src)[i];
+    }
+    return UCC_OK;
+}
+
+static void dtg_finish(void *state)
+{
+    delete (dtg_state_t *)state;
+}
+
+/* coll type, count per rank */
+using Param_dt_generic = std::tuple<ucc_coll_type_t, size_t>;
+
+class test_dt_generic : public ucc::test,
+                        public ::testing::WithParamInterface<Param_dt_generic>
+{
+public:
+    ucc_datatype_t                     dt;
+    UccCollCtxVec                      ctxs;
+    std::vector<std::vector<int32_t>>  sbufs, rbufs;
+    std::vector<std::vector<int>>      counts, displs;
+
+    test_dt_generic()
+    {
+        ucc_generic_dt_ops_t ops = {};
+
+        ops.start_pack   = dtg_start_pack;
+        ops.start_unpack = dtg_start_unpack;
+        ops.packed_size  = dtg_packed_size;
+        ops.pack         = dtg_pack;
+        ops.unpack       = dtg_unpack;
+        ops.finish       = dtg_finish;
+        EXPECT_EQ(UCC_OK, ucc_dt_create_generic(&ops, NULL, &dt));
+    }
+
+    ~test_dt_generic()
+    {
+        ucc_dt_destroy(dt);
+    }
+
+    static int32_t value(ucc_rank_t r, size_t i)
+    {
+        return (int32_t)(r * (1 << 20) + i);
+    }
+
+    /* number of elements rank "r" sends to "peer" in alltoallv */
+    static size_t a2av_count(size_t count, ucc_rank_t r, ucc_rank_t peer)
+    {
+        return count + (r + peer) % 3;
+    }
+
+    /* buffer of "count" elements, holes are filled and checked later */
+    static void buf_init(std::vector<int32_t> &buf, size_t count)
+    {
+        buf.assign(count * DTG_EXTENT / sizeof(int32_t), DTG_HOLE);
+    }
+
+    static void buf_set(std::vector<int32_t> &buf, size_t i, int32_t v)
+    {
+        buf[i * DTG_EXTENT / sizeof(int32_t)] = v;
+    }
+
+    static int32_t buf_get(std::vector<int32_t> &buf, size_t i)
+    {
+        return buf[i * DTG_EXTENT / sizeof(int32_t)];
+    }
+
+    static bool holes_intact(std::vector<int32_t> &buf)
+    {
+        for (size_t i = 1; i < buf.size(); i += 2) {
+            if (buf[i] != DTG_HOLE) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void data_init(ucc_coll_type_t coll_type, size_t count, ucc_rank_t size)
+    {
+        size_t total;
+
+        ctxs.resize(size);
+        sbufs.resize(size);
+        rbufs.resize(size);
+        counts.assign(size, std::vector<int>(2 * size));
+        displs.assign(size, std::vector<int>(2 * size));
+        for (ucc_rank_t r = 0; r < size; r++) {
+            ucc_coll_args_t *coll = (ucc_coll_args_t *)
+                calloc(1, sizeof(ucc_coll_args_t));
+
+            ctxs[r] = (gtest_ucc_coll_ctx_t *)
+                calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args           = coll;
+            coll->coll_type         = coll_type;
+            coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+            switch (coll_type) {
+            case UCC_COLL_TYPE_BCAST:
+                buf_init(sbufs[r], count);
+                for (size_t i = 0; r == 0 && i < count; i++) {
+                    buf_set(sbufs[r], i, value(0, i));
+                }
+                coll->root              = 0;
+                coll->src.info.buffer   = sbufs[r].data();
+                coll->src.info.count    = count;
+                coll->src.info.datatype = dt;
+                break;
+            case UCC_COLL_TYPE_ALLGATHER:
+            case UCC_COLL_TYPE_ALLTOALL:
+                total = (coll_type == UCC_COLL_TYPE_ALLGATHER) ? count :
+                        count * size;
+                buf_init(sbufs[r], total);
+                buf_init(rbufs[r], count * size);
+                for (size_t i = 0; i < total; i++) {
+                    buf_set(sbufs[r], i, value(r, i));
+                }
+                coll->src.info.buffer   = sbufs[r].data();
+                coll->src.info.count    = total;
+                coll->src.info.datatype = dt;
+                coll->dst.info.buffer   = rbufs[r].data();
+                coll->dst.info.count    = count * size;
+                coll->dst.info.datatype = dt;
+                break;
+            case UCC_COLL_TYPE_ALLGATHERV:
+                total = 0;
+                for (ucc_rank_t p = 0; p < size; p++) {
+                    counts[r][p] = count + p;
+                    displs[r][p] = total;
+                    total       += counts[r][p];
+                }
+                buf_init(sbufs[r], count + r);
+                buf_init(rbufs[r], total);
+                for (size_t i = 0; i < count + r; i++) {
+                    buf_set(sbufs[r], i, value(r, i));
+                }
+                coll->src.info.buffer          = sbufs[r].data();
+                coll->src.info.count           = count + r;
+                coll->src.info.datatype        = dt;
+                coll->dst.info_v.buffer        = rbufs[r].data();
+                coll->dst.info_v.counts        = (ucc_count_t *)counts[r].data();
+                coll->dst.info_v.displacements =
+                    (ucc_aint_t *)displs[r].data();
+                coll->dst.info_v.datatype      = dt;
+                coll->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+                break;
+            case UCC_COLL_TYPE_ALLTOALLV:
+                for (int s = 0; s < 2; s++) {
+                    total = 0;
+                    for (ucc_rank_t p = 0; p < size; p++) {
+                        /* send counts, then receive counts */
+                        counts[r][s * size + p] = s ? a2av_count(count, p, r) :
+                                                      a2av_count(count, r, p);
+                        displs[r][s * size + p] = total;
+                        total += counts[r][s * size + p];
+                    }
+                    buf_init(s ? rbufs[r] : sbufs[r], total);
+                }
+                for (size_t i = 0; i < sbufs[r].size() / 2; i++) {
+                    buf_set(sbufs[r], i, value(r, i));
+                }
+                coll->src.info_v.buffer        = sbufs[r].data();
+                coll->src.info_v.counts        = (ucc_count_t *)counts[r].data();
+                coll->src.info_v.displacements =
+                    (ucc_aint_t *)displs[r].data();
+                coll->src.info_v.datatype      = dt;
+                coll->src.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+                coll->dst.info_v.buffer        = rbufs[r].data();
+                coll->dst.info_v.counts        =
+                    (ucc_count_t *)&counts[r][size];
+                coll->dst.info_v.displacements =
+                    (ucc_aint_t *)&displs[r][size];
+                coll->dst.info_v.datatype      = dt;
+                coll->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    bool data_validate(ucc_coll_type_t coll_type, size_t count,
+                       ucc_rank_t size)
+    {
+        for (ucc_rank_t r = 0; r < size; r++) {
+            std::vector<int32_t> &dst = (coll_type == UCC_COLL_TYPE_BCAST) ?
+                                        sbufs[r] : rbufs[r];
+
+            if (!holes_intact(dst)) {
+                return false;
+            }
+            for (ucc_rank_t p = 0; p < size; p++) {
+                size_t n, d, s;
+
+                switch (coll_type) {
+                case UCC_COLL_TYPE_BCAST:
+                    n = (p == 0) ? count : 0;
+                    d = s = 0;
+                    break;
+                case UCC_COLL_TYPE_ALLGATHER:
+                    n = count;
+                    d = p * count;
+                    s = 0;
+                    break;
+                case UCC_COLL_TYPE_ALLTOALL:
+                    n = count;
+                    d = p * count;
+                    s = r * count;
+                    break;
+                case UCC_COLL_TYPE_ALLGATHERV:
+                    n = counts[r][p];
+                    d = displs[r][p];
+                    s = 0;
+                    break;
+                default:
+                    /* offset of the block in the sender's src buffer */
+                    n = counts[r][size + p];
+                    d = displs[r][size + p];
+                    s = displs[p][r];
+                    break;
+                }
+                for (size_t i = 0; i < n; i++) {
+                    if (buf_get(dst, d + i) != value(p, s + i)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    void data_fini()
+    {
+        for (auto ctx : ctxs) {
+            free(ctx->args);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
+};
+
+UCC_TEST_P(test_dt_generic, single)
+{
+    const ucc_coll_type_t coll_type = std::get<0>(GetParam());
+    const size_t          count     = std::get<1>(GetParam());
+    const int             n_procs   = 5;
+    /* small fragments make larger counts go through several fragments */
+    ucc_job_env_t env = {{"UCC_CLS", "basic"},
+                         {"UCC_TL_UCP_GENERIC_DT_PIPELINE",
+                          "thresh=0:fragsize=1K:nfrags=1:pdepth=2:ordered"}};
+    UccJob    job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h team = job.create_team(n_procs);
+
+    data_init(coll_type, count, n_procs);
+    UccReq req(team, ctxs);
+    CHECK_REQ_NOT_SUPPORTED_SKIP(req, data_fini());
+    req.start();
+    req.wait();
+    EXPECT_EQ(true, data_validate(coll_type, count, n_procs));
+    data_fini();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_dt_generic,
+    ::testing::Combine(
+        ::testing::Values(UCC_COLL_TYPE_BCAST, UCC_COLL_TYPE_ALLGATHER,
+                          UCC_COLL_TYPE_ALLGATHERV, UCC_COLL_TYPE_ALLTOALL,
+                          UCC_COLL_TYPE_ALLTOALLV),
+        ::testing::Values(1, 7, 1000, 4099))); // last two are multi fragment
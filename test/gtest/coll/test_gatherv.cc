@@ -10,6 +10,8 @@ using Param_0 = std::tuple<int, ucc_datatype_t, ucc_memory_type_t, int, int,
                            gtest_ucc_inplace_t>;
 using Param_1 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, int,
                            gtest_ucc_inplace_t>;
+using Param_2 = std::tuple<ucc_datatype_t, ucc_memory_type_t, int, int,
+                           gtest_ucc_inplace_t, std::string>;
 
 class test_gatherv : public UccCollArgs, public ucc::test {
   private:
@@ -307,3 +309,86 @@ INSTANTIATE_TEST_CASE_P(
                        ::testing::Values(1, 3, 8192), // count
                        ::testing::Values(0, 1),       // root
                        ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE)));
+
+class test_gatherv_alg : public test_gatherv,
+                       public ::testing::WithParamInterface<Param_2> {
+};
+
+UCC_TEST_P(test_gatherv_alg, alg)
+{
+    const ucc_datatype_t      dtype    = std::get<0>(GetParam());
+    const ucc_memory_type_t   mem_type = std::get<1>(GetParam());
+    const int                 count    = std::get<2>(GetParam());
+    const int                 root     = std::get<3>(GetParam());
+    const gtest_ucc_inplace_t inplace  = std::get<4>(GetParam());
+    int                       n_procs  = 7;
+    char                      tune[32];
+
+    sprintf(tune, "gatherv:@%s:inf", std::get<5>(GetParam()).c_str());
+    ucc_job_env_t env     = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", tune}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team    = job.create_team(n_procs);
+    UccCollCtxVec ctxs;
+
+    set_inplace(inplace);
+    SET_MEM_TYPE(mem_type);
+    set_root(root);
+
+    data_init(n_procs, dtype, count, ctxs, false);
+    UccReq req(team, ctxs);
+    req.start();
+    req.wait();
+    EXPECT_EQ(true, data_validate(ctxs));
+    data_fini(ctxs);
+}
+
+/* scratch of interior knomial ranks is reused across starts */
+UCC_TEST_P(test_gatherv_alg, persistent)
+{
+    const ucc_datatype_t      dtype    = std::get<0>(GetParam());
+    const ucc_memory_type_t   mem_type = std::get<1>(GetParam());
+    const int                 count    = std::get<2>(GetParam());
+    const int                 root     = std::get<3>(GetParam());
+    const gtest_ucc_inplace_t inplace  = std::get<4>(GetParam());
+    int                       n_procs  = 7;
+    const int                 n_calls  = 3;
+    char                      tune[32];
+
+    sprintf(tune, "gatherv:@%s:inf", std::get<5>(GetParam()).c_str());
+    ucc_job_env_t env     = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE", tune}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team    = job.create_team(n_procs);
+    UccCollCtxVec ctxs;
+
+    set_inplace(inplace);
+    SET_MEM_TYPE(mem_type);
+    set_root(root);
+
+    data_init(n_procs, dtype, count, ctxs, true);
+    UccReq req(team, ctxs);
+
+    for (auto i = 0; i < n_calls; i++) {
+        req.start();
+        req.wait();
+        EXPECT_EQ(true, data_validate(ctxs));
+        reset(ctxs);
+    }
+    data_fini(ctxs);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_gatherv_alg,
+    ::testing::Combine(PREDEFINED_DTYPES,
+#ifdef HAVE_CUDA
+                       ::testing::Values(UCC_MEMORY_TYPE_HOST,
+                                         UCC_MEMORY_TYPE_CUDA,
+                                         UCC_MEMORY_TYPE_CUDA_MANAGED),
+#else
+                       ::testing::Values(UCC_MEMORY_TYPE_HOST),
+#endif
+                       ::testing::Values(1, 3, 8192), // count
+                       ::testing::Values(0, 3),       // root
+                       ::testing::Values(TEST_INPLACE, TEST_NO_INPLACE),
+                       ::testing::Values("linear", "knomial")));
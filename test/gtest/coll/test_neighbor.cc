@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * See file LICENSE for terms.
+ */
+
+#include "common/test_ucc.h"
+
+/* Directed graph: rank r sends to r + offsets[i] and receives from
+   r - offsets[i], so sources[i] sent its block i to us */
+class test_neighbor : public ucc::test {
+  public:
+    int                                n_procs = 8;
+    std::vector<int>                   offsets = {1, 3, 4};
+    std::vector<std::vector<uint64_t>> srcs, dsts;
+    ucc_neighbors_vec_t                graph;
+    UccCollCtxVec                      ctxs;
+    std::vector<std::vector<int>>      sbufs, rbufs;
+    std::vector<std::vector<ucc_count_t>> scounts, sdispls, rcounts, rdispls;
+
+    void graph_init()
+    {
+        int deg = offsets.size();
+
+        srcs.resize(n_procs);
+        dsts.resize(n_procs);
+        graph.resize(n_procs);
+        for (int r = 0; r < n_procs; r++) {
+            for (int off : offsets) {
+                dsts[r].push_back((r + off) % n_procs);
+                srcs[r].push_back((r - off + n_procs) % n_procs);
+            }
+            graph[r].n_sources      = deg;
+            graph[r].sources        = srcs[r].data();
+            graph[r].n_destinations = deg;
+            graph[r].destinations   = dsts[r].data();
+        }
+    }
+
+    /* block sent by rank r to its i-th destination */
+    static int block_count(int r, int i)
+    {
+        return r + i + 1;
+    }
+
+    static int block_value(int r, int i, int j)
+    {
+        return r * 1000 + i * 100 + j;
+    }
+
+    void data_init(ucc_coll_type_t coll_type, bool persistent)
+    {
+        int deg = offsets.size();
+
+        ctxs.resize(n_procs);
+        sbufs.resize(n_procs);
+        rbufs.resize(n_procs);
+        scounts.resize(n_procs);
+        sdispls.resize(n_procs);
+        rcounts.resize(n_procs);
+        rdispls.resize(n_procs);
+        for (int r = 0; r < n_procs; r++) {
+            ucc_coll_args_t *coll = (ucc_coll_args_t *)
+                calloc(1, sizeof(ucc_coll_args_t));
+
+            ctxs[r] = (gtest_ucc_coll_ctx_t *)
+                calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args   = coll;
+            coll->coll_type = coll_type;
+            if (persistent) {
+                coll->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+                coll->flags |= UCC_COLL_ARGS_FLAG_PERSISTENT;
+            }
+            if (coll_type == UCC_COLL_TYPE_NEIGHBOR_ALLGATHER) {
+                /* all ranks contribute the same count */
+                sbufs[r].assign(1, block_value(r, 0, 0));
+                rbufs[r].assign(deg, -1);
+                coll->src.info.buffer   = sbufs[r].data();
+                coll->src.info.count    = 1;
+                coll->src.info.datatype = UCC_DT_INT32;
+                coll->src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+                coll->dst.info.buffer   = rbufs[r].data();
+                coll->dst.info.count    = deg;
+                coll->dst.info.datatype = UCC_DT_INT32;
+                coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+                continue;
+            }
+            sbufs[r].clear();
+            scounts[r].clear();
+            sdispls[r].clear();
+            for (int i = 0; i < deg; i++) {
+                sdispls[r].push_back(sbufs[r].size());
+                scounts[r].push_back(block_count(r, i));
+                for (int j = 0; j < block_count(r, i); j++) {
+                    sbufs[r].push_back(block_value(r, i, j));
+                }
+            }
+            rcounts[r].clear();
+            rdispls[r].clear();
+            size_t total = 0;
+            for (int i = 0; i < deg; i++) {
+                rdispls[r].push_back(total);
+                rcounts[r].push_back(block_count(srcs[r][i], i));
+                total += rcounts[r].back();
+            }
+            rbufs[r].assign(total, -1);
+            coll->src.info_v.buffer        = sbufs[r].data();
+            coll->src.info_v.counts        = scounts[r].data();
+            coll->src.info_v.displacements = sdispls[r].data();
+            coll->src.info_v.datatype      = UCC_DT_INT32;
+            coll->src.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+            coll->dst.info_v.buffer        = rbufs[r].data();
+            coll->dst.info_v.counts        = rcounts[r].data();
+            coll->dst.info_v.displacements = rdispls[r].data();
+            coll->dst.info_v.datatype      = UCC_DT_INT32;
+            coll->dst.info_v.mem_type      = UCC_MEMORY_TYPE_HOST;
+        }
+    }
+
+    void data_fini()
+    {
+        for (gtest_ucc_coll_ctx_t *ctx : ctxs) {
+            free(ctx->args);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
+
+    void validate(ucc_coll_type_t coll_type)
+    {
+        for (int r = 0; r < n_procs; r++) {
+            for (int i = 0; i < offsets.size(); i++) {
+                int src = srcs[r][i];
+                if (coll_type == UCC_COLL_TYPE_NEIGHBOR_ALLGATHER) {
+                    EXPECT_EQ(block_value(src, 0, 0), rbufs[r][i]);
+                    continue;
+                }
+                for (int j = 0; j < rcounts[r][i]; j++) {
+                    EXPECT_EQ(block_value(src, i, j),
+                              rbufs[r][rdispls[r][i] + j]);
+                }
+            }
+            std::fill(rbufs[r].begin(), rbufs[r].end(), -1);
+        }
+    }
+};
+
+#define TEST_NEIGHBOR(_coll_type, _repeat, _persistent)                        \
+    {                                                                          \
+        UccJob    job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL);                    \
+        UccTeam_h team;                                                        \
+                                                                               \
+        graph_init();                                                          \
+        team = job.create_team(n_procs, false, true, false, &graph);           \
+        data_init(_coll_type, _persistent);                                    \
+        UccReq req(team, ctxs);                                                \
+        CHECK_REQ_NOT_SUPPORTED_SKIP(req, data_fini());                        \
+        for (int i = 0; i < _repeat; i++) {                                    \
+            req.start();                                                       \
+            req.wait();                                                        \
+            validate(_coll_type);                                              \
+        }                                                                      \
+        data_fini();                                                           \
+    }
+
+UCC_TEST_F(test_neighbor, alltoallv)
+{
+    TEST_NEIGHBOR(UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV, 1, false);
+}
+
+UCC_TEST_F(test_neighbor, alltoallv_persistent)
+{
+    TEST_NEIGHBOR(UCC_COLL_TYPE_NEIGHBOR_ALLTOALLV, 3, true);
+}
+
+UCC_TEST_F(test_neighbor, allgather)
+{
+    TEST_NEIGHBOR(UCC_COLL_TYPE_NEIGHBOR_ALLGATHER, 1, false);
+}
+
+UCC_TEST_F(test_neighbor, allgather_persistent)
+{
+    TEST_NEIGHBOR(UCC_COLL_TYPE_NEIGHBOR_ALLGATHER, 3, true);
+}
+
+/* neighbor collectives require the graph at team creation */
+UCC_TEST_F(test_neighbor, no_graph)
+{
+    UccJob          job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL);
+    UccTeam_h       team = job.create_team(n_procs);
+    ucc_coll_args_t args = {};
+    ucc_coll_req_h  req;
+    int             buf[4];
+
+    args.coll_type          = UCC_COLL_TYPE_NEIGHBOR_ALLGATHER;
+    args.src.info.buffer    = buf;
+    args.src.info.count     = 1;
+    args.src.info.datatype  = UCC_DT_INT32;
+    args.src.info.mem_type  = UCC_MEMORY_TYPE_HOST;
+    args.dst.info.buffer    = buf;
+    args.dst.info.count     = 1;
+    args.dst.info.datatype  = UCC_DT_INT32;
+    args.dst.info.mem_type  = UCC_MEMORY_TYPE_HOST;
+    EXPECT_EQ(UCC_ERR_INVALID_PARAM,
+              ucc_collective_init(&args, &req, team->procs[0].team));
+}
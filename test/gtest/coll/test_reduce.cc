@@ -330,6 +330,9 @@ ucc_job_env_t reduce_dbt_env   = {{"UCC_TL_UCP_TUNE", "reduce:@dbt:0-inf:inf"},
                                   {"UCC_CLS", "basic"}};
 ucc_job_env_t reduce_2step_env = {{"UCC_CL_HIER_TUNE", "reduce:@2step:0-inf:inf"},
                                   {"UCC_CLS", "all"}};
+ucc_job_env_t reduce_3step_env = {{"UCC_CL_HIER_TUNE", "reduce:@2step:0-inf:inf"},
+                                  {"UCC_CL_HIER_INTRA_NODE_LEVEL", "numa"},
+                                  {"UCC_CLS", "all"}};
 
 TYPED_TEST(test_reduce_avg_order, avg_post_op) {
     TEST_DECLARE_WITH_ENV(post_op_env, 15, true);
@@ -346,3 +349,7 @@ TYPED_TEST(test_reduce_dbt, reduce_dbt_mirror) {
 TYPED_TEST(test_reduce_2step, 2step) {
     TEST_DECLARE_WITH_ENV(reduce_2step_env, 16, false);
 }
+
+TYPED_TEST(test_reduce_2step, 2step_numa) {
+    TEST_DECLARE_WITH_ENV(reduce_3step_env, 16, false);
+}
@@ -381,3 +381,57 @@ INSTANTIATE_TEST_CASE_P(
     [](const testing::TestParamInfo<Param_0>& info) {
         const ucc_job_env_t env   = std::get<0>(info.param);
         return  env[0].second;});
+
+class test_reduce_scatter_reduced_precision
+    : public ucc::test,
+      public ::testing::WithParamInterface<Param_0> {
+};
+
+/* init values are small integers, partial sums are exact in 16 bit floats.
+   Counts are not multiples of 2 * team size, so the bidirectional sets and
+   the blocks of the ring get different number of elements */
+UCC_TEST_P(test_reduce_scatter_reduced_precision,)
+{
+    test_reduce_scatter<TypeOpPair<UCC_DT_FLOAT32, sum>> rs_test;
+    int                 n_procs = 15;
+    int                 repeat  = 3;
+    const ucc_job_env_t env     = std::get<0>(GetParam());
+    UccCollCtxVec       ctxs;
+
+    for (auto wire_dt : {"bf16", "fp16"}) {
+        ucc_job_env_t job_env = env;
+
+        job_env.push_back({"UCC_TL_UCP_REDUCE_WIRE_DT", wire_dt});
+        UccJob    job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, job_env);
+        UccTeam_h team = job.create_team(n_procs);
+
+        for (auto count : {30, 15015, 123567}) {
+            for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {
+                rs_test.set_mem_type(UCC_MEMORY_TYPE_HOST);
+                rs_test.set_inplace(inplace);
+                rs_test.data_init(n_procs, UCC_DT_FLOAT32, count, ctxs, true);
+                for (auto &c : ctxs) {
+                    c->args->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+                    c->args->flags |= UCC_COLL_ARGS_FLAG_REDUCED_PRECISION;
+                }
+                UccReq req(team, ctxs);
+
+                for (auto i = 0; i < repeat; i++) {
+                    req.start();
+                    req.wait();
+                    EXPECT_EQ(true, rs_test.data_validate(ctxs));
+                    rs_test.reset(ctxs);
+                }
+                rs_test.data_fini(ctxs);
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    , test_reduce_scatter_reduced_precision,
+        ::testing::Combine(
+            ::testing::Values(ring_unidir_env, ring_bidir_env)),
+    [](const testing::TestParamInfo<Param_0>& info) {
+        const ucc_job_env_t env   = std::get<0>(info.param);
+        return  env[0].second;});
@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * See file LICENSE for terms.
+ */
+
+#include "core/test_mc_reduce.h"
+#include "common/test_ucc.h"
+#include "utils/ucc_math.h"
+
+#include <array>
+
+template<typename T>
+class test_scan : public UccCollArgs, public testing::Test {
+  public:
+    ucc_coll_type_t coll_type = UCC_COLL_TYPE_SCAN;
+
+    void data_init(int nprocs, ucc_datatype_t dt, size_t count,
+                   UccCollCtxVec &ctxs, bool persistent)
+    {
+        ctxs.resize(nprocs);
+        for (int r = 0; r < nprocs; r++) {
+            ucc_coll_args_t *coll = (ucc_coll_args_t*)
+                    calloc(1, sizeof(ucc_coll_args_t));
+
+            ctxs[r] = (gtest_ucc_coll_ctx_t*)calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+            ctxs[r]->args = coll;
+
+            coll->coll_type          = coll_type;
+            coll->op                 = T::redop;
+            coll->global_work_buffer = NULL;
+
+            ctxs[r]->init_buf = ucc_malloc(ucc_dt_size(dt) * count, "init buf");
+            EXPECT_NE(ctxs[r]->init_buf, nullptr);
+            for (int i = 0; i < count; i++) {
+                typename T::type * ptr;
+                ptr = (typename T::type *)ctxs[r]->init_buf;
+                ptr[i] = (typename T::type)((i + r + 1) % 8);
+            }
+
+            UCC_CHECK(ucc_mc_alloc(&ctxs[r]->dst_mc_header,
+                                   ucc_dt_size(dt) * count, mem_type));
+            coll->dst.info.buffer = ctxs[r]->dst_mc_header->addr;
+            if (TEST_INPLACE == inplace) {
+                coll->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+                coll->flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+                UCC_CHECK(ucc_mc_memcpy(coll->dst.info.buffer, ctxs[r]->init_buf,
+                                        ucc_dt_size(dt) * count, mem_type,
+                                        UCC_MEMORY_TYPE_HOST));
+            } else {
+                UCC_CHECK(ucc_mc_alloc(&ctxs[r]->src_mc_header,
+                                       ucc_dt_size(dt) * count, mem_type));
+                coll->src.info.buffer = ctxs[r]->src_mc_header->addr;
+                UCC_CHECK(ucc_mc_memcpy(coll->src.info.buffer, ctxs[r]->init_buf,
+                                        ucc_dt_size(dt) * count, mem_type,
+                                        UCC_MEMORY_TYPE_HOST));
+                coll->src.info.mem_type = mem_type;
+                coll->src.info.count    = (ucc_count_t)count;
+                coll->src.info.datatype = dt;
+            }
+            coll->dst.info.mem_type = mem_type;
+            coll->dst.info.count    = (ucc_count_t)count;
+            coll->dst.info.datatype = dt;
+            if (persistent) {
+                coll->mask  |= UCC_COLL_ARGS_FIELD_FLAGS;
+                coll->flags |= UCC_COLL_ARGS_FLAG_PERSISTENT;
+            }
+        }
+    }
+    void data_fini(UccCollCtxVec ctxs) {
+        for (gtest_ucc_coll_ctx_t* ctx : ctxs) {
+            ucc_coll_args_t* coll = ctx->args;
+            if (coll->src.info.buffer) { /* no inplace */
+                UCC_CHECK(ucc_mc_free(ctx->src_mc_header));
+            }
+            UCC_CHECK(ucc_mc_free(ctx->dst_mc_header));
+            ucc_free(ctx->init_buf);
+            free(coll);
+            free(ctx);
+        }
+        ctxs.clear();
+    }
+    void reset(UccCollCtxVec ctxs)
+    {
+        for (auto r = 0; r < ctxs.size(); r++) {
+            ucc_coll_args_t *coll  = ctxs[r]->args;
+            size_t           count = coll->dst.info.count;
+            ucc_datatype_t   dtype = coll->dst.info.datatype;
+            clear_buffer(coll->dst.info.buffer, count * ucc_dt_size(dtype),
+                         mem_type, 0);
+
+            if (TEST_INPLACE == inplace) {
+                UCC_CHECK(ucc_mc_memcpy(coll->dst.info.buffer,
+                                        ctxs[r]->init_buf,
+                                        ucc_dt_size(dtype) * count, mem_type,
+                                        UCC_MEMORY_TYPE_HOST));
+            }
+        }
+    }
+    bool data_validate(UccCollCtxVec ctxs)
+    {
+        size_t count     = (ctxs[0])->args->dst.info.count;
+        bool   exclusive = (coll_type == UCC_COLL_TYPE_EXSCAN);
+        std::vector<typename T::type *> dsts(ctxs.size());
+
+        if (UCC_MEMORY_TYPE_HOST != mem_type) {
+            for (int r = 0; r < ctxs.size(); r++) {
+                dsts[r] = (typename T::type *) ucc_malloc(count * sizeof(typename T::type), "dsts buf");
+                EXPECT_NE(dsts[r], nullptr);
+                UCC_CHECK(ucc_mc_memcpy(dsts[r], ctxs[r]->args->dst.info.buffer,
+                                        count * sizeof(typename T::type), UCC_MEMORY_TYPE_HOST,
+                                        mem_type));
+            }
+        } else {
+            for (int r = 0; r < ctxs.size(); r++) {
+                dsts[r] = (typename T::type *)(ctxs[r]->args->dst.info.buffer);
+            }
+        }
+        for (int i = 0; i < count; i++) {
+            typename T::type res =
+                    ((typename T::type *)((ctxs[0])->init_buf))[i];
+            if (!exclusive) {
+                T::assert_equal(res, dsts[0][i]);
+            }
+            for (int r = 1; r < ctxs.size(); r++) {
+                /* dst of rank 0 is undefined for exscan */
+                if (exclusive) {
+                    T::assert_equal(res, dsts[r][i]);
+                }
+                res = T::do_op(res, ((typename T::type *)((ctxs[r])->init_buf))[i]);
+                if (!exclusive) {
+                    T::assert_equal(res, dsts[r][i]);
+                }
+            }
+        }
+        if (UCC_MEMORY_TYPE_HOST != mem_type) {
+            for (int r = 0; r < ctxs.size(); r++) {
+                ucc_free(dsts[r]);
+            }
+        }
+        return true;
+    }
+};
+
+/* avg is not defined for prefix reductions */
+using test_scan_type_ops =
+    ::testing::Types<ARITHMETIC_OP_PAIRS(INT32), ARITHMETIC_OP_PAIRS(FLOAT64),
+                     TypeOpPair<UCC_DT_UINT64, bxor>,
+                     TypeOpPair<UCC_DT_FLOAT32_COMPLEX, sum>>;
+
+template<typename T>
+class test_scan_host : public test_scan<T> {};
+
+TYPED_TEST_CASE(test_scan_host, test_scan_type_ops);
+
+#define TEST_DECLARE(_coll_type, _inplace, _repeat, _persistent)               \
+    {                                                                          \
+        std::array<int, 3> counts{4, 256, 65536};                              \
+        for (int tid = 0; tid < UccJob::nStaticTeams; tid++) {                 \
+            for (int count : counts) {                                         \
+                UccTeam_h     team = UccJob::getStaticTeams()[tid];            \
+                int           size = team->procs.size();                       \
+                UccCollCtxVec ctxs;                                            \
+                SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);                            \
+                this->coll_type = _coll_type;                                  \
+                this->set_inplace(_inplace);                                   \
+                this->data_init(size, TypeParam::dt, count, ctxs, _persistent);\
+                UccReq req(team, ctxs);                                        \
+                for (auto i = 0; i < _repeat; i++) {                           \
+                    req.start();                                               \
+                    req.wait();                                                \
+                    EXPECT_EQ(true, this->data_validate(ctxs));                \
+                    this->reset(ctxs);                                         \
+                }                                                              \
+                this->data_fini(ctxs);                                         \
+            }                                                                  \
+        }                                                                      \
+    }
+
+TYPED_TEST(test_scan_host, scan) {
+    TEST_DECLARE(UCC_COLL_TYPE_SCAN, TEST_NO_INPLACE, 1, 0);
+}
+
+TYPED_TEST(test_scan_host, scan_inplace) {
+    TEST_DECLARE(UCC_COLL_TYPE_SCAN, TEST_INPLACE, 1, 0);
+}
+
+TYPED_TEST(test_scan_host, scan_persistent) {
+    TEST_DECLARE(UCC_COLL_TYPE_SCAN, TEST_NO_INPLACE, 3, 1);
+}
+
+TYPED_TEST(test_scan_host, exscan) {
+    TEST_DECLARE(UCC_COLL_TYPE_EXSCAN, TEST_NO_INPLACE, 1, 0);
+}
+
+TYPED_TEST(test_scan_host, exscan_inplace) {
+    TEST_DECLARE(UCC_COLL_TYPE_EXSCAN, TEST_INPLACE, 1, 0);
+}
+
+TYPED_TEST(test_scan_host, exscan_persistent) {
+    TEST_DECLARE(UCC_COLL_TYPE_EXSCAN, TEST_NO_INPLACE, 3, 1);
+}
+
+template<typename T>
+class test_scan_alg : public test_scan<T>
+{};
+
+using test_scan_alg_type = ::testing::Types<TypeOpPair<UCC_DT_INT32, sum>>;
+TYPED_TEST_CASE(test_scan_alg, test_scan_alg_type);
+
+#define TEST_SCAN_ALG(_alg, _radix)                                            \
+    {                                                                          \
+        int           n_procs = 15;                                            \
+        ucc_job_env_t env     = {{"UCC_CL_BASIC_TUNE", "inf"},                 \
+                                 {"UCC_TL_UCP_TUNE",                           \
+                                  "scan:@" _alg ":inf#exscan:@" _alg ":inf"},  \
+                                 {"UCC_TL_UCP_SCAN_KN_RADIX", _radix}};        \
+        UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);           \
+        UccTeam_h     team = job.create_team(n_procs);                         \
+        UccCollCtxVec ctxs;                                                    \
+                                                                               \
+        SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);                                    \
+        for (auto ct : {UCC_COLL_TYPE_SCAN, UCC_COLL_TYPE_EXSCAN}) {           \
+            for (auto inplace : {TEST_NO_INPLACE, TEST_INPLACE}) {             \
+                for (auto count : {1, 4099}) {                                 \
+                    this->coll_type = ct;                                      \
+                    this->set_inplace(inplace);                                \
+                    this->data_init(n_procs, TypeParam::dt, count, ctxs,       \
+                                    false);                                    \
+                    UccReq req(team, ctxs);                                    \
+                    req.start();                                               \
+                    req.wait();                                                \
+                    EXPECT_EQ(true, this->data_validate(ctxs));                \
+                    this->data_fini(ctxs);                                     \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    }
+
+TYPED_TEST(test_scan_alg, recursive_doubling) {
+    TEST_SCAN_ALG("recursive_doubling", "4");
+}
+
+TYPED_TEST(test_scan_alg, knomial) {
+    TEST_SCAN_ALG("knomial", "4");
+}
+
+TYPED_TEST(test_scan_alg, knomial_radix3) {
+    TEST_SCAN_ALG("knomial", "3");
+}
+
+/* in-place rd keeps partial reduction in scratch, that is reused by
+   the following starts of persistent coll */
+TYPED_TEST(test_scan_alg, recursive_doubling_inplace_persistent) {
+    int           n_procs = 6;
+    const int     n_calls = 3;
+    ucc_job_env_t env     = {{"UCC_CL_BASIC_TUNE", "inf"},
+                             {"UCC_TL_UCP_TUNE",
+                              "scan:@recursive_doubling:inf#"
+                              "exscan:@recursive_doubling:inf"}};
+    UccJob        job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h     team = job.create_team(n_procs);
+    UccCollCtxVec ctxs;
+
+    SET_MEM_TYPE(UCC_MEMORY_TYPE_HOST);
+    for (auto ct : {UCC_COLL_TYPE_SCAN, UCC_COLL_TYPE_EXSCAN}) {
+        for (auto count : {1, 7, 4099}) {
+            this->coll_type = ct;
+            this->set_inplace(TEST_INPLACE);
+            this->data_init(n_procs, TypeParam::dt, count, ctxs, true);
+            UccReq req(team, ctxs);
+            for (auto i = 0; i < n_calls; i++) {
+                req.start();
+                req.wait();
+                EXPECT_EQ(true, this->data_validate(ctxs));
+                this->reset(ctxs);
+            }
+            this->data_fini(ctxs);
+        }
+    }
+}
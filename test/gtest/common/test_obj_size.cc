@@ -13,6 +13,10 @@
 
 extern "C" {
 #include <schedule/ucc_schedule.h>
+#include <utils/arch/cpu.h>
+#ifdef HAVE_UCX
+#include <components/tl/ucp/tl_ucp_coll.h>
+#endif
 }
 
 class test_obj_size : public ucc::test {
@@ -23,3 +27,45 @@ UCC_TEST_F(test_obj_size, size) {
        currently 480b */
     EXPECT_LT(sizeof(ucc_coll_task_t), 64 * 8);
 }
+
+#define EXPECT_IN_CACHE_LINE(_type, _field)                                    \
+    EXPECT_LE(offsetof(_type, _field) + sizeof(((_type *)0)->_field),          \
+              (size_t)UCC_CACHE_LINE_SIZE)
+
+UCC_TEST_F(test_obj_size, coll_task_hot_fields) {
+    /* fields used by progress queue on every pass must share
+       the first cache line of the task */
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, super);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, status);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, list_elem);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, lf_elem);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, progress);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, flags);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, n_deps_satisfied);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, schedule);
+    EXPECT_IN_CACHE_LINE(ucc_coll_task_t, start_time);
+    /* bargs is cold and must not split the hot fields */
+    EXPECT_GE(offsetof(ucc_coll_task_t, bargs), (size_t)UCC_CACHE_LINE_SIZE);
+}
+
+#ifdef HAVE_UCX
+UCC_TEST_F(test_obj_size, tl_ucp_task_hot_fields) {
+    const size_t hot = offsetof(ucc_tl_ucp_task_t, flags);
+
+    /* core part of the task keeps its hot fields in the first line */
+    EXPECT_IN_CACHE_LINE(ucc_tl_ucp_task_t, super.status);
+    EXPECT_IN_CACHE_LINE(ucc_tl_ucp_task_t, super.progress);
+    EXPECT_IN_CACHE_LINE(ucc_tl_ucp_task_t, super.flags);
+    /* flags, p2p counters and n_polls are read by send/recv and test on
+       every progress pass: they start a new cache line after bargs */
+    EXPECT_EQ(0, hot % UCC_CACHE_LINE_SIZE);
+    EXPECT_GE(hot, offsetof(ucc_tl_ucp_task_t, super.bargs) +
+                   sizeof(((ucc_tl_ucp_task_t *)0)->super.bargs));
+    EXPECT_LE(offsetof(ucc_tl_ucp_task_t, tagged) +
+              sizeof(((ucc_tl_ucp_task_t *)0)->tagged) - hot,
+              (size_t)UCC_CACHE_LINE_SIZE);
+    EXPECT_LE(offsetof(ucc_tl_ucp_task_t, n_polls) +
+              sizeof(((ucc_tl_ucp_task_t *)0)->n_polls) - hot,
+              (size_t)UCC_CACHE_LINE_SIZE);
+}
+#endif
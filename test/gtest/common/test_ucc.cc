@@ -164,7 +164,7 @@ uint64_t rank_map_cb(uint64_t ep, void *cb_ctx) {
 }
 
 void UccTeam::init_team(bool use_team_ep_map, bool use_ep_range,
-                        bool is_onesided)
+                        bool is_onesided, const ucc_neighbors_vec_t *neighbors)
 {
     ucc_team_params_t                    team_params;
     std::vector<allgather_coll_info_t *> cis;
@@ -200,6 +200,10 @@ void UccTeam::init_team(bool use_team_ep_map, bool use_ep_range,
             team_params.mask |= UCC_TEAM_PARAM_FIELD_FLAGS;
             team_params.flags = UCC_TEAM_FLAG_COLL_WORK_BUFFER;
         }
+        if (neighbors) {
+            team_params.mask     |= UCC_TEAM_PARAM_FIELD_NEIGHBORS;
+            team_params.neighbors = (*neighbors)[i];
+        }
         EXPECT_EQ(UCC_OK,
                   ucc_team_create_post(&(procs[i].p.get()->ctx_h), 1, &team_params,
                                        &(procs[i].team)));
@@ -251,7 +255,8 @@ void UccTeam::progress()
 }
 
 UccTeam::UccTeam(std::vector<UccProcess_h> &_procs, bool use_team_ep_map,
-                 bool use_ep_range, bool is_onesided)
+                 bool use_ep_range, bool is_onesided,
+                 const ucc_neighbors_vec_t *neighbors)
 {
     n_procs = _procs.size();
     ag.resize(n_procs);
@@ -262,7 +267,7 @@ UccTeam::UccTeam(std::vector<UccProcess_h> &_procs, bool use_team_ep_map,
         a.phase = AG_INIT;
     }
     copy_complete_count = 0;
-    init_team(use_team_ep_map, use_ep_range, is_onesided);
+    init_team(use_team_ep_map, use_ep_range, is_onesided, neighbors);
     // test_allgather(128);
 }
 
@@ -271,10 +276,12 @@ UccTeam::~UccTeam()
     destroy_team();
 }
 
-UccJob::UccJob(int _n_procs, ucc_job_ctx_mode_t _ctx_mode, ucc_job_env_t vars) :
+UccJob::UccJob(int _n_procs, ucc_job_ctx_mode_t _ctx_mode, ucc_job_env_t vars,
+               ucc_thread_mode_t thread_mode) :
     ta(_n_procs), n_procs(_n_procs), ctx_mode(_ctx_mode)
 
 {
+    ucc_lib_params_t lib_params = UccProcess::default_lib_params;
     ucc_job_env_t env_bkp;
     char *var;
 
@@ -297,8 +304,9 @@ UccJob::UccJob(int _n_procs, ucc_job_ctx_mode_t _ctx_mode, ucc_job_env_t vars) :
         }
         setenv(v.first.c_str(), v.second.c_str(), 1);
     }
+    lib_params.thread_mode = thread_mode;
     for (int i = 0; i < n_procs; i++) {
-        procs.push_back(std::make_shared<UccProcess>(i));
+        procs.push_back(std::make_shared<UccProcess>(i, lib_params));
     }
 
     create_context();
@@ -554,7 +562,8 @@ void UccJob::cleanup()
 }
 
 UccTeam_h UccJob::create_team(int _n_procs, bool use_team_ep_map,
-                              bool use_ep_range, bool is_onesided)
+                              bool use_ep_range, bool is_onesided,
+                              const ucc_neighbors_vec_t *neighbors)
 {
     EXPECT_GE(n_procs, _n_procs);
     std::vector<UccProcess_h> team_procs;
@@ -562,7 +571,7 @@ UccTeam_h UccJob::create_team(int _n_procs, bool use_team_ep_map,
         team_procs.push_back(procs[i]);
     }
     return std::make_shared<UccTeam>(team_procs, use_team_ep_map, use_ep_range,
-                                     is_onesided);
+                                     is_onesided, neighbors);
 }
 
 UccTeam_h UccJob::create_team(std::vector<int> &ranks, bool use_team_ep_map,
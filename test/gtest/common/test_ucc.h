@@ -145,6 +145,9 @@ public:
 };
 typedef std::shared_ptr<UccProcess> UccProcess_h;
 
+/* Per process neighbor graph passed at team creation */
+typedef std::vector<ucc_team_neighbors_t> ucc_neighbors_vec_t;
+
 /* Ucc team that consists of several processes. The team
    is created from UccJob environment */
 class UccTeam {
@@ -171,7 +174,8 @@ class UccTeam {
         UccTeam *self;
     } allgather_coll_info_t;
     std::vector<struct allgather_data> ag;
-    void init_team(bool use_team_ep_map, bool use_ep_range, bool is_onesided);
+    void init_team(bool use_team_ep_map, bool use_ep_range, bool is_onesided,
+                   const ucc_neighbors_vec_t *neighbors);
     void destroy_team();
     void test_allgather(size_t msglen);
     static ucc_status_t allgather(void *src_buf, void *recv_buf, size_t size,
@@ -184,7 +188,8 @@ public:
     void progress();
     std::vector<proc> procs;
     UccTeam(std::vector<UccProcess_h> &_procs, bool use_team_ep_map = false,
-            bool use_ep_range = true, bool is_onesided = false);
+            bool use_ep_range = true, bool is_onesided = false,
+            const ucc_neighbors_vec_t *neighbors = nullptr);
     ~UccTeam();
 };
 typedef std::shared_ptr<UccTeam> UccTeam_h;
@@ -210,11 +215,13 @@ public:
     static const std::vector<UccTeam_h> &getStaticTeams();
     int n_procs;
     UccJob(int _n_procs = 2, ucc_job_ctx_mode_t _ctx_mode = UCC_JOB_CTX_GLOBAL,
-           ucc_job_env_t vars = ucc_job_env_t());
+           ucc_job_env_t vars = ucc_job_env_t(),
+           ucc_thread_mode_t thread_mode = UCC_THREAD_SINGLE);
     ~UccJob();
     std::vector<UccProcess_h> procs;
     UccTeam_h create_team(int n_procs, bool use_team_ep_map = false,
-                          bool use_ep_range = true, bool is_onesided = false);
+                          bool use_ep_range = true, bool is_onesided = false,
+                          const ucc_neighbors_vec_t *neighbors = nullptr);
     UccTeam_h create_team(std::vector<int> &ranks, bool use_team_ep_map = false,
                           bool use_ep_range = true, bool is_onesided = false);
     void create_context();
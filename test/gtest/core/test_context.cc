@@ -4,9 +4,16 @@
  */
 #include "test_context.h"
 #include "../common/test_ucc.h"
+extern "C" {
+#include "core/ucc_context.h"
+#include "components/tl/ucc_tl.h"
+}
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <thread>
+#include <chrono>
+#include <poll.h>
 
 test_context::test_context()
 {
@@ -100,3 +107,342 @@ UCC_TEST_F(test_context, global)
     job16.cleanup();
 
 }
+
+class test_context_lazy_tl : public ucc::test {
+public:
+    static ucc_tl_context_t *find_tl_ctx(ucc_context_h ctx, const char *name)
+    {
+        ucc_tl_lib_t *tl_lib;
+        unsigned      i;
+
+        for (i = 0; i < ctx->n_tl_ctx; i++) {
+            tl_lib = ucc_derived_of(ctx->tl_ctx[i]->super.lib, ucc_tl_lib_t);
+            if (0 == strcmp(tl_lib->iface->super.name, name)) {
+                return ctx->tl_ctx[i];
+            }
+        }
+        return NULL;
+    }
+};
+
+/* Lazy TL context is created by the first team, shared by the following
+   ones and destroyed together with the last team using it */
+UCC_TEST_F(test_context_lazy_tl, create_reuse_destroy)
+{
+    ucc_tl_context_t *tl_ctx;
+    ucc_context_h     ctx;
+
+    if (!tl_self_available()) {
+        GTEST_SKIP();
+    }
+    UccJob job(2, UccJob::UCC_JOB_CTX_GLOBAL,
+               {{"UCC_CLS", "basic"}, {"UCC_LAZY_TLS", "self"}});
+    ctx = job.procs[0]->ctx_h;
+    EXPECT_EQ(1, ucc_context_tl_is_lazy(ctx, "self"));
+    EXPECT_EQ(nullptr, find_tl_ctx(ctx, "self"));
+    {
+        UccTeam_h team1 = job.create_team(1);
+        tl_ctx          = find_tl_ctx(ctx, "self");
+        ASSERT_NE(nullptr, tl_ctx);
+        EXPECT_EQ(1, tl_ctx->lazy);
+        EXPECT_EQ(1, tl_ctx->ref_count);
+
+        UccTeam_h team2 = job.create_team(1);
+        EXPECT_EQ(tl_ctx, find_tl_ctx(ctx, "self"));
+        EXPECT_EQ(2, tl_ctx->ref_count);
+        team2.reset();
+        EXPECT_EQ(tl_ctx, find_tl_ctx(ctx, "self"));
+        EXPECT_EQ(1, tl_ctx->ref_count);
+    }
+    EXPECT_EQ(nullptr, find_tl_ctx(ctx, "self"));
+
+    /* next user creates it again */
+    UccTeam_h team3 = job.create_team(1);
+    EXPECT_NE(nullptr, find_tl_ctx(ctx, "self"));
+}
+
+/* TL which context creation is not local is created eagerly even if it
+   is listed in UCC_LAZY_TLS */
+UCC_TEST_F(test_context_lazy_tl, not_lazy_capable)
+{
+    ucc_tl_context_t *tl_ctx;
+    ucc_context_h     ctx;
+
+    UccJob job(2, UccJob::UCC_JOB_CTX_GLOBAL,
+               {{"UCC_CLS", "basic"}, {"UCC_LAZY_TLS", "ucp"}});
+    ctx = job.procs[0]->ctx_h;
+    EXPECT_EQ(0, ucc_context_tl_is_lazy(ctx, "ucp"));
+    tl_ctx = find_tl_ctx(ctx, "ucp");
+    ASSERT_NE(nullptr, tl_ctx);
+    EXPECT_EQ(0, tl_ctx->lazy);
+    UccTeam_h team = job.create_team(2);
+}
+
+class test_context_wait : public ucc::test {
+public:
+    static int event_fd(ucc_context_h ctx)
+    {
+        ucc_context_attr_t attr;
+
+        attr.mask = UCC_CONTEXT_ATTR_FIELD_EVENT_FD;
+        EXPECT_EQ(UCC_OK, ucc_context_get_attr(ctx, &attr));
+        return attr.event_fd;
+    }
+
+    /* arms the context, progressing it while events are pending */
+    static ucc_status_t arm(ucc_context_h ctx)
+    {
+        ucc_status_t status;
+        int          i;
+
+        for (i = 0; i < 1000; i++) {
+            status = ucc_context_arm(ctx);
+            if (status != UCC_INPROGRESS) {
+                break;
+            }
+            ucc_context_progress(ctx);
+        }
+        return status;
+    }
+};
+
+/* no component registered an event fd: context can't be armed and wait
+   busy polls */
+UCC_TEST_F(test_context_wait, not_armable)
+{
+    UccJob          job(1, UccJob::UCC_JOB_CTX_GLOBAL,
+                        {{"UCC_TL_UCP_WAKEUP", "n"}});
+    UccTeam_h       team = job.create_team(1);
+    ucc_context_h   ctx  = job.procs[0]->ctx_h;
+    ucc_coll_args_t args = {};
+
+    EXPECT_EQ(-1, event_fd(ctx));
+    EXPECT_EQ(UCC_ERR_NOT_SUPPORTED, ucc_context_arm(ctx));
+
+    args.coll_type = UCC_COLL_TYPE_BARRIER;
+    UccReq req(team, &args);
+    ASSERT_EQ(1, req.reqs.size());
+    req.start();
+    EXPECT_EQ(UCC_OK, ucc_context_wait(ctx, req.reqs[0]));
+}
+
+/* wait sleeps on the event fd and is woken up by the peer: sleep timeout
+   is large, so the barrier completes in time only if the fd signals */
+UCC_TEST_F(test_context_wait, event_fd_wakeup)
+{
+    const int       n_procs = 2;
+    UccJob          job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                        {{"UCC_CLS", "basic"},
+                         {"UCC_TL_UCP_WAKEUP", "y"},
+                         {"UCC_WAIT_SPIN_TIME", "0"},
+                         {"UCC_WAIT_SLEEP_TIMEOUT", "30s"}});
+    UccTeam_h       team = job.create_team(n_procs);
+    ucc_coll_args_t args = {};
+    ucc_status_t    st[n_procs];
+
+    if (event_fd(job.procs[0]->ctx_h) < 0) {
+        GTEST_SKIP() << "ucp worker wakeup is not supported";
+    }
+
+    args.coll_type = UCC_COLL_TYPE_BARRIER;
+    UccReq req(team, &args);
+    ASSERT_EQ(n_procs, req.reqs.size());
+    req.start();
+
+    auto start = std::chrono::steady_clock::now();
+    /* rank 0 goes to sleep first, rank 1 joins later and wakes it up */
+    std::thread t([&]() {
+        st[0] = ucc_context_wait(job.procs[0]->ctx_h, req.reqs[0]);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    st[1] = ucc_context_wait(job.procs[1]->ctx_h, req.reqs[1]);
+    t.join();
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(UCC_OK, st[0]);
+    EXPECT_EQ(UCC_OK, st[1]);
+    EXPECT_LT(std::chrono::duration<double>(end - start).count(), 10.0);
+}
+
+/* armed context fd becomes readable when a message arrives */
+UCC_TEST_F(test_context_wait, arm)
+{
+    const int       n_procs = 2;
+    UccJob          job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                        {{"UCC_CLS", "basic"}, {"UCC_TL_UCP_WAKEUP", "y"}});
+    UccTeam_h       team = job.create_team(n_procs);
+    ucc_context_h   ctx  = job.procs[0]->ctx_h;
+    ucc_coll_args_t args = {};
+    struct pollfd   pfd;
+
+    pfd.fd     = event_fd(ctx);
+    pfd.events = POLLIN;
+    if (pfd.fd < 0) {
+        GTEST_SKIP() << "ucp worker wakeup is not supported";
+    }
+    args.coll_type = UCC_COLL_TYPE_BARRIER;
+    UccReq req(team, &args);
+    ASSERT_EQ(n_procs, req.reqs.size());
+    req.start();
+    ASSERT_EQ(UCC_OK, arm(ctx));
+    /* rank 1 sends its barrier message to rank 0 */
+    for (int i = 0; i < 100; i++) {
+        ucc_context_progress(job.procs[1]->ctx_h);
+    }
+    EXPECT_EQ(1, poll(&pfd, 1, 10000));
+    req.wait();
+}
+
+/* collective using an executor completes without any event fd signal, the
+   context is not armable while it is in flight */
+UCC_TEST_F(test_context_wait, executor_not_armable)
+{
+    const int          n_procs = 2;
+    const size_t       count   = 1024;
+    UccJob             job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                           {{"UCC_CLS", "basic"},
+                            {"UCC_TL_UCP_WAKEUP", "y"},
+                            {"UCC_TL_UCP_TUNE", "allreduce:@knomial:inf"}});
+    UccTeam_h          team = job.create_team(n_procs);
+    ucc_context_h      ctx  = job.procs[0]->ctx_h;
+    std::vector<float> bufs[n_procs];
+    UccCollCtxVec      ctxs;
+
+    if (event_fd(ctx) < 0) {
+        GTEST_SKIP() << "ucp worker wakeup is not supported";
+    }
+    ctxs.resize(n_procs);
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        bufs[r].assign(count, (float)r);
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args           = coll;
+        coll->coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+        coll->mask              = UCC_COLL_ARGS_FIELD_FLAGS;
+        coll->flags             = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        coll->op                = UCC_OP_SUM;
+        coll->dst.info.buffer   = bufs[r].data();
+        coll->dst.info.count    = count;
+        coll->dst.info.datatype = UCC_DT_FLOAT32;
+        coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    }
+    {
+        UccReq req(team, ctxs);
+        ASSERT_EQ(n_procs, req.reqs.size());
+        req.start();
+        EXPECT_EQ(1u, ctx->n_executor_colls);
+        EXPECT_EQ(UCC_INPROGRESS, ucc_context_arm(ctx));
+        req.wait();
+        EXPECT_EQ(0u, ctx->n_executor_colls);
+        EXPECT_EQ(UCC_OK, arm(ctx));
+    }
+    for (auto c : ctxs) {
+        free(c->args);
+        free(c);
+    }
+}
+
+class test_context_progress_thread : public ucc::test {
+public:
+    /* waits until the progress thread goes to sleep on empty queue */
+    static bool wait_sleeping(ucc_context_h ctx)
+    {
+        for (int i = 0; i < 10000; i++) {
+            if (ctx->progress_thread->sleeping) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+};
+
+/* thread is started only for UCC_THREAD_MULTIPLE and is stopped by context
+   destroy */
+UCC_TEST_F(test_context_progress_thread, start_stop)
+{
+    ucc_job_env_t env = {{"UCC_PROGRESS_THREAD", "y"},
+                         {"UCC_WAIT_SPIN_TIME", "0"}};
+    {
+        UccJob job(1, UccJob::UCC_JOB_CTX_GLOBAL, env);
+
+        EXPECT_EQ(nullptr, job.procs[0]->ctx_h->progress_thread);
+    }
+    {
+        UccJob job(2, UccJob::UCC_JOB_CTX_GLOBAL, env, UCC_THREAD_MULTIPLE);
+
+        for (auto &p : job.procs) {
+            ASSERT_NE(nullptr, p->ctx_h->progress_thread);
+            EXPECT_EQ(p->ctx_h, p->ctx_h->progress_thread->ctx);
+            /* idle thread goes to sleep */
+            EXPECT_TRUE(wait_sleeping(p->ctx_h));
+        }
+    }
+}
+
+/* posted collective completes w/o any progress call from the user. Sleep
+   timeout is large, so the thread sleeping on empty queue completes it in
+   time only if post wakes it up */
+UCC_TEST_F(test_context_progress_thread, coll_progress)
+{
+    const int          n_procs = 2;
+    const size_t       count   = 1024;
+    UccJob             job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                           {{"UCC_CLS", "basic"},
+                            {"UCC_PROGRESS_THREAD", "y"},
+                            {"UCC_WAIT_SPIN_TIME", "0"},
+                            {"UCC_WAIT_SLEEP_TIMEOUT", "30s"}},
+                           UCC_THREAD_MULTIPLE);
+    UccTeam_h          team = job.create_team(n_procs);
+    std::vector<float> bufs[n_procs];
+    UccCollCtxVec      ctxs(n_procs);
+    ucc_status_t       st;
+
+    for (int r = 0; r < n_procs; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        bufs[r].assign(count, (float)(r + 1));
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args           = coll;
+        coll->coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+        coll->mask              = UCC_COLL_ARGS_FIELD_FLAGS;
+        coll->flags             = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        coll->op                = UCC_OP_SUM;
+        coll->dst.info.buffer   = bufs[r].data();
+        coll->dst.info.count    = count;
+        coll->dst.info.datatype = UCC_DT_FLOAT32;
+        coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    }
+    {
+        UccReq req(team, ctxs);
+        ASSERT_EQ(n_procs, req.reqs.size());
+        for (auto &p : job.procs) {
+            ASSERT_TRUE(wait_sleeping(p->ctx_h));
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (auto r : req.reqs) {
+            EXPECT_EQ(UCC_OK, ucc_collective_post(r));
+        }
+        for (auto r : req.reqs) {
+            while (UCC_INPROGRESS == (st = ucc_collective_test(r))) {
+                std::this_thread::yield();
+            }
+            EXPECT_EQ(UCC_OK, st);
+        }
+        auto end = std::chrono::steady_clock::now();
+        EXPECT_LT(std::chrono::duration<double>(end - start).count(), 10.0);
+        for (int r = 0; r < n_procs; r++) {
+            EXPECT_EQ((float)(n_procs * (n_procs + 1) / 2), bufs[r][0]);
+            EXPECT_EQ(bufs[r][0], bufs[r][count - 1]);
+        }
+    }
+    for (auto c : ctxs) {
+        free(c->args);
+        free(c);
+    }
+}
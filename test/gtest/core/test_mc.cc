@@ -5,7 +5,9 @@
 
 extern "C" {
 #include <components/mc/ucc_mc.h>
+#include <components/mc/ucc_mc_memtype_cache.h>
 #include <pthread.h>
+#include <sys/mman.h>
 }
 #include <common/test.h>
 #include <vector>
@@ -127,3 +129,89 @@ UCC_TEST_F(test_mc, init_twice)
 
     ucc_lib_config_release(cfg);
 }
+
+UCC_TEST_F(test_mc, memtype_cache_invalidate_on_unmap)
+{
+    size_t            size = 4 * 4096;
+    ucc_memory_type_t mt;
+    void             *ptr;
+
+    ASSERT_EQ(UCC_OK, ucc_constructor());
+    ASSERT_EQ(UCC_OK, ucc_mc_memtype_cache_init());
+    ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, ptr);
+    EXPECT_EQ(UCC_ERR_NOT_FOUND, ucc_mc_memtype_cache_lookup(ptr, &mt));
+    ucc_mc_memtype_cache_update(ptr, UCC_MEMORY_TYPE_CUDA);
+    if (UCC_OK != ucc_mc_memtype_cache_lookup(ptr, &mt)) {
+        munmap(ptr, size);
+        ucc_mc_memtype_cache_finalize();
+        UCC_TEST_SKIP_R("ucm memory events are not available");
+    }
+    EXPECT_EQ(UCC_MEMORY_TYPE_CUDA, mt);
+    munmap(ptr, size);
+    EXPECT_EQ(UCC_ERR_NOT_FOUND, ucc_mc_memtype_cache_lookup(ptr, &mt));
+    ucc_mc_memtype_cache_finalize();
+}
+
+/* a cache hit skips mem_query, queries of base address or length are
+   neither answered from nor stored in the cache */
+UCC_TEST_F(test_mc, memtype_cache_get_mem_attr)
+{
+    size_t            size      = 4 * 4096;
+    ucc_mc_params_t   mc_params = {
+        .thread_mode = UCC_THREAD_SINGLE,
+    };
+    ucc_mem_attr_t    attr;
+    ucc_memory_type_t mt;
+    void             *ptr, *ptr2;
+
+    ASSERT_EQ(UCC_OK, ucc_constructor());
+    ASSERT_EQ(UCC_OK, ucc_mc_init(&mc_params));
+    if (UCC_OK != ucc_mc_available(UCC_MEMORY_TYPE_CUDA) &&
+        UCC_OK != ucc_mc_available(UCC_MEMORY_TYPE_ROCM)) {
+        ucc_mc_finalize();
+        UCC_TEST_SKIP_R("memtype cache is used with non host mc only");
+    }
+    ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, ptr);
+    ptr2 = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, ptr2);
+
+    /* host buffer is cached as CUDA: only a hit can report CUDA */
+    ucc_mc_memtype_cache_update(ptr, UCC_MEMORY_TYPE_CUDA);
+    if (UCC_OK != ucc_mc_memtype_cache_lookup(ptr, &mt)) {
+        munmap(ptr, size);
+        munmap(ptr2, size);
+        ucc_mc_finalize();
+        UCC_TEST_SKIP_R("memtype cache is disabled");
+    }
+    attr.field_mask = UCC_MEM_ATTR_FIELD_MEM_TYPE;
+    EXPECT_EQ(UCC_OK, ucc_mc_get_mem_attr(ptr, &attr));
+    EXPECT_EQ(UCC_MEMORY_TYPE_CUDA, attr.mem_type);
+
+    attr.field_mask = UCC_MEM_ATTR_FIELD_MEM_TYPE |
+                      UCC_MEM_ATTR_FIELD_BASE_ADDRESS |
+                      UCC_MEM_ATTR_FIELD_ALLOC_LENGTH;
+    attr.alloc_length = size;
+    EXPECT_EQ(UCC_OK, ucc_mc_get_mem_attr(ptr, &attr));
+    EXPECT_EQ(UCC_MEMORY_TYPE_HOST, attr.mem_type);
+
+    /* address and length queries are not cached */
+    EXPECT_EQ(UCC_OK, ucc_mc_get_mem_attr(ptr2, &attr));
+    EXPECT_EQ(UCC_MEMORY_TYPE_HOST, attr.mem_type);
+    EXPECT_EQ(UCC_ERR_NOT_FOUND, ucc_mc_memtype_cache_lookup(ptr2, &mt));
+
+    /* memory type only query result is cached */
+    attr.field_mask = UCC_MEM_ATTR_FIELD_MEM_TYPE;
+    EXPECT_EQ(UCC_OK, ucc_mc_get_mem_attr(ptr2, &attr));
+    EXPECT_EQ(UCC_MEMORY_TYPE_HOST, attr.mem_type);
+    EXPECT_EQ(UCC_OK, ucc_mc_memtype_cache_lookup(ptr2, &mt));
+    EXPECT_EQ(UCC_MEMORY_TYPE_HOST, mt);
+
+    munmap(ptr, size);
+    munmap(ptr2, size);
+    ucc_mc_finalize();
+}
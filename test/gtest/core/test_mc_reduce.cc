@@ -6,7 +6,9 @@
 #include "test_mc_reduce.h"
 extern "C" {
 #include "components/ec/ucc_ec.h"
+#include "core/ucc_dt.h"
 }
+#include <vector>
 
 #ifdef HAVE_CUDA
 #include <cuda_runtime.h>
@@ -417,6 +419,102 @@ DECLARE_REDUCE_MULTI_TEST(float, HOST);
 
 DECLARE_REDUCE_MULTI_ALPHA_TEST(float, HOST);
 
+class test_mc_reduce_loc : public testing::Test {
+  protected:
+    static const int   COUNT  = 1024;
+    static const int   N_SRCS = 5;
+    ucc_ee_executor_t *executor;
+
+    virtual void SetUp() override
+    {
+        ucc_ee_executor_params_t params;
+        ucc_constructor();
+        ucc_mc_params_t mc_params = {
+            .thread_mode = UCC_THREAD_SINGLE,
+        };
+        ucc_ec_params_t ec_params = {
+            .thread_mode = UCC_THREAD_SINGLE,
+        };
+        ucc_mc_init(&mc_params);
+        ucc_ec_init(&ec_params);
+        params.mask    = UCC_EE_EXECUTOR_PARAM_FIELD_TYPE;
+        params.ee_type = UCC_EE_CPU_THREAD;
+        ASSERT_EQ(UCC_OK, ucc_ee_executor_init(&params, &executor));
+        ASSERT_EQ(UCC_OK, ucc_ee_executor_start(executor, NULL));
+    }
+
+    virtual void TearDown() override
+    {
+        ucc_ee_executor_stop(executor);
+        ucc_ee_executor_finalize(executor);
+        ucc_mc_finalize();
+    }
+
+    /* srcs[j][i] value is chosen so that every element has ties between
+       some of the sources, index of the source is used as pair index */
+    template <typename T>
+    void test_loc(ucc_datatype_t dt, ucc_reduction_op_t op)
+    {
+        std::vector<T>              srcs(N_SRCS * COUNT), res(COUNT);
+        ucc_ee_executor_task_args_t eargs;
+        ucc_ee_executor_task_t     *task;
+        ucc_status_t                status;
+
+        for (int j = 0; j < N_SRCS; j++) {
+            for (int i = 0; i < COUNT; i++) {
+                srcs[j * COUNT + i].v = (i + 3 * j) % 4;
+                srcs[j * COUNT + i].i = N_SRCS - j;
+            }
+        }
+        eargs.flags                 = 0;
+        eargs.task_type             = UCC_EE_EXECUTOR_TASK_REDUCE_STRIDED;
+        eargs.reduce_strided.count  = COUNT;
+        eargs.reduce_strided.dt     = dt;
+        eargs.reduce_strided.op     = op;
+        eargs.reduce_strided.n_src2 = N_SRCS - 1;
+        eargs.reduce_strided.dst    = res.data();
+        eargs.reduce_strided.src1   = srcs.data();
+        eargs.reduce_strided.src2   = &srcs[COUNT];
+        eargs.reduce_strided.stride = COUNT * sizeof(T);
+        eargs.reduce_strided.alpha  = 0;
+        ASSERT_EQ(UCC_OK, ucc_ee_executor_task_post(executor, &eargs, &task));
+        while (0 < (status = ucc_ee_executor_task_test(task))) {
+            ;
+        }
+        ucc_ee_executor_task_finalize(task);
+        ASSERT_EQ(UCC_OK, status);
+
+        for (int i = 0; i < COUNT; i++) {
+            T exp = srcs[i];
+            for (int j = 1; j < N_SRCS; j++) {
+                const T &s = srcs[j * COUNT + i];
+                if ((op == UCC_OP_MINLOC ? s.v < exp.v : s.v > exp.v) ||
+                    (s.v == exp.v && s.i < exp.i)) {
+                    exp = s;
+                }
+            }
+            ASSERT_EQ(exp.v, res[i].v);
+            ASSERT_EQ(exp.i, res[i].i);
+        }
+    }
+};
+
+TEST_F(test_mc_reduce_loc, minloc)
+{
+    test_loc<ucc_float32_int32_t>(UCC_DT_FLOAT32_INT32, UCC_OP_MINLOC);
+    test_loc<ucc_float64_int32_t>(UCC_DT_FLOAT64_INT32, UCC_OP_MINLOC);
+    test_loc<ucc_int64_int32_t>(UCC_DT_INT64_INT32, UCC_OP_MINLOC);
+    test_loc<ucc_int32_int32_t>(UCC_DT_INT32_INT32, UCC_OP_MINLOC);
+}
+
+TEST_F(test_mc_reduce_loc, maxloc)
+{
+    test_loc<ucc_float32_int32_t>(UCC_DT_FLOAT32_INT32, UCC_OP_MAXLOC);
+    test_loc<ucc_float64_int32_t>(UCC_DT_FLOAT64_INT32, UCC_OP_MAXLOC);
+    test_loc<ucc_int64_int32_t>(UCC_DT_INT64_INT32, UCC_OP_MAXLOC);
+    test_loc<ucc_int32_int32_t>(UCC_DT_INT32_INT32, UCC_OP_MAXLOC);
+}
+
 #ifdef HAVE_CUDA
 DECLARE_REDUCE_TEST(int, CUDA);
 DECLARE_REDUCE_TEST(uint, CUDA);
@@ -8,6 +8,7 @@ extern "C" {
 }
 #include <algorithm>
 #include <random>
+#include <cstring>
 
 class test_team : public ucc::test, public::testing::WithParamInterface<int> {
 };
@@ -121,3 +122,108 @@ UCC_TEST_F(test_team, team_get_attr)
     /* shuffle vector so that teams are destroyed in different order */
     std::shuffle(teams.begin(), teams.end(), std::default_random_engine());
 }
+
+UCC_TEST_F(test_team, team_get_attr_coll_stats)
+{
+    int              team_size = 4;
+    uint64_t         n_colls   = 3;
+    int              ct        = ucc_ilog2(UCC_COLL_TYPE_BARRIER);
+    UccTeam_h        team      = UccJob::getStaticJob()->create_team(team_size);
+    ucc_coll_args_t  coll;
+    ucc_coll_stats_t stats;
+    ucc_team_attr_t  attr;
+    uint64_t         n_selected;
+
+    coll.mask      = UCC_COLL_ARGS_FIELD_FLAGS;
+    coll.flags     = UCC_COLL_ARGS_FLAG_PERSISTENT;
+    coll.coll_type = UCC_COLL_TYPE_BARRIER;
+    {
+        UccReq req(team, &coll);
+
+        for (uint64_t i = 0; i < n_colls; i++) {
+            req.start();
+            EXPECT_EQ(UCC_OK, req.wait());
+        }
+    }
+
+    attr.mask       = UCC_TEAM_ATTR_FIELD_COLL_STATS;
+    attr.coll_stats = &stats;
+    for (auto &p : team->procs) {
+        EXPECT_EQ(UCC_OK, ucc_team_get_attr(p.team, &attr));
+        EXPECT_EQ(1ul, stats.colls[ct].n_init);
+        EXPECT_EQ(n_colls, stats.colls[ct].n_complete);
+        EXPECT_EQ(0ul, stats.colls[ct].n_errors);
+        EXPECT_EQ(0ul, stats.colls[ct].bytes);
+        EXPECT_LE(1u, stats.n_components);
+        n_selected = 0;
+        for (uint32_t i = 0; i < stats.n_components; i++) {
+            n_selected += stats.components[i].n_colls[ct];
+        }
+        EXPECT_EQ(1ul, n_selected);
+    }
+
+    attr.coll_stats = NULL;
+    EXPECT_EQ(UCC_ERR_INVALID_PARAM,
+              ucc_team_get_attr(team->procs[0].team, &attr));
+}
+
+UCC_TEST_F(test_team, team_get_attr_coll_stats_alg)
+{
+    int              team_size = 4;
+    uint64_t         n_colls   = 3;
+    size_t           count     = 64;
+    ucc_job_env_t    env       = {{"UCC_CLS", "basic"},
+                                  {"UCC_TL_UCP_TUNE",
+                                   "allreduce:@knomial:inf"}};
+    UccJob           job(team_size, UccJob::UCC_JOB_CTX_GLOBAL, env);
+    UccTeam_h        team      = job.create_team(team_size);
+    std::vector<std::vector<float>> bufs(team_size,
+                                         std::vector<float>(count, 1));
+    UccCollCtxVec    ctxs(team_size);
+    ucc_coll_stats_t stats;
+    ucc_team_attr_t  attr;
+    uint32_t         i;
+
+    for (int r = 0; r < team_size; r++) {
+        ucc_coll_args_t *coll = (ucc_coll_args_t *)
+            calloc(1, sizeof(ucc_coll_args_t));
+
+        ctxs[r] = (gtest_ucc_coll_ctx_t *)
+            calloc(1, sizeof(gtest_ucc_coll_ctx_t));
+        ctxs[r]->args           = coll;
+        coll->mask              = UCC_COLL_ARGS_FIELD_FLAGS;
+        coll->flags             = UCC_COLL_ARGS_FLAG_IN_PLACE;
+        coll->coll_type         = UCC_COLL_TYPE_ALLREDUCE;
+        coll->op                = UCC_OP_SUM;
+        coll->dst.info.buffer   = bufs[r].data();
+        coll->dst.info.count    = count;
+        coll->dst.info.datatype = UCC_DT_FLOAT32;
+        coll->dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    }
+    for (uint64_t n = 0; n < n_colls; n++) {
+        UccReq req(team, ctxs);
+
+        req.start();
+        EXPECT_EQ(UCC_OK, req.wait());
+    }
+    for (auto ctx : ctxs) {
+        free(ctx->args);
+        free(ctx);
+    }
+
+    attr.mask       = UCC_TEAM_ATTR_FIELD_COLL_STATS;
+    attr.coll_stats = &stats;
+    for (auto &p : team->procs) {
+        EXPECT_EQ(UCC_OK, ucc_team_get_attr(p.team, &attr));
+        for (i = 0; i < stats.n_algs; i++) {
+            if (stats.algs[i].coll_type == UCC_COLL_TYPE_ALLREDUCE) {
+                break;
+            }
+        }
+        ASSERT_LT(i, stats.n_algs);
+        EXPECT_STREQ("knomial", stats.algs[i].name);
+        EXPECT_EQ(0, stats.algs[i].id);
+        EXPECT_EQ(n_colls, stats.algs[i].n_colls);
+        EXPECT_NE(nullptr, strstr(stats.algs[i].component, "UCP"));
+    }
+}
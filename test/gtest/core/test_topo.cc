@@ -512,3 +512,121 @@ UCC_TEST_F(test_topo, 4sockets_all)
     EXPECT_EQ(true, check_sbgp(&sbgps[0], {0, 1, 3, 4}));
     EXPECT_EQ(true, check_sbgp(&sbgps[1], {2}));
 }
+
+/* Root of rooted collective over the host ordered sbgp, same conversion as
+   ucc_tl_ucp_task_subset_root does for reordered tasks */
+static ucc_rank_t ordered_root(ucc_sbgp_t *sbgp, ucc_rank_t root)
+{
+    return ucc_ep_map_local_rank(sbgp->map, root);
+}
+
+UCC_TEST_F(test_topo, full_ordered_sorted)
+{
+    const ucc_rank_t ctx_size = 6;
+    addr_storage     s(ctx_size);
+    ucc_sbgp_t *     sbgp;
+    ucc_subset_t     set;
+
+    /* already ordered: hosts and sockets are contiguous */
+    SET_PI(s, 0, 0xaaa, 0, 0);
+    SET_PI(s, 1, 0xaaa, 0, 1);
+    SET_PI(s, 2, 0xaaa, 1, 2);
+    SET_PI(s, 3, 0xbbb, 0, 3);
+    SET_PI(s, 4, 0xbbb, 1, 4);
+    SET_PI(s, 5, 0xbbb, 1, 5);
+
+    set.map.ep_num = ctx_size;
+    set.map.type   = UCC_EP_MAP_FULL;
+    set.myrank     = 4;
+
+    EXPECT_EQ(UCC_OK, ucc_context_topo_init(&s.storage, &ctx_topo));
+    EXPECT_EQ(UCC_OK, ucc_topo_init(set, ctx_topo, &topo));
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_FULL_HOST_ORDERED);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(4, sbgp->group_rank);
+    EXPECT_EQ(true, check_sbgp(sbgp, {0, 1, 2, 3, 4, 5}));
+    for (ucc_rank_t r = 0; r < ctx_size; r++) {
+        EXPECT_EQ(r, ordered_root(sbgp, r));
+    }
+}
+
+UCC_TEST_F(test_topo, full_ordered_interleaved)
+{
+    const ucc_rank_t ctx_size = 6;
+    addr_storage     s(ctx_size);
+    ucc_sbgp_t *     sbgp;
+    ucc_subset_t     set;
+
+    /* hosts and sockets are interleaved, ranks on the same socket keep
+       their original order: 2 | 0, 4 | 1, 3 | 5 */
+    SET_PI(s, 0, 0xaaa, 1, 0);
+    SET_PI(s, 1, 0xbbb, 0, 1);
+    SET_PI(s, 2, 0xaaa, 0, 2);
+    SET_PI(s, 3, 0xbbb, 0, 3);
+    SET_PI(s, 4, 0xaaa, 1, 4);
+    SET_PI(s, 5, 0xbbb, 1, 5);
+
+    set.map.ep_num = ctx_size;
+    set.map.type   = UCC_EP_MAP_FULL;
+    set.myrank     = 4;
+
+    EXPECT_EQ(UCC_OK, ucc_context_topo_init(&s.storage, &ctx_topo));
+    EXPECT_EQ(UCC_OK, ucc_topo_init(set, ctx_topo, &topo));
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_FULL_HOST_ORDERED);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(ctx_size, sbgp->group_size);
+    EXPECT_EQ(2, sbgp->group_rank);
+    EXPECT_EQ(true, check_sbgp(sbgp, {2, 0, 4, 1, 3, 5}));
+    /* team root is converted into its position in the ordered group */
+    EXPECT_EQ(1, ordered_root(sbgp, 0));
+    EXPECT_EQ(0, ordered_root(sbgp, 2));
+    EXPECT_EQ(4, ordered_root(sbgp, 3));
+    EXPECT_EQ(5, ordered_root(sbgp, 5));
+
+    /* same order from another rank perspective */
+    ucc_topo_cleanup(topo);
+    set.myrank = 3;
+    EXPECT_EQ(UCC_OK, ucc_topo_init(set, ctx_topo, &topo));
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_FULL_HOST_ORDERED);
+    EXPECT_EQ(4, sbgp->group_rank);
+    EXPECT_EQ(true, check_sbgp(sbgp, {2, 0, 4, 1, 3, 5}));
+}
+
+UCC_TEST_F(test_topo, full_ordered_subset)
+{
+    const ucc_rank_t ctx_size              = 6;
+    const ucc_rank_t team_size             = 4;
+    ucc_rank_t       team_ranks[team_size] = {5, 1, 2, 0};
+    addr_storage     s(ctx_size);
+    ucc_sbgp_t *     sbgp;
+    ucc_subset_t     set;
+
+    SET_PI(s, 0, 0xaaa, 1, 0);
+    SET_PI(s, 1, 0xbbb, 0, 1);
+    SET_PI(s, 2, 0xaaa, 0, 2);
+    SET_PI(s, 3, 0xbbb, 0, 3);
+    SET_PI(s, 4, 0xaaa, 1, 4);
+    SET_PI(s, 5, 0xbbb, 1, 5);
+
+    /* proc info is taken by context rank of the team member, the map
+       contains team ranks */
+    set.map.ep_num          = team_size;
+    set.map.type            = UCC_EP_MAP_ARRAY;
+    set.map.array.map       = team_ranks;
+    set.map.array.elem_size = sizeof(ucc_rank_t);
+    set.myrank              = 0;
+
+    EXPECT_EQ(UCC_OK, ucc_context_topo_init(&s.storage, &ctx_topo));
+    EXPECT_EQ(UCC_OK, ucc_topo_init(set, ctx_topo, &topo));
+
+    sbgp = ucc_topo_get_sbgp(topo, UCC_SBGP_FULL_HOST_ORDERED);
+    EXPECT_EQ(UCC_SBGP_ENABLED, sbgp->status);
+    EXPECT_EQ(team_size, sbgp->group_size);
+    EXPECT_EQ(3, sbgp->group_rank);
+    EXPECT_EQ(true, check_sbgp(sbgp, {2, 3, 1, 0}));
+    for (ucc_rank_t r = 0; r < team_size; r++) {
+        EXPECT_EQ(r, ucc_ep_map_eval(sbgp->map, ordered_root(sbgp, r)));
+    }
+}
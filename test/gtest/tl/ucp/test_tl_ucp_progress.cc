@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * See file LICENSE for terms.
+ */
+
+#include "common/test_ucc.h"
+extern "C" {
+#include "core/ucc_context.h"
+#include "components/tl/ucp/tl_ucp.h"
+}
+
+class test_tl_ucp_progress : public ucc::test {
+public:
+    static ucc_tl_ucp_context_t *tl_ctx(ucc_context_h ctx)
+    {
+        ucc_tl_lib_t *tl_lib;
+        unsigned      i;
+
+        for (i = 0; i < ctx->n_tl_ctx; i++) {
+            tl_lib = ucc_derived_of(ctx->tl_ctx[i]->super.lib, ucc_tl_lib_t);
+            if (0 == strcmp(tl_lib->iface->super.name, "ucp")) {
+                return ucc_derived_of(ctx->tl_ctx[i], ucc_tl_ucp_context_t);
+            }
+        }
+        return NULL;
+    }
+
+    static void barrier(UccTeam_h team, int n_colls)
+    {
+        ucc_coll_args_t args = {};
+
+        args.coll_type = UCC_COLL_TYPE_BARRIER;
+        for (int i = 0; i < n_colls; i++) {
+            UccReq req(team, &args);
+            req.start();
+            EXPECT_EQ(UCC_OK, req.wait());
+        }
+    }
+};
+
+/* pass counters of the worker follow context progress passes and the
+   adaptive budget stays within [1, NPOLLS] */
+UCC_TEST_F(test_tl_ucp_progress, coalesced_counters)
+{
+    const int             n_procs = 2;
+    UccJob                job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                              {{"UCC_CLS", "basic"},
+                               {"UCC_TL_UCP_NPOLLS", "4"},
+                               {"UCC_TL_UCP_COALESCED_PROGRESS", "y"}});
+    UccTeam_h             team = job.create_team(n_procs);
+    ucc_tl_ucp_context_t *ctx;
+    ucc_tl_ucp_worker_t  *w;
+
+    barrier(team, 8);
+    for (auto &p : job.procs) {
+        ctx = tl_ctx(p->ctx_h);
+        ASSERT_NE(nullptr, ctx);
+        w = &ctx->worker;
+        EXPECT_EQ(1, ctx->cfg.coalesced_progress);
+        EXPECT_LT(0u, p->ctx_h->progress_seq);
+        EXPECT_LT(0u, w->pass_seq);
+        EXPECT_GE(p->ctx_h->progress_seq, w->pass_seq);
+        EXPECT_EQ(4u, w->pass_max_budget);
+        EXPECT_LE(1u, w->pass_budget);
+        EXPECT_GE(w->pass_max_budget, w->pass_budget);
+        EXPECT_GE(w->pass_budget, w->pass_polls);
+        EXPECT_GE(w->pass_polls, w->pass_hits);
+    }
+}
+
+/* counters are not synchronized: they are not used with
+   UCC_THREAD_MULTIPLE */
+UCC_TEST_F(test_tl_ucp_progress, coalesced_thread_multiple)
+{
+    const int             n_procs = 2;
+    UccJob                job(n_procs, UccJob::UCC_JOB_CTX_GLOBAL,
+                              {{"UCC_CLS", "basic"},
+                               {"UCC_TL_UCP_COALESCED_PROGRESS", "y"}},
+                              UCC_THREAD_MULTIPLE);
+    UccTeam_h             team = job.create_team(n_procs);
+    ucc_tl_ucp_context_t *ctx;
+
+    barrier(team, 8);
+    for (auto &p : job.procs) {
+        ctx = tl_ctx(p->ctx_h);
+        ASSERT_NE(nullptr, ctx);
+        EXPECT_EQ(0, ctx->cfg.coalesced_progress);
+        EXPECT_EQ(0u, ctx->worker.pass_seq);
+        EXPECT_EQ(0u, ctx->worker.pass_polls);
+    }
+}
@@ -7,6 +7,7 @@
 extern "C" {
 #include "utils/ucc_parser.h"
 #include "core/ucc_global_opts.h"
+#include "components/cl/ucc_cl.h"
 }
 #include <common/test.h>
 
@@ -112,3 +113,67 @@ UCC_TEST_F(test_cfg_file, env_preference) {
     EXPECT_EQ(123, cfg.bar);
     EXPECT_EQ(1,  cfg.boo);
 }
+
+/* Names are trimmed, empty names and duplicates are skipped */
+UCC_TEST_F(test_cfg_file, names_merge_trim) {
+    const char              *names[] = {" ucp", "self ", " ", "ucp", "\tshm"};
+    ucc_config_names_array_t src;
+    ucc_config_names_array_t dst = {0};
+
+    src.names = (char **)names;
+    src.count = 5;
+    EXPECT_EQ(UCC_OK, ucc_config_names_array_merge_trim(&dst, &src));
+    ASSERT_EQ(3u, dst.count);
+    EXPECT_STREQ("ucp", dst.names[0]);
+    EXPECT_STREQ("self", dst.names[1]);
+    EXPECT_STREQ("shm", dst.names[2]);
+    ucc_config_names_array_free(&dst);
+}
+
+/* TLs of the components filter are taken from CL configs set in cfg file,
+   CL specific sbgp lists are used by hier */
+UCC_TEST_F(test_cfg_file, cl_tls) {
+    std::string              filename = test_dir + "ucc_test_tls.conf";
+    ucc_config_names_array_t tls      = {0};
+    ucc_component_iface_t   *basic, *hier;
+    ucc_status_t             status;
+
+    basic = ucc_get_component(&ucc_global_config.cl_framework, "basic");
+    hier  = ucc_get_component(&ucc_global_config.cl_framework, "hier");
+    if (!basic || !hier) {
+        UCC_TEST_SKIP_R("cl/basic or cl/hier is not available");
+    }
+    EXPECT_EQ(UCC_OK, ucc_parse_file_config(filename.c_str(), &file_cfg));
+    std::swap(ucc_global_config.file_cfg, file_cfg);
+    status = ucc_cl_lib_config_tls(ucc_derived_of(basic, ucc_cl_iface_t),
+                                   "UCC_", &tls);
+    if (UCC_OK == status) {
+        status = ucc_cl_lib_config_tls(ucc_derived_of(hier, ucc_cl_iface_t),
+                                       "UCC_", &tls);
+    }
+    std::swap(ucc_global_config.file_cfg, file_cfg);
+    EXPECT_EQ(UCC_OK, status);
+    ASSERT_EQ(4u, tls.count);
+    EXPECT_STREQ("ucp", tls.names[0]);
+    EXPECT_STREQ("nccl", tls.names[1]);
+    EXPECT_STREQ("shm", tls.names[2]);
+    EXPECT_STREQ("self", tls.names[3]);
+    ucc_config_names_array_free(&tls);
+}
+
+/* Generic TLS list set to "all" means any TL may be used */
+UCC_TEST_F(test_cfg_file, cl_tls_all) {
+    ucc_config_names_array_t tls = {0};
+    ucc_component_iface_t   *basic;
+
+    basic = ucc_get_component(&ucc_global_config.cl_framework, "basic");
+    if (!basic) {
+        UCC_TEST_SKIP_R("cl/basic is not available");
+    }
+    setenv("UCC_CL_BASIC_TLS", "all", 1);
+    EXPECT_EQ(UCC_ERR_NOT_FOUND,
+              ucc_cl_lib_config_tls(ucc_derived_of(basic, ucc_cl_iface_t),
+                                    "UCC_", &tls));
+    unsetenv("UCC_CL_BASIC_TLS");
+    ucc_config_names_array_free(&tls);
+}
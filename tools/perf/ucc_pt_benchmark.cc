@@ -5,6 +5,8 @@
  */
 
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
 #include "ucc_pt_benchmark.h"
 #include "components/mc/ucc_mc.h"
 #include "ucc_perftest.h"
@@ -14,7 +16,9 @@
 ucc_pt_benchmark::ucc_pt_benchmark(ucc_pt_benchmark_config cfg,
                                    ucc_pt_comm *communicator):
     config(cfg),
-    comm(communicator)
+    comm(communicator),
+    n_results(0),
+    compute_rate(0)
 {
     switch (cfg.op_type) {
     case UCC_PT_OP_TYPE_ALLGATHER:
@@ -95,7 +99,9 @@ ucc_status_t ucc_pt_benchmark::run_bench() noexcept
     size_t max_count = coll->has_range() ? config.max_count : 1;
     ucc_status_t       st;
     ucc_pt_test_args_t args;
-    double             time;
+    double             time, compute_time;
+    std::vector<double> iter_time;
+    ucc_pt_overlap_stats ov = {};
 
     print_header();
     for (size_t cnt = min_count; cnt <= max_count; cnt *= config.mult_factor) {
@@ -109,25 +115,36 @@ ucc_status_t ucc_pt_benchmark::run_bench() noexcept
         args.coll_args.root = config.root;
         UCCCHECK_GOTO(coll->init_args(cnt, args), exit_err, st);
         if ((uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST) {
-            UCCCHECK_GOTO(run_single_coll_test(args.coll_args, warmup, iter, time),
+            UCCCHECK_GOTO(run_single_coll_test(args.coll_args, warmup, iter,
+                                               0, time, compute_time,
+                                               iter_time),
                           free_coll, st);
+            if (config.overlap) {
+                UCCCHECK_GOTO(run_overlap_test(args.coll_args, warmup, iter,
+                                               time, ov),
+                              free_coll, st);
+            }
         } else {
             UCCCHECK_GOTO(run_single_executor_test(args.executor_args,
-                                                   warmup, iter, time),
+                                                   warmup, iter, time,
+                                                   iter_time),
                           free_coll, st);
         }
-        print_time(cnt, args, time);
+        print_time(cnt, args, time, iter_time, ov);
         coll->free_args(args);
         if (max_count == 0) {
             /* exit from loop when min_count == max_count == 0 */
             break;
         }
     }
+    print_footer();
 
     return UCC_OK;
 free_coll:
     coll->free_args(args);
 exit_err:
+    /* keep JSON output valid when a case fails */
+    print_footer();
     return st;
 }
 
@@ -139,10 +156,63 @@ static inline double get_time_us(void)
     return t.tv_sec * 1e6 + t.tv_usec;
 }
 
+static double ucc_pt_compute_sink;
+
+/* Dummy CPU bound kernel used to emulate application compute phase, the
+ * dependency chain prevents compiler from vectorizing or removing it */
+static void ucc_pt_compute(size_t n_iters)
+{
+    double acc = ucc_pt_compute_sink;
+
+    for (size_t i = 0; i < n_iters; i++) {
+        acc = acc * 0.999999 + 1.0;
+    }
+    ucc_pt_compute_sink = acc;
+}
+
+void ucc_pt_benchmark::calibrate_compute()
+{
+    size_t n_iters = 1024;
+    double s, t;
+
+    do {
+        n_iters *= 2;
+        s        = get_time_us();
+        ucc_pt_compute(n_iters);
+        t        = get_time_us() - s;
+    } while (t < 10000);
+    compute_rate = n_iters / t;
+}
+
+/* Runs compute kernel for n_iters iterations split into equal chunks with
+ * context progress call between them. Returns time spent in compute only. */
+double ucc_pt_benchmark::run_compute(size_t n_iters)
+{
+    ucc_context_h ctx      = comm->get_context();
+    int           n_chunks = config.n_overlap_progress + 1;
+    size_t        chunk    = n_iters / n_chunks;
+    double        t        = 0;
+    double        s;
+
+    for (int i = 0; i < n_chunks; i++) {
+        s = get_time_us();
+        ucc_pt_compute((i == n_chunks - 1) ?
+                       n_iters - chunk * (n_chunks - 1) : chunk);
+        t += get_time_us() - s;
+        if (i != n_chunks - 1) {
+            ucc_context_progress(ctx);
+        }
+    }
+    return t;
+}
+
 ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
                                                     int nwarmup, int niter,
-                                                    double &time)
-                                                    noexcept
+                                                    size_t compute_iters,
+                                                    double &time,
+                                                    double &compute_time,
+                                                    std::vector<double>
+                                                    &iter_time) noexcept
 {
     const bool    triggered  = config.triggered;
     const bool    persistent = config.persistent;
@@ -154,7 +224,10 @@ ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
     ucc_ev_t comp_ev, *post_ev;
 
     UCCCHECK_GOTO(comm->barrier(), exit_err, st);
-    time = 0;
+    time         = 0;
+    compute_time = 0;
+    iter_time.clear();
+    iter_time.reserve(niter);
 
     if (triggered) {
         try {
@@ -176,6 +249,7 @@ ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
     args.root = config.root % comm->get_size();
     for (int i = 0; i < nwarmup + niter; i++) {
         double s = get_time_us();
+        double c = 0;
 
         if (!persistent) {
             UCCCHECK_GOTO(ucc_collective_init(&args, &req, team), exit_err, st);
@@ -192,6 +266,10 @@ ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
             UCCCHECK_GOTO(ucc_collective_post(req), free_req, st);
         }
 
+        if (compute_iters > 0) {
+            c = run_compute(compute_iters);
+        }
+
         st = ucc_collective_test(req);
         while (st > 0) {
             UCCCHECK_GOTO(ucc_context_progress(ctx), free_req, st);
@@ -206,7 +284,9 @@ ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
             goto exit_err;
         }
         if (i >= nwarmup) {
-            time += f - s;
+            time         += f - s;
+            compute_time += c;
+            iter_time.push_back(f - s);
         }
         args.root = (args.root + config.root_shift) % comm->get_size();
         UCCCHECK_GOTO(comm->barrier(), exit_err, st);
@@ -217,7 +297,8 @@ ucc_status_t ucc_pt_benchmark::run_single_coll_test(ucc_coll_args_t args,
     }
 
     if (niter != 0) {
-        time /= niter;
+        time         /= niter;
+        compute_time /= niter;
     }
     return UCC_OK;
 free_req:
@@ -226,10 +307,49 @@ exit_err:
     return st;
 }
 
+ucc_status_t ucc_pt_benchmark::run_overlap_test(ucc_coll_args_t args,
+                                                int nwarmup, int niter,
+                                                double time,
+                                                ucc_pt_overlap_stats &ov)
+                                                noexcept
+{
+    int                 gsize = comm->get_size();
+    std::vector<double> iter_time;
+    double              time_max, time_total, time_compute, overlap;
+    ucc_status_t        st;
+
+    if (compute_rate == 0) {
+        calibrate_compute();
+    }
+    /* every rank computes for as long as the slowest rank communicates */
+    comm->allreduce(&time, &time_max, 1, UCC_OP_MAX);
+    st = run_single_coll_test(args, nwarmup, niter,
+                              (size_t)(time_max * compute_rate), time_total,
+                              time_compute, iter_time);
+    if (st != UCC_OK) {
+        return st;
+    }
+    /* share of pure communication time hidden behind compute */
+    overlap = 0;
+    if (time > 0) {
+        overlap = 100 * (1 - (time_total - time_compute) / time);
+        overlap = std::min(100.0, std::max(0.0, overlap));
+    }
+    comm->allreduce(&time_compute, &ov.time_compute, 1, UCC_OP_SUM);
+    comm->allreduce(&time_total, &ov.time_total, 1, UCC_OP_SUM);
+    comm->allreduce(&overlap, &ov.overlap, 1, UCC_OP_SUM);
+    ov.time_compute /= gsize;
+    ov.time_total   /= gsize;
+    ov.overlap      /= gsize;
+    return UCC_OK;
+}
+
 ucc_status_t
 ucc_pt_benchmark::run_single_executor_test(ucc_ee_executor_task_args_t args,
                                            int nwarmup, int niter,
-                                           double &time) noexcept
+                                           double &time,
+                                           std::vector<double> &iter_time)
+                                           noexcept
 {
     const bool              triggered = config.triggered;
     ucc_ee_executor_t      *executor  = comm->get_executor();
@@ -238,6 +358,8 @@ ucc_pt_benchmark::run_single_executor_test(ucc_ee_executor_task_args_t args,
     ucc_ee_executor_task_t *task;
 
     time = 0;
+    iter_time.clear();
+    iter_time.reserve(niter);
     if (triggered) {
         try {
             ee = comm->get_ee();
@@ -267,6 +389,7 @@ ucc_pt_benchmark::run_single_executor_test(ucc_ee_executor_task_args_t args,
         }
         if (i >= nwarmup) {
             time += f - s;
+            iter_time.push_back(f - s);
         }
     }
 
@@ -282,117 +405,343 @@ exit_err:
     return st;
 }
 
+bool ucc_pt_benchmark::need_stats()
+{
+    return config.dist_print || config.slowest_print ||
+           config.out_fmt != UCC_PT_OUTPUT_FORMAT_TABLE;
+}
+
+static inline double get_percentile(const std::vector<double> &sorted,
+                                    double p)
+{
+    size_t idx = (size_t)std::ceil(p / 100.0 * sorted.size());
+
+    return sorted[idx > 0 ? idx - 1 : 0];
+}
+
+void ucc_pt_benchmark::get_stats(std::vector<double> &iter_time,
+                                 ucc_pt_time_stats &stats)
+{
+    int                 gsize = comm->get_size();
+    size_t              niter = iter_time.size();
+    std::vector<double> all_time(niter * gsize);
+    double              mean, var, rank_mean;
+
+    if (niter == 0) {
+        return;
+    }
+    comm->allgather(iter_time.data(), all_time.data(), niter);
+
+    mean = 0;
+    for (int r = 0; r < gsize; r++) {
+        rank_mean = 0;
+        for (size_t i = 0; i < niter; i++) {
+            rank_mean += all_time[r * niter + i];
+        }
+        mean      += rank_mean;
+        rank_mean /= niter;
+        if (r == 0 || rank_mean > stats.slowest_time) {
+            stats.slowest_rank = r;
+            stats.slowest_time = rank_mean;
+        }
+    }
+    mean /= all_time.size();
+    var   = 0;
+    for (auto t : all_time) {
+        var += (t - mean) * (t - mean);
+    }
+    stats.stddev = std::sqrt(var / all_time.size());
+
+    std::sort(all_time.begin(), all_time.end());
+    stats.p50  = get_percentile(all_time, 50);
+    stats.p90  = get_percentile(all_time, 90);
+    stats.p99  = get_percentile(all_time, 99);
+    stats.p999 = get_percentile(all_time, 99.9);
+}
+
 void ucc_pt_benchmark::print_header()
 {
-    if (comm->get_rank() == 0) {
-        std::ios iostate(nullptr);
-        iostate.copyfmt(std::cout);
-        std::cout << std::left << std::setw(24)
-                  << "Collective: " << ucc_pt_op_type_str(config.op_type)
-                  << std::endl;
-        std::cout << std::left << std::setw(24)
-                  << "Memory type: " << ucc_memory_type_names[config.mt]
-                  << std::endl;
-        std::cout << std::left << std::setw(24)
-                  << "Datatype: " << ucc_datatype_str(config.dt)
+    if (comm->get_rank() != 0) {
+        return;
+    }
+
+    if (config.out_fmt == UCC_PT_OUTPUT_FORMAT_CSV) {
+        std::cout << "collective,memory_type,datatype,reduction,inplace,"
+                  << "count,size,time_avg,time_min,time_max,"
+                  << "bw_avg,bw_max,bw_min,"
+                  << "p50,p90,p99,p99.9,stddev,slowest_rank,slowest_time,"
+                  << "time_compute,time_total,overlap"
                   << std::endl;
-        std::cout << std::left << std::setw(24)
-                  << "Reduction: "
+        return;
+    }
+
+    if (config.out_fmt == UCC_PT_OUTPUT_FORMAT_JSON) {
+        std::cout << "{" << std::endl
+                  << "  \"collective\": \""
+                  << ucc_pt_op_type_str(config.op_type) << "\"," << std::endl
+                  << "  \"memory_type\": \""
+                  << ucc_memory_type_names[config.mt] << "\"," << std::endl
+                  << "  \"datatype\": \""
+                  << ucc_datatype_str(config.dt) << "\"," << std::endl
+                  << "  \"reduction\": "
                   << (coll->has_reduction() ?
-                        ucc_reduction_op_str(config.op):
-                        "N/A")
-                  << std::endl;
-        std::cout << std::left << std::setw(24)
-                  << "Inplace: "
+                        std::string("\"") + ucc_reduction_op_str(config.op) +
+                        "\"" : "null") << "," << std::endl
+                  << "  \"inplace\": "
                   << (coll->has_inplace() ?
-                        std::to_string(config.inplace):
-                        "N/A")
-                  << std::endl;
-        std::cout << std::left << std::setw(24)
-                  << "Warmup:" << std::endl
-                  << std::left << std::setw(24)
-                  << "  small" << config.n_warmup_small << std::endl
-                  << std::left << std::setw(24)
-                  << "  large" << config.n_warmup_large << std::endl;
-        std::cout << std::left << std::setw(24)
-                  << "Iterations:" << std::endl
-                  << std::left << std::setw(24)
-                  << "  small" << config.n_iter_small << std::endl
-                  << std::left << std::setw(24)
-                  << "  large" << config.n_iter_large << std::endl;
-        std::cout.copyfmt(iostate);
-        std::cout << std::endl;
-        std::cout << std::setw(12) << "Count"
-                  << std::setw(12) << "Size"
-                  << std::setw(24) << "Time, us";
-        if (config.full_print) {
-            std::cout << std::setw(42) << "Bandwidth, GB/s";
-        }
-        std::cout << std::endl;
-        std::cout << std::setw(36) << "avg"
-                  << std::setw(12) << "min"
-                  << std::setw(12) << "max";
-        if (config.full_print) {
-            std::cout << std::setw(12) << "avg"
-                      << std::setw(12) << "max"
-                      << std::setw(12) << "min";
+                        (config.inplace ? "true" : "false") : "null")
+                  << "," << std::endl
+                  << "  \"n_ranks\": " << comm->get_size() << ","
+                  << std::endl
+                  << "  \"results\": [";
+        return;
+    }
+
+    std::ios iostate(nullptr);
+    iostate.copyfmt(std::cout);
+    std::cout << std::left << std::setw(24)
+              << "Collective: " << ucc_pt_op_type_str(config.op_type)
+              << std::endl;
+    std::cout << std::left << std::setw(24)
+              << "Memory type: " << ucc_memory_type_names[config.mt]
+              << std::endl;
+    std::cout << std::left << std::setw(24)
+              << "Datatype: " << ucc_datatype_str(config.dt)
+              << std::endl;
+    std::cout << std::left << std::setw(24)
+              << "Reduction: "
+              << (coll->has_reduction() ?
+                    ucc_reduction_op_str(config.op):
+                    "N/A")
+              << std::endl;
+    std::cout << std::left << std::setw(24)
+              << "Inplace: "
+              << (coll->has_inplace() ?
+                    std::to_string(config.inplace):
+                    "N/A")
+              << std::endl;
+    std::cout << std::left << std::setw(24)
+              << "Warmup:" << std::endl
+              << std::left << std::setw(24)
+              << "  small" << config.n_warmup_small << std::endl
+              << std::left << std::setw(24)
+              << "  large" << config.n_warmup_large << std::endl;
+    std::cout << std::left << std::setw(24)
+              << "Iterations:" << std::endl
+              << std::left << std::setw(24)
+              << "  small" << config.n_iter_small << std::endl
+              << std::left << std::setw(24)
+              << "  large" << config.n_iter_large << std::endl;
+    std::cout.copyfmt(iostate);
+    std::cout << std::endl;
+    std::cout << std::setw(12) << "Count"
+              << std::setw(12) << "Size"
+              << std::setw(24) << "Time, us";
+    if (config.full_print) {
+        std::cout << std::setw(42) << "Bandwidth, GB/s";
+    }
+    if (config.dist_print) {
+        std::cout << std::setw(54) << "Time distribution, us";
+    }
+    if (config.slowest_print) {
+        std::cout << std::setw(30) << "Slowest rank";
+    }
+    if (config.overlap) {
+        std::cout << std::setw(30) << "Overlap";
+    }
+    std::cout << std::endl;
+    std::cout << std::setw(36) << "avg"
+              << std::setw(12) << "min"
+              << std::setw(12) << "max";
+    if (config.full_print) {
+        std::cout << std::setw(12) << "avg"
+                  << std::setw(12) << "max"
+                  << std::setw(12) << "min";
+    }
+    if (config.dist_print) {
+        std::cout << std::setw(12) << "p50"
+                  << std::setw(12) << "p90"
+                  << std::setw(12) << "p99"
+                  << std::setw(12) << "p99.9"
+                  << std::setw(12) << "stddev";
+    }
+    if (config.slowest_print) {
+        std::cout << std::setw(12) << "rank"
+                  << std::setw(12) << "avg";
+    }
+    if (config.overlap) {
+        std::cout << std::setw(12) << "compute"
+                  << std::setw(12) << "total"
+                  << std::setw(12) << "overlap, %";
+    }
+    std::cout << std::endl;
+}
+
+void ucc_pt_benchmark::print_footer()
+{
+    if (comm->get_rank() == 0 &&
+        config.out_fmt == UCC_PT_OUTPUT_FORMAT_JSON) {
+        std::cout << std::endl << "  ]" << std::endl << "}" << std::endl;
+    }
+}
+
+/* Formats value for the selected output, NaN denotes not available value */
+static std::string fmt_value(double v, ucc_pt_output_format_t fmt)
+{
+    std::ostringstream os;
+
+    if (std::isnan(v)) {
+        switch (fmt) {
+        case UCC_PT_OUTPUT_FORMAT_CSV:
+            return "";
+        case UCC_PT_OUTPUT_FORMAT_JSON:
+            return "null";
+        default:
+            return "N/A";
         }
-        std::cout << std::endl;
     }
+    os << std::setprecision(2) << std::fixed << v;
+    return os.str();
 }
 
 void ucc_pt_benchmark::print_time(size_t count, ucc_pt_test_args_t args,
-                                  double time)
+                                  double time, std::vector<double> &iter_time,
+                                  ucc_pt_overlap_stats &ov)
 {
-    double time_us = time;
-    size_t size    = count * ucc_dt_size(config.dt);
-    int    gsize   = comm->get_size();
-    double time_avg, time_min, time_max;
+    double            time_us = time;
+    size_t            size    = count * ucc_dt_size(config.dt);
+    int               gsize   = comm->get_size();
+    const double      na      = NAN;
+    ucc_pt_time_stats stats   = {};
+    double            time_avg, time_min, time_max;
+    double            bw_avg, bw_max, bw_min;
+    double            ov_compute, ov_total, ov_overlap;
 
     comm->allreduce(&time_us, &time_min, 1, UCC_OP_MIN);
     comm->allreduce(&time_us, &time_max, 1, UCC_OP_MAX);
     comm->allreduce(&time_us, &time_avg, 1, UCC_OP_SUM);
     time_avg /= gsize;
+    if (need_stats()) {
+        get_stats(iter_time, stats);
+    }
 
-    if (comm->get_rank() == 0) {
-        std::ios iostate(nullptr);
-        iostate.copyfmt(std::cout);
-        std::cout << std::setprecision(2) << std::fixed;
-        std::cout << std::setw(12) << (coll->has_range() ?
-                                        std::to_string(count):
-                                        "N/A")
-                  << std::setw(12) << (coll->has_range() ?
-                                        std::to_string(size):
-                                        "N/A")
-                  << std::setw(12) << time_avg
-                  << std::setw(12) << time_min
-                  << std::setw(12) << time_max;
-
-        if (config.full_print) {
-            if (!coll->has_bw()) {
-                std::cout << std::setw(12) << "N/A"
-                          << std::setw(12) << "N/A"
-                          << std::setw(12) << "N/A";
-            } else {
-                if (config.op_type == UCC_PT_OP_TYPE_GATHER ||
-                    config.op_type == UCC_PT_OP_TYPE_SCATTER) {
-                    std::cout << std::setw(12) << "N/A"
-                              << std::setw(12) << "N/A"
-                              << std::setw(12) << coll->get_bw(time_max, gsize,
-                                                               args);
-                } else {
-                    std::cout << std::setw(12) << coll->get_bw(time_avg, gsize,
-                                                               args)
-                              << std::setw(12) << coll->get_bw(time_min, gsize,
-                                                               args)
-                              << std::setw(12) << coll->get_bw(time_max, gsize,
-                                                               args);
-                }
-            }
+    if (comm->get_rank() != 0) {
+        return;
+    }
+
+    ov_compute = ov_total = ov_overlap = na;
+    if (config.overlap &&
+        (uint64_t)config.op_type < (uint64_t)UCC_COLL_TYPE_LAST) {
+        ov_compute = ov.time_compute;
+        ov_total   = ov.time_total;
+        ov_overlap = ov.overlap;
+    }
+    bw_avg = bw_max = bw_min = na;
+    if (coll->has_bw()) {
+        if (config.op_type == UCC_PT_OP_TYPE_GATHER ||
+            config.op_type == UCC_PT_OP_TYPE_SCATTER) {
+            bw_min = coll->get_bw(time_max, gsize, args);
+        } else {
+            bw_avg = coll->get_bw(time_avg, gsize, args);
+            bw_max = coll->get_bw(time_min, gsize, args);
+            bw_min = coll->get_bw(time_max, gsize, args);
         }
-        std::cout << std::endl;
-        std::cout.copyfmt(iostate);
     }
+    if (config.out_fmt == UCC_PT_OUTPUT_FORMAT_CSV) {
+        const ucc_pt_output_format_t f = config.out_fmt;
+
+        std::cout << ucc_pt_op_type_str(config.op_type) << ","
+                  << ucc_memory_type_names[config.mt] << ","
+                  << ucc_datatype_str(config.dt) << ","
+                  << (coll->has_reduction() ?
+                        ucc_reduction_op_str(config.op) : "") << ","
+                  << (coll->has_inplace() ?
+                        std::to_string(config.inplace) : "") << ","
+                  << (coll->has_range() ? std::to_string(count) : "") << ","
+                  << (coll->has_range() ? std::to_string(size) : "") << ","
+                  << fmt_value(time_avg, f) << ","
+                  << fmt_value(time_min, f) << ","
+                  << fmt_value(time_max, f) << ","
+                  << fmt_value(bw_avg, f) << ","
+                  << fmt_value(bw_max, f) << ","
+                  << fmt_value(bw_min, f) << ","
+                  << fmt_value(stats.p50, f) << ","
+                  << fmt_value(stats.p90, f) << ","
+                  << fmt_value(stats.p99, f) << ","
+                  << fmt_value(stats.p999, f) << ","
+                  << fmt_value(stats.stddev, f) << ","
+                  << stats.slowest_rank << ","
+                  << fmt_value(stats.slowest_time, f) << ","
+                  << fmt_value(ov_compute, f) << ","
+                  << fmt_value(ov_total, f) << ","
+                  << fmt_value(ov_overlap, f) << std::endl;
+        return;
+    }
+
+    if (config.out_fmt == UCC_PT_OUTPUT_FORMAT_JSON) {
+        const ucc_pt_output_format_t f = config.out_fmt;
+
+        std::cout << (n_results++ ? "," : "") << std::endl
+                  << "    {\"count\": "
+                  << (coll->has_range() ? std::to_string(count) : "null")
+                  << ", \"size\": "
+                  << (coll->has_range() ? std::to_string(size) : "null")
+                  << ", \"time_avg\": " << fmt_value(time_avg, f)
+                  << ", \"time_min\": " << fmt_value(time_min, f)
+                  << ", \"time_max\": " << fmt_value(time_max, f)
+                  << ", \"bw_avg\": " << fmt_value(bw_avg, f)
+                  << ", \"bw_max\": " << fmt_value(bw_max, f)
+                  << ", \"bw_min\": " << fmt_value(bw_min, f)
+                  << ", \"p50\": " << fmt_value(stats.p50, f)
+                  << ", \"p90\": " << fmt_value(stats.p90, f)
+                  << ", \"p99\": " << fmt_value(stats.p99, f)
+                  << ", \"p99.9\": " << fmt_value(stats.p999, f)
+                  << ", \"stddev\": " << fmt_value(stats.stddev, f)
+                  << ", \"slowest_rank\": " << stats.slowest_rank
+                  << ", \"slowest_time\": " << fmt_value(stats.slowest_time, f)
+                  << ", \"time_compute\": " << fmt_value(ov_compute, f)
+                  << ", \"time_total\": " << fmt_value(ov_total, f)
+                  << ", \"overlap\": " << fmt_value(ov_overlap, f)
+                  << "}";
+        return;
+    }
+
+    std::ios iostate(nullptr);
+    iostate.copyfmt(std::cout);
+    std::cout << std::setprecision(2) << std::fixed;
+    std::cout << std::setw(12) << (coll->has_range() ?
+                                    std::to_string(count):
+                                    "N/A")
+              << std::setw(12) << (coll->has_range() ?
+                                    std::to_string(size):
+                                    "N/A")
+              << std::setw(12) << time_avg
+              << std::setw(12) << time_min
+              << std::setw(12) << time_max;
+
+    if (config.full_print) {
+        std::cout << std::setw(12) << fmt_value(bw_avg, config.out_fmt)
+                  << std::setw(12) << fmt_value(bw_max, config.out_fmt)
+                  << std::setw(12) << fmt_value(bw_min, config.out_fmt);
+    }
+    if (config.dist_print) {
+        std::cout << std::setw(12) << stats.p50
+                  << std::setw(12) << stats.p90
+                  << std::setw(12) << stats.p99
+                  << std::setw(12) << stats.p999
+                  << std::setw(12) << stats.stddev;
+    }
+    if (config.slowest_print) {
+        std::cout << std::setw(12) << stats.slowest_rank
+                  << std::setw(12) << stats.slowest_time;
+    }
+    if (config.overlap) {
+        std::cout << std::setw(12) << fmt_value(ov_compute, config.out_fmt)
+                  << std::setw(12) << fmt_value(ov_total, config.out_fmt)
+                  << std::setw(12) << fmt_value(ov_overlap, config.out_fmt);
+    }
+    std::cout << std::endl;
+    std::cout.copyfmt(iostate);
 }
 
 ucc_pt_benchmark::~ucc_pt_benchmark()
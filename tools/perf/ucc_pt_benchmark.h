@@ -11,23 +11,59 @@
 #include "ucc_pt_coll.h"
 #include "ucc_pt_comm.h"
 #include <ucc/api/ucc.h>
+#include <vector>
+
+/* Statistics over per-iteration times of all the ranks */
+struct ucc_pt_time_stats {
+    double p50;
+    double p90;
+    double p99;
+    double p999;
+    double stddev;
+    int    slowest_rank;
+    double slowest_time;
+};
+
+/* Result of compute/communication overlap measurement, averaged over ranks */
+struct ucc_pt_overlap_stats {
+    double time_compute;
+    double time_total;
+    double overlap;
+};
 
 class ucc_pt_benchmark {
     ucc_pt_benchmark_config config;
     ucc_pt_comm *comm;
     ucc_pt_coll *coll;
+    int n_results;
+    double compute_rate;
+
+    void calibrate_compute();
+    double run_compute(size_t n_iters);
 
+    bool need_stats();
+    void get_stats(std::vector<double> &iter_time, ucc_pt_time_stats &stats);
     void print_header();
-    void print_time(size_t count, ucc_pt_test_args_t args, double time);
+    void print_footer();
+    void print_time(size_t count, ucc_pt_test_args_t args, double time,
+                    std::vector<double> &iter_time,
+                    ucc_pt_overlap_stats &ov);
 public:
     ucc_pt_benchmark(ucc_pt_benchmark_config cfg, ucc_pt_comm *communicator);
     ucc_status_t run_bench() noexcept;
     ucc_status_t run_single_coll_test(ucc_coll_args_t args,
                                       int nwarmup, int niter,
-                                      double &time) noexcept;
+                                      size_t compute_iters,
+                                      double &time, double &compute_time,
+                                      std::vector<double> &iter_time) noexcept;
+    ucc_status_t run_overlap_test(ucc_coll_args_t args,
+                                  int nwarmup, int niter, double time,
+                                  ucc_pt_overlap_stats &ov) noexcept;
     ucc_status_t run_single_executor_test(ucc_ee_executor_task_args_t args,
                                           int nwarmup, int niter,
-                                          double &time) noexcept;
+                                          double &time,
+                                          std::vector<double> &iter_time)
+                                          noexcept;
     ~ucc_pt_benchmark();
 };
 
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "ucc_pt_bootstrap_local.h"
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <cstring>
+#include <cstdio>
+#include <stdexcept>
+
+/* Every rank owns two slots, one per parity of the allgather sequence number.
+ * Rank can post allgather N + 2 only after allgather N + 1 completed, i.e.
+ * after all the ranks posted N + 1 and hence finished reading slots of N, so
+ * double buffering is enough to never overwrite data which is still in use. */
+struct ucc_pt_bootstrap_local_slot {
+    uint64_t seq;
+    uint64_t len;
+    char     pad[48];
+    char     data[UCC_PT_BOOTSTRAP_LOCAL_SLOT_SIZE];
+};
+
+struct ucc_pt_bootstrap_local_req {
+    ucc_pt_bootstrap_local_info *info;
+    void                        *rbuf;
+    size_t                       msglen;
+    uint64_t                     seq;
+};
+
+static inline ucc_pt_bootstrap_local_slot *
+local_slot(ucc_pt_bootstrap_local_info *info, uint64_t seq, int rank)
+{
+    ucc_pt_bootstrap_local_slot *slots =
+        (ucc_pt_bootstrap_local_slot *)info->shm;
+
+    return &slots[(seq % 2) * info->size + rank];
+}
+
+static ucc_status_t local_oob_allgather(void *sbuf, void *rbuf, size_t msglen,
+                                        void *coll_info, void **req)
+{
+    ucc_pt_bootstrap_local_info *info = (ucc_pt_bootstrap_local_info *)coll_info;
+    ucc_pt_bootstrap_local_slot *slot;
+    ucc_pt_bootstrap_local_req  *r;
+
+    if (msglen > UCC_PT_BOOTSTRAP_LOCAL_SLOT_SIZE) {
+        std::cerr << "local bootstrap: allgather msg size " << msglen
+                  << " exceeds max " << UCC_PT_BOOTSTRAP_LOCAL_SLOT_SIZE
+                  << std::endl;
+        return UCC_ERR_NO_RESOURCE;
+    }
+    info->seq++;
+    slot = local_slot(info, info->seq, info->rank);
+    memcpy(slot->data, sbuf, msglen);
+    slot->len = msglen;
+    __atomic_store_n(&slot->seq, info->seq, __ATOMIC_RELEASE);
+
+    r         = new ucc_pt_bootstrap_local_req;
+    r->info   = info;
+    r->rbuf   = rbuf;
+    r->msglen = msglen;
+    r->seq    = info->seq;
+    *req      = (void *)r;
+    return UCC_OK;
+}
+
+static ucc_status_t local_oob_allgather_test(void *req)
+{
+    ucc_pt_bootstrap_local_req  *r = (ucc_pt_bootstrap_local_req *)req;
+    ucc_pt_bootstrap_local_slot *slot;
+    int                          i;
+
+    for (i = 0; i < r->info->size; i++) {
+        slot = local_slot(r->info, r->seq, i);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != r->seq) {
+            return UCC_INPROGRESS;
+        }
+    }
+    for (i = 0; i < r->info->size; i++) {
+        slot = local_slot(r->info, r->seq, i);
+        if (slot->len != r->msglen) {
+            std::cerr << "local bootstrap: allgather msg size mismatch"
+                      << std::endl;
+            return UCC_ERR_INVALID_PARAM;
+        }
+        memcpy((char *)r->rbuf + i * r->msglen, slot->data, r->msglen);
+    }
+    return UCC_OK;
+}
+
+static ucc_status_t local_oob_allgather_free(void *req)
+{
+    delete (ucc_pt_bootstrap_local_req *)req;
+    return UCC_OK;
+}
+
+ucc_pt_bootstrap_local::ucc_pt_bootstrap_local(int nprocs)
+{
+    pid_t pid;
+
+    if (nprocs < 1) {
+        throw std::runtime_error("local bootstrap: invalid number of procs");
+    }
+    info.rank = 0;
+    info.size = nprocs;
+    info.seq  = 0;
+    shm_size  = sizeof(ucc_pt_bootstrap_local_slot) * 2 * nprocs;
+    info.shm  = mmap(NULL, shm_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (info.shm == MAP_FAILED) {
+        throw std::runtime_error("local bootstrap: failed to map shm segment");
+    }
+
+    /* avoid duplication of buffered output in children */
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(NULL);
+    for (int r = 1; r < nprocs; r++) {
+        pid = fork();
+        if (pid < 0) {
+            for (auto c : children) {
+                kill(c, SIGTERM);
+            }
+            throw std::runtime_error("local bootstrap: fork failed");
+        }
+        if (pid == 0) {
+            /* terminate child if the launching process dies */
+            prctl(PR_SET_PDEATHSIG, SIGTERM);
+            info.rank = r;
+            children.clear();
+            break;
+        }
+        children.push_back(pid);
+    }
+
+    context_oob.coll_info = (void*)&info;
+    context_oob.allgather = local_oob_allgather;
+    context_oob.req_test  = local_oob_allgather_test;
+    context_oob.req_free  = local_oob_allgather_free;
+    context_oob.n_oob_eps = info.size;
+    context_oob.oob_ep    = info.rank;
+
+    team_oob.coll_info = (void*)&info;
+    team_oob.allgather = local_oob_allgather;
+    team_oob.req_test  = local_oob_allgather_test;
+    team_oob.req_free  = local_oob_allgather_free;
+    team_oob.n_oob_eps = info.size;
+    team_oob.oob_ep    = info.rank;
+}
+
+int ucc_pt_bootstrap_local::get_rank()
+{
+    return info.rank;
+}
+
+int ucc_pt_bootstrap_local::get_size()
+{
+    return info.size;
+}
+
+ucc_pt_bootstrap_local::~ucc_pt_bootstrap_local()
+{
+    int status;
+
+    for (auto c : children) {
+        if (waitpid(c, &status, 0) < 0 || !WIFEXITED(status) ||
+            WEXITSTATUS(status) != 0) {
+            std::cerr << "local bootstrap: rank process " << c
+                      << " terminated abnormally" << std::endl;
+        }
+    }
+    munmap(info.shm, shm_size);
+}
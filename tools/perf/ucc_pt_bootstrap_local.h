@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCC_PT_BOOTSTRAP_LOCAL_H
+#define UCC_PT_BOOTSTRAP_LOCAL_H
+
+#include <sys/types.h>
+#include <vector>
+#include "ucc_pt_bootstrap.h"
+
+/* Max size of a single rank contribution to OOB allgather */
+#define UCC_PT_BOOTSTRAP_LOCAL_SLOT_SIZE (1024 * 1024)
+
+struct ucc_pt_bootstrap_local_info {
+    void    *shm;
+    int      rank;
+    int      size;
+    uint64_t seq;
+};
+
+/* Bootstrap that does not require any launcher: the process forks nprocs - 1
+ * children on the local node, OOB allgather is done over a shared memory
+ * segment mapped before fork */
+class ucc_pt_bootstrap_local: public ucc_pt_bootstrap {
+public:
+    ucc_pt_bootstrap_local(int nprocs);
+    ~ucc_pt_bootstrap_local();
+    int get_rank() override;
+    int get_size() override;
+protected:
+    ucc_pt_bootstrap_local_info info;
+    size_t                      shm_size;
+    std::vector<pid_t>          children;
+};
+
+#endif
@@ -1,7 +1,10 @@
 #include <iostream>
 #include <cstring>
 #include "ucc_pt_comm.h"
+#include "ucc_pt_bootstrap_local.h"
+#ifdef HAVE_MPI
 #include "ucc_pt_bootstrap_mpi.h"
+#endif
 #include "ucc_perftest.h"
 #include "ucc_pt_cuda.h"
 #include "ucc_pt_rocm.h"
@@ -10,10 +13,22 @@ extern "C" {
 #include "components/mc/ucc_mc.h"
 }
 
-ucc_pt_comm::ucc_pt_comm(ucc_pt_comm_config config)
+ucc_pt_comm::ucc_pt_comm(ucc_pt_bootstrap_config bootstrap_config,
+                         ucc_pt_comm_config config)
 {
     cfg = config;
-    bootstrap = new ucc_pt_bootstrap_mpi();
+    switch (bootstrap_config.bootstrap) {
+#ifdef HAVE_MPI
+    case UCC_PT_BOOTSTRAP_MPI:
+        bootstrap = new ucc_pt_bootstrap_mpi();
+        break;
+#endif
+    case UCC_PT_BOOTSTRAP_LOCAL:
+        bootstrap = new ucc_pt_bootstrap_local(bootstrap_config.n_procs);
+        break;
+    default:
+        throw std::runtime_error("not supported bootstrap");
+    }
 }
 
 ucc_pt_comm::~ucc_pt_comm()
@@ -265,3 +280,27 @@ ucc_status_t ucc_pt_comm::allreduce(double* in, double* out, size_t size,
     ucc_collective_finalize(req);
     return UCC_OK;
 }
+
+ucc_status_t ucc_pt_comm::allgather(double* in, double* out, size_t size)
+{
+    ucc_coll_args_t args;
+    ucc_coll_req_h req;
+
+    args.mask                 = 0;
+    args.coll_type            = UCC_COLL_TYPE_ALLGATHER;
+    args.src.info.buffer      = in;
+    args.src.info.count       = size;
+    args.src.info.datatype    = UCC_DT_FLOAT64;
+    args.src.info.mem_type    = UCC_MEMORY_TYPE_HOST;
+    args.dst.info.buffer      = out;
+    args.dst.info.count       = size * get_size();
+    args.dst.info.datatype    = UCC_DT_FLOAT64;
+    args.dst.info.mem_type    = UCC_MEMORY_TYPE_HOST;
+    ucc_collective_init(&args, &req, team);
+    ucc_collective_post(req);
+    do {
+        ucc_context_progress(context);
+    } while (ucc_collective_test(req) == UCC_INPROGRESS);
+    ucc_collective_finalize(req);
+    return UCC_OK;
+}
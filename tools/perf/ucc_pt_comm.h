@@ -8,9 +8,9 @@
 #define UCC_PT_COMM_H
 
 #include <ucc/api/ucc.h>
+#include "config.h"
 #include "ucc_pt_config.h"
 #include "ucc_pt_bootstrap.h"
-#include "ucc_pt_bootstrap_mpi.h"
 extern "C" {
 #include "components/ec/ucc_ec.h"
 }
@@ -26,7 +26,8 @@ class ucc_pt_comm {
     ucc_pt_bootstrap *bootstrap;
     void set_gpu_device();
 public:
-    ucc_pt_comm(ucc_pt_comm_config config);
+    ucc_pt_comm(ucc_pt_bootstrap_config bootstrap_config,
+                ucc_pt_comm_config config);
     int get_rank();
     int get_size();
     ucc_ee_executor_t* get_executor();
@@ -38,6 +39,7 @@ public:
     ucc_status_t barrier();
     ucc_status_t allreduce(double* in, double *out, size_t size,
                            ucc_reduction_op_t op);
+    ucc_status_t allgather(double *in, double *out, size_t size);
     ucc_status_t finalize();
 };
 
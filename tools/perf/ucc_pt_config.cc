@@ -4,13 +4,19 @@
  * See file LICENSE for terms.
  */
 
+#include "config.h"
 #include "ucc_pt_config.h"
 BEGIN_C_DECLS
 #include "utils/ucc_string.h"
 END_C_DECLS
 
 ucc_pt_config::ucc_pt_config() {
+#ifdef HAVE_MPI
     bootstrap.bootstrap  = UCC_PT_BOOTSTRAP_MPI;
+#else
+    bootstrap.bootstrap  = UCC_PT_BOOTSTRAP_LOCAL;
+#endif
+    bootstrap.n_procs    = 1;
     bench.op_type        = UCC_PT_OP_TYPE_ALLREDUCE;
     bench.min_count      = 128;
     bench.max_count      = 128;
@@ -26,6 +32,11 @@ ucc_pt_config::ucc_pt_config() {
     bench.n_warmup_large = 20;
     bench.large_thresh   = 64 * 1024;
     bench.full_print     = false;
+    bench.dist_print     = false;
+    bench.slowest_print  = false;
+    bench.overlap        = false;
+    bench.n_overlap_progress = 10;
+    bench.out_fmt        = UCC_PT_OUTPUT_FORMAT_TABLE;
     bench.n_bufs         = UCC_PT_DEFAULT_N_BUFS;
     bench.root           = 0;
     bench.root_shift     = 0;
@@ -33,6 +44,19 @@ ucc_pt_config::ucc_pt_config() {
     comm.mt              = bench.mt;
 }
 
+const std::map<std::string, ucc_pt_bootstrap_type_t> ucc_pt_bootstrap_map = {
+#ifdef HAVE_MPI
+    {"mpi", UCC_PT_BOOTSTRAP_MPI},
+#endif
+    {"local", UCC_PT_BOOTSTRAP_LOCAL},
+};
+
+const std::map<std::string, ucc_pt_output_format_t> ucc_pt_output_format_map = {
+    {"table", UCC_PT_OUTPUT_FORMAT_TABLE},
+    {"csv", UCC_PT_OUTPUT_FORMAT_CSV},
+    {"json", UCC_PT_OUTPUT_FORMAT_JSON},
+};
+
 const std::map<std::string, ucc_reduction_op_t> ucc_pt_reduction_op_map = {
     {"sum", UCC_OP_SUM}, {"prod", UCC_OP_PROD}, {"min", UCC_OP_MIN},
     {"max", UCC_OP_MAX}, {"avg", UCC_OP_AVG},
@@ -91,7 +115,7 @@ ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
     int c;
     ucc_status_t st;
 
-    while ((c = getopt(argc, argv, "c:b:e:d:f:m:n:w:o:N:r:S:iphFT")) != -1) {
+    while ((c = getopt(argc, argv, "c:b:e:d:f:m:n:w:o:N:r:S:B:P:O:X:iphFTDRx")) != -1) {
         switch (c) {
             case 'c':
                 if (ucc_pt_op_map.count(optarg) == 0) {
@@ -140,6 +164,17 @@ ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
                     return st;
                 }
                 break;
+            case 'B':
+                if (ucc_pt_bootstrap_map.count(optarg) == 0) {
+                    std::cerr << "invalid bootstrap: " << optarg
+                              << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                bootstrap.bootstrap = ucc_pt_bootstrap_map.at(optarg);
+                break;
+            case 'P':
+                std::stringstream(optarg) >> bootstrap.n_procs;
+                break;
             case 'r':
                 std::stringstream(optarg) >> bench.root;
                 break;
@@ -172,6 +207,31 @@ ucc_status_t ucc_pt_config::process_args(int argc, char *argv[])
             case 'F':
                 bench.full_print = true;
                 break;
+            case 'D':
+                bench.dist_print = true;
+                break;
+            case 'R':
+                bench.slowest_print = true;
+                break;
+            case 'x':
+                bench.overlap = true;
+                break;
+            case 'X':
+                std::stringstream(optarg) >> bench.n_overlap_progress;
+                if (bench.n_overlap_progress < 0) {
+                    std::cerr << "invalid number of progress calls: "
+                              << optarg << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                break;
+            case 'O':
+                if (ucc_pt_output_format_map.count(optarg) == 0) {
+                    std::cerr << "invalid output format: " << optarg
+                              << std::endl;
+                    return UCC_ERR_INVALID_PARAM;
+                }
+                bench.out_fmt = ucc_pt_output_format_map.at(optarg);
+                break;
             case 'h':
             default:
                 print_help();
@@ -199,7 +259,14 @@ void ucc_pt_config::print_help()
     std::cout << "  -N <number>: number of buffers"<<std::endl;
     std::cout << "  -T: triggered collective"<<std::endl;
     std::cout << "  -F: enable full print"<<std::endl;
+    std::cout << "  -D: print latency distribution (percentiles, stddev)"<<std::endl;
+    std::cout << "  -R: print slowest rank"<<std::endl;
+    std::cout << "  -O <format>: output format: table, csv, json"<<std::endl;
+    std::cout << "  -x: measure compute/communication overlap"<<std::endl;
+    std::cout << "  -X <number>: number of progress calls during compute in overlap mode. Default: 10."<<std::endl;
     std::cout << "  -S: <number>: root shift for rooted collectives"<<std::endl;
+    std::cout << "  -B <bootstrap name>: bootstrap type: mpi, local"<<std::endl;
+    std::cout << "  -P <number>: number of processes for local bootstrap"<<std::endl;
     std::cout << "  -h: show this help message"<<std::endl;
     std::cout << std::endl;
 }
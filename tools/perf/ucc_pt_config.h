@@ -19,11 +19,13 @@
 
 enum ucc_pt_bootstrap_type_t {
     UCC_PT_BOOTSTRAP_MPI,
-    UCC_PT_BOOTSTRAP_UCX
+    UCC_PT_BOOTSTRAP_UCX,
+    UCC_PT_BOOTSTRAP_LOCAL
 };
 
 struct ucc_pt_bootstrap_config {
     ucc_pt_bootstrap_type_t bootstrap;
+    int                     n_procs;
 };
 
 struct ucc_pt_comm_config {
@@ -71,6 +73,12 @@ static inline const char* ucc_pt_op_type_str(ucc_pt_op_type_t op)
     return NULL;
 }
 
+enum ucc_pt_output_format_t {
+    UCC_PT_OUTPUT_FORMAT_TABLE,
+    UCC_PT_OUTPUT_FORMAT_CSV,
+    UCC_PT_OUTPUT_FORMAT_JSON
+};
+
 struct ucc_pt_benchmark_config {
     ucc_pt_op_type_t   op_type;
     size_t             min_count;
@@ -88,6 +96,11 @@ struct ucc_pt_benchmark_config {
     int                n_warmup_large;
     int                n_bufs;
     bool               full_print;
+    bool               dist_print;
+    bool               slowest_print;
+    bool               overlap;
+    int                n_overlap_progress;
+    ucc_pt_output_format_t out_fmt;
     int                root;
     int                root_shift;
     int                mult_factor;